@@ -1,21 +1,26 @@
 #include "fastfetch.h"
 
+#include <string.h>
+#include <pthread.h>
+
 void ffFormatAppendFormatArg(FFstrbuf* buffer, const FFformatarg* formatarg)
 {
     if(formatarg->type == FF_FORMAT_ARG_TYPE_INT)
-        ffStrbufAppendF(buffer, "%i", *(int*)formatarg->value);
+        ffStrbufAppendInt(buffer, *(int*)formatarg->value);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT)
-        ffStrbufAppendF(buffer, "%u", *(uint32_t*)formatarg->value);
+        ffStrbufAppendUInt(buffer, *(uint32_t*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT64)
+        ffStrbufAppendUInt(buffer, *(uint64_t*)formatarg->value);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT16)
-        ffStrbufAppendF(buffer, "%hu", *(uint16_t*)formatarg->value);
+        ffStrbufAppendUInt(buffer, *(uint16_t*)formatarg->value);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT8)
-        ffStrbufAppendF(buffer, "%hhu", *(uint8_t*)formatarg->value);
+        ffStrbufAppendUInt(buffer, *(uint8_t*)formatarg->value);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_STRING)
         ffStrbufAppendS(buffer, (const char*)formatarg->value);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_STRBUF)
         ffStrbufAppend(buffer, (FFstrbuf*)formatarg->value);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_DOUBLE)
-        ffStrbufAppendF(buffer, "%g", *(double*)formatarg->value);
+        ffStrbufAppendDoubleG(buffer, *(double*)formatarg->value, 6);
     else if(formatarg->type == FF_FORMAT_ARG_TYPE_LIST)
     {
         const FFlist* list = formatarg->value;
@@ -26,6 +31,16 @@ void ffFormatAppendFormatArg(FFstrbuf* buffer, const FFformatarg* formatarg)
                 ffStrbufAppendS(buffer, ", ");
         }
     }
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_DOUBLE_LIST)
+    {
+        const FFlist* list = formatarg->value;
+        for(uint32_t i = 0; i < list->length; i++)
+        {
+            ffStrbufAppendDoubleG(buffer, *FF_LIST_GET(const double, list, i), 6);
+            if(i < list->length - 1)
+                ffStrbufAppendS(buffer, ", ");
+        }
+    }
     else if(formatarg->type != FF_FORMAT_ARG_TYPE_NULL)
     {
         fprintf(stderr, "Error: format string \"%s\": argument is not implemented: %i\n", buffer->chars, formatarg->type);
@@ -62,7 +77,7 @@ static inline void appendInvalidPlaceholder(FFstrbuf* buffer, const char* start,
 
 static inline void appendEmptyPlaceholder(FFstrbuf* buffer, const char* placeholder, uint32_t* argCounter, uint32_t numArgs, const FFformatarg* arguments)
 {
-    if(*argCounter > numArgs)
+    if(*argCounter >= numArgs)
         ffStrbufAppendS(buffer, placeholder);
     else
         ffFormatAppendFormatArg(buffer, &arguments[(*argCounter)++]);
@@ -77,7 +92,9 @@ static inline bool formatArgSet(const FFformatarg* arg)
         (arg->type == FF_FORMAT_ARG_TYPE_STRING && *(const char*)arg->value != '\0') ||
         (arg->type == FF_FORMAT_ARG_TYPE_UINT8 && *(uint8_t*)arg->value > 0) ||
         (arg->type == FF_FORMAT_ARG_TYPE_UINT16 && *(uint16_t*)arg->value > 0) ||
-        (arg->type == FF_FORMAT_ARG_TYPE_UINT && *(uint32_t*)arg->value > 0)
+        (arg->type == FF_FORMAT_ARG_TYPE_UINT && *(uint32_t*)arg->value > 0) ||
+        (arg->type == FF_FORMAT_ARG_TYPE_UINT64 && *(uint64_t*)arg->value > 0) ||
+        (arg->type == FF_FORMAT_ARG_TYPE_DOUBLE_LIST && ((const FFlist*)arg->value)->length > 0)
     );
 }
 
@@ -186,18 +203,20 @@ void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFst
         {
             ffStrbufSubstrAfter(&placeholderValue, 0);
 
+            bool isForError = placeholderValueIsForError(&placeholderValue);
+
             // continue if an error is set
-            if(placeholderValueIsForError(&placeholderValue) && error != NULL && error->length > 0)
+            if(isForError && error != NULL && error->length > 0)
             {
                 ++numOpenIfs;
                 ffStrbufDestroy(&placeholderValue);
                 continue;
             }
 
-            uint32_t index = getArgumentIndex(&placeholderValue);
+            uint32_t index = isForError ? 0 : getArgumentIndex(&placeholderValue);
 
             // testing for an invalid index
-            if(index > numArgs)
+            if(!isForError && (index == 0 || index > numArgs))
             {
                 appendInvalidPlaceholder(buffer, "{?", &placeholderValue, i, formatstr->length);
                 ffStrbufDestroy(&placeholderValue);
@@ -205,7 +224,7 @@ void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFst
             }
 
             // continue normally if an format arg is set and the value is > 0
-            if(formatArgSet(&arguments[index - 1]))
+            if(!isForError && formatArgSet(&arguments[index - 1]))
             {
                 ++numOpenIfs;
                 ffStrbufDestroy(&placeholderValue);
@@ -223,18 +242,20 @@ void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFst
         {
             ffStrbufSubstrAfter(&placeholderValue, 0);
 
+            bool isForError = placeholderValueIsForError(&placeholderValue);
+
             //continue if an error os not set
-            if(placeholderValueIsForError(&placeholderValue) && (error == NULL || error->length == 0))
+            if(isForError && (error == NULL || error->length == 0))
             {
                 ++numOpenNotIfs;
                 ffStrbufDestroy(&placeholderValue);
                 continue;
             }
 
-            uint32_t index = getArgumentIndex(&placeholderValue);
+            uint32_t index = isForError ? 0 : getArgumentIndex(&placeholderValue);
 
             // testing for an invalid index
-            if(index > numArgs)
+            if(!isForError && (index == 0 || index > numArgs))
             {
                 appendInvalidPlaceholder(buffer, "{/", &placeholderValue, i, formatstr->length);
                 ffStrbufDestroy(&placeholderValue);
@@ -242,7 +263,7 @@ void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFst
             }
 
             //continue normally if an format arg is not set or the value is 0
-            if(!formatArgSet(&arguments[index - 1]))
+            if(!isForError && !formatArgSet(&arguments[index - 1]))
             {
                 ++numOpenNotIfs;
                 ffStrbufDestroy(&placeholderValue);
@@ -270,7 +291,7 @@ void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFst
         uint32_t index = getArgumentIndex(&placeholderValue);
 
         // test for invalid index
-        if(index > numArgs)
+        if(index == 0 || index > numArgs)
         {
             appendInvalidPlaceholder(buffer, "{", &placeholderValue, i, formatstr->length);
             ffStrbufDestroy(&placeholderValue);
@@ -287,3 +308,392 @@ void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFst
     if(numOpenColors > 0)
         ffStrbufAppendS(buffer, "\033[0m");
 }
+
+#define FF_FORMAT_END UINT32_MAX
+
+static void appendInstruction(FFformat* format, uint32_t* nodeAt, uint32_t position, FFformatinstructiontype type, uint32_t textStart, uint32_t textLength)
+{
+    nodeAt[position] = format->instructions.length;
+
+    FFformatinstruction* instruction = ffListAdd(&format->instructions);
+    instruction->type = type;
+    instruction->argIndex = 0;
+    instruction->textStart = textStart;
+    instruction->textLength = textLength;
+    instruction->next = FF_FORMAT_END;
+    instruction->jump = FF_FORMAT_END;
+}
+
+// Compiles the single placeholder or char at position, exactly like one iteration of ffParseFormatString does.
+// next and jump are set to source positions, they are resolved to instruction indices once all reachable positions are compiled.
+static void compileAt(FFformat* format, uint32_t* nodeAt, uint32_t position)
+{
+    const char* chars = format->text.chars;
+    uint32_t length = format->sourceLength;
+
+    if(chars[position] != '{')
+    {
+        appendInstruction(format, nodeAt, position, FF_FORMAT_INSTRUCTION_TYPE_LITERAL, position, 1);
+        FF_LIST_GET(FFformatinstruction, &format->instructions, nodeAt[position])->next = position + 1;
+        return;
+    }
+
+    if(position == length - 1)
+    {
+        appendInstruction(format, nodeAt, position, FF_FORMAT_INSTRUCTION_TYPE_NEXT_ARG, position, 1);
+        FF_LIST_GET(FFformatinstruction, &format->instructions, nodeAt[position])->next = position + 1;
+        return;
+    }
+
+    if(chars[position + 1] == '{' || chars[position + 1] == '}')
+    {
+        appendInstruction(format, nodeAt, position, chars[position + 1] == '{' ? FF_FORMAT_INSTRUCTION_TYPE_LITERAL : FF_FORMAT_INSTRUCTION_TYPE_NEXT_ARG, position, chars[position + 1] == '{' ? 1 : 2);
+        FF_LIST_GET(FFformatinstruction, &format->instructions, nodeAt[position])->next = position + 2;
+        return;
+    }
+
+    uint32_t i = position + 1;
+    while(i < length && chars[i] != '}')
+        ++i;
+
+    //The source text of the placeholder, which is printed if it is invalid
+    uint32_t sourceLength = (i < length ? i + 1 : length) - position;
+
+    FFstrbuf placeholderValue;
+    ffStrbufInitA(&placeholderValue, 0);
+    ffStrbufAppendNS(&placeholderValue, i - position - 1, chars + position + 1);
+
+    FFformatinstructiontype type = FF_FORMAT_INSTRUCTION_TYPE_LITERAL;
+    uint32_t argIndex = 0;
+    uint32_t jump = FF_FORMAT_END;
+
+    if(placeholderValueIsForError(&placeholderValue))
+        type = FF_FORMAT_INSTRUCTION_TYPE_ERROR;
+    else if(ffStrbufCompS(&placeholderValue, "-") == 0)
+        type = FF_FORMAT_INSTRUCTION_TYPE_STOP;
+    else if(ffStrbufCompS(&placeholderValue, "?") == 0)
+        type = FF_FORMAT_INSTRUCTION_TYPE_END_IF;
+    else if(ffStrbufCompS(&placeholderValue, "/") == 0)
+        type = FF_FORMAT_INSTRUCTION_TYPE_END_NOT_IF;
+    else if(ffStrbufCompS(&placeholderValue, "#") == 0)
+        type = FF_FORMAT_INSTRUCTION_TYPE_END_COLOR;
+    else if(placeholderValue.chars[0] == '?' || placeholderValue.chars[0] == '/')
+    {
+        bool isIf = placeholderValue.chars[0] == '?';
+        ffStrbufSubstrAfter(&placeholderValue, 0);
+
+        jump = ffStrbufNextIndexS(&format->text, i, isIf ? "{?}" : "{/}");
+        jump = jump < length ? jump + 3 : FF_FORMAT_END;
+
+        if(placeholderValueIsForError(&placeholderValue))
+            type = isIf ? FF_FORMAT_INSTRUCTION_TYPE_IF_ERROR : FF_FORMAT_INSTRUCTION_TYPE_NOT_IF_ERROR;
+        else
+        {
+            uint32_t index = getArgumentIndex(&placeholderValue);
+            if(index > 0 && index != UINT32_MAX)
+            {
+                type = isIf ? FF_FORMAT_INSTRUCTION_TYPE_IF : FF_FORMAT_INSTRUCTION_TYPE_NOT_IF;
+                argIndex = index - 1;
+            }
+            else
+                jump = FF_FORMAT_END;
+        }
+    }
+    else if(placeholderValue.chars[0] == '#')
+        type = FF_FORMAT_INSTRUCTION_TYPE_COLOR;
+    else
+    {
+        uint32_t index = getArgumentIndex(&placeholderValue);
+        if(index > 0 && index != UINT32_MAX)
+        {
+            type = FF_FORMAT_INSTRUCTION_TYPE_ARG;
+            argIndex = index - 1;
+        }
+    }
+
+    uint32_t textStart = position;
+    if(type == FF_FORMAT_INSTRUCTION_TYPE_COLOR)
+    {
+        textStart = format->text.length;
+        sourceLength = placeholderValue.length + 2; // "\033[" + color + "m" - 1 for the '#'
+        ffStrbufAppendS(&format->text, "\033[");
+        ffStrbufAppendNS(&format->text, placeholderValue.length - 1, placeholderValue.chars + 1);
+        ffStrbufAppendC(&format->text, 'm');
+    }
+
+    ffStrbufDestroy(&placeholderValue);
+
+    appendInstruction(format, nodeAt, position, type, textStart, sourceLength);
+    FFformatinstruction* instruction = ffListGet(&format->instructions, nodeAt[position]);
+    instruction->argIndex = argIndex;
+    instruction->jump = jump;
+    instruction->next = type == FF_FORMAT_INSTRUCTION_TYPE_STOP ? FF_FORMAT_END : i + 1;
+}
+
+static inline uint32_t resolvePosition(const uint32_t* nodeAt, uint32_t length, uint32_t position)
+{
+    return position < length ? nodeAt[position] : FF_FORMAT_END;
+}
+
+void ffFormatCompile(FFformat* format, const FFstrbuf* formatstr)
+{
+    ffStrbufInitCopy(&format->text, formatstr);
+    format->sourceLength = formatstr->length;
+    ffListInitA(&format->instructions, sizeof(FFformatinstruction), formatstr->length > 0 ? formatstr->length : 1);
+    format->start = FF_FORMAT_END;
+    format->usedArgs = 0;
+
+    if(formatstr->length == 0)
+        return;
+
+    uint32_t length = formatstr->length;
+    uint32_t* nodeAt = malloc(sizeof(uint32_t) * length);
+    memset(nodeAt, 0xff, sizeof(uint32_t) * length);
+
+    //Compile every position which can be reached, either by continuing after an instruction or by skipping an if.
+    //A skipped if continues after the next "{?}" in the source text, which may be in the middle of another placeholder.
+    uint32_t* pending = malloc(sizeof(uint32_t) * length * 2 + sizeof(uint32_t));
+    uint32_t numPending = 0;
+    pending[numPending++] = 0;
+
+    while(numPending > 0)
+    {
+        uint32_t position = pending[--numPending];
+        if(position >= length || nodeAt[position] != FF_FORMAT_END)
+            continue;
+
+        compileAt(format, nodeAt, position);
+
+        const FFformatinstruction* instruction = ffListGet(&format->instructions, nodeAt[position]);
+        if(instruction->next != FF_FORMAT_END)
+            pending[numPending++] = instruction->next;
+        if(instruction->jump != FF_FORMAT_END)
+            pending[numPending++] = instruction->jump;
+    }
+
+    uint32_t* references = calloc(format->instructions.length, sizeof(uint32_t));
+
+    for(uint32_t i = 0; i < format->instructions.length; i++)
+    {
+        FFformatinstruction* instruction = ffListGet(&format->instructions, i);
+        instruction->next = instruction->next == FF_FORMAT_END ? FF_FORMAT_END : resolvePosition(nodeAt, length, instruction->next);
+        instruction->jump = instruction->jump == FF_FORMAT_END ? FF_FORMAT_END : resolvePosition(nodeAt, length, instruction->jump);
+
+        if(instruction->next != FF_FORMAT_END)
+            ++references[instruction->next];
+        if(instruction->jump != FF_FORMAT_END)
+            ++references[instruction->jump];
+    }
+
+    format->start = nodeAt[0];
+    ++references[format->start];
+
+    //Merge runs of literals, which are continuous in the text and aren't a jump target
+    for(uint32_t i = 0; i < format->instructions.length; i++)
+    {
+        FFformatinstruction* instruction = ffListGet(&format->instructions, i);
+        if(instruction->type != FF_FORMAT_INSTRUCTION_TYPE_LITERAL || references[i] == 0)
+            continue;
+
+        while(instruction->next != FF_FORMAT_END)
+        {
+            FFformatinstruction* next = ffListGet(&format->instructions, instruction->next);
+            if(
+                next->type != FF_FORMAT_INSTRUCTION_TYPE_LITERAL ||
+                references[instruction->next] != 1 ||
+                next->textStart != instruction->textStart + instruction->textLength
+            ) break;
+
+            references[instruction->next] = 0;
+            instruction->textLength += next->textLength;
+            instruction->next = next->next;
+        }
+    }
+
+    //Remove the merged instructions
+    uint32_t* newIndex = nodeAt; //Not needed anymore, always large enough because every instruction has its own position
+    uint32_t numInstructions = 0;
+    for(uint32_t i = 0; i < format->instructions.length; i++)
+    {
+        newIndex[i] = numInstructions;
+        if(references[i] == 0)
+            continue;
+
+        if(numInstructions != i)
+            memcpy(ffListGet(&format->instructions, numInstructions), ffListGet(&format->instructions, i), sizeof(FFformatinstruction));
+        ++numInstructions;
+    }
+    format->instructions.length = numInstructions;
+
+    for(uint32_t i = 0; i < numInstructions; i++)
+    {
+        FFformatinstruction* instruction = ffListGet(&format->instructions, i);
+        if(instruction->next != FF_FORMAT_END)
+            instruction->next = newIndex[instruction->next];
+        if(instruction->jump != FF_FORMAT_END)
+            instruction->jump = newIndex[instruction->jump];
+    }
+    format->start = newIndex[format->start];
+
+    uint32_t numNextArgs = 0;
+    for(uint32_t i = 0; i < numInstructions; i++)
+    {
+        const FFformatinstruction* instruction = ffListGet(&format->instructions, i);
+        if(instruction->type == FF_FORMAT_INSTRUCTION_TYPE_NEXT_ARG)
+            ++numNextArgs;
+        else if(
+            (instruction->type == FF_FORMAT_INSTRUCTION_TYPE_ARG || instruction->type == FF_FORMAT_INSTRUCTION_TYPE_IF || instruction->type == FF_FORMAT_INSTRUCTION_TYPE_NOT_IF) &&
+            instruction->argIndex < 64
+        ) format->usedArgs |= 1ULL << instruction->argIndex;
+    }
+
+    //Every {} takes the next argument, so in the worst case they use the first numNextArgs ones
+    format->usedArgs |= numNextArgs >= 64 ? UINT64_MAX : (1ULL << numNextArgs) - 1;
+
+    free(references);
+    free(pending);
+    free(nodeAt);
+}
+
+void ffFormatDestroy(FFformat* format)
+{
+    ffStrbufDestroy(&format->text);
+    ffListDestroy(&format->instructions);
+}
+
+typedef struct FFcompiledformat
+{
+    struct FFcompiledformat* next;
+    const FFstrbuf* source;
+    FFformat format;
+} FFcompiledformat;
+
+static pthread_mutex_t compiledFormatsMutex = PTHREAD_MUTEX_INITIALIZER;
+static FFcompiledformat* compiledFormats = NULL;
+
+const FFformat* ffFormatGetCompiled(const FFstrbuf* formatstr)
+{
+    pthread_mutex_lock(&compiledFormatsMutex);
+
+    //Format strings are nearly always the ones from the config, so the pointer is a good key. The content is compared anyway
+    FFcompiledformat* entry = compiledFormats;
+    while(entry != NULL && (
+        entry->source != formatstr ||
+        entry->format.sourceLength != formatstr->length ||
+        memcmp(entry->format.text.chars, formatstr->chars, formatstr->length) != 0
+    )) entry = entry->next;
+
+    if(entry == NULL)
+    {
+        entry = malloc(sizeof(FFcompiledformat));
+        entry->source = formatstr;
+        ffFormatCompile(&entry->format, formatstr);
+        entry->next = compiledFormats;
+        compiledFormats = entry;
+    }
+
+    pthread_mutex_unlock(&compiledFormatsMutex);
+
+    return &entry->format;
+}
+
+void ffFormatRender(FFstrbuf* buffer, const FFformat* format, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments)
+{
+    uint32_t argCounter = 0;
+
+    uint32_t numOpenIfs = 0;
+    uint32_t numOpenNotIfs = 0;
+    uint32_t numOpenColors = 0;
+
+    bool errorSet = error != NULL && error->length > 0;
+
+    uint32_t index = format->start;
+    while(index != FF_FORMAT_END)
+    {
+        const FFformatinstruction* instruction = FF_LIST_GET(const FFformatinstruction, &format->instructions, index);
+        const char* text = format->text.chars + instruction->textStart;
+        index = instruction->next;
+
+        switch(instruction->type)
+        {
+            case FF_FORMAT_INSTRUCTION_TYPE_LITERAL:
+            case FF_FORMAT_INSTRUCTION_TYPE_COLOR:
+                ffStrbufAppendNS(buffer, instruction->textLength, text);
+                if(instruction->type == FF_FORMAT_INSTRUCTION_TYPE_COLOR)
+                    ++numOpenColors;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_ARG:
+                if(instruction->argIndex < numArgs)
+                    ffFormatAppendFormatArg(buffer, &arguments[instruction->argIndex]);
+                else
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_NEXT_ARG:
+                if(argCounter < numArgs)
+                    ffFormatAppendFormatArg(buffer, &arguments[argCounter++]);
+                else
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_ERROR:
+                ffStrbufAppend(buffer, error);
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_STOP:
+                index = FF_FORMAT_END;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_IF:
+                if(instruction->argIndex >= numArgs)
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                else if(formatArgSet(&arguments[instruction->argIndex]))
+                    ++numOpenIfs;
+                else
+                    index = instruction->jump;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_NOT_IF:
+                if(instruction->argIndex >= numArgs)
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                else if(!formatArgSet(&arguments[instruction->argIndex]))
+                    ++numOpenNotIfs;
+                else
+                    index = instruction->jump;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_IF_ERROR:
+                if(errorSet)
+                    ++numOpenIfs;
+                else
+                    index = instruction->jump;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_NOT_IF_ERROR:
+                if(!errorSet)
+                    ++numOpenNotIfs;
+                else
+                    index = instruction->jump;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_END_IF:
+                if(numOpenIfs == 0)
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                else
+                    --numOpenIfs;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_END_NOT_IF:
+                if(numOpenNotIfs == 0)
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                else
+                    --numOpenNotIfs;
+                break;
+            case FF_FORMAT_INSTRUCTION_TYPE_END_COLOR:
+                if(numOpenColors == 0)
+                    ffStrbufAppendNS(buffer, instruction->textLength, text);
+                else
+                {
+                    ffStrbufAppendS(buffer, "\033[0m");
+                    --numOpenColors;
+                }
+                break;
+        }
+    }
+
+    ffStrbufTrimRight(buffer, ' ');
+
+    if(numOpenColors > 0)
+        ffStrbufAppendS(buffer, "\033[0m");
+}
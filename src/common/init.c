@@ -1,5 +1,6 @@
 #include "fastfetch.h"
 
+#include <string.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <signal.h>
@@ -16,7 +17,7 @@ static void initConfigDirs(FFstate* state)
     const char* xdgConfigHome = getenv("XDG_CONFIG_HOME");
     if(xdgConfigHome != NULL)
     {
-        FFstrbuf* buffer = (FFstrbuf*) ffListAdd(&state->configDirs);
+        FFstrbuf* buffer = FF_LIST_ADD(FFstrbuf, &state->configDirs);
         ffStrbufInitA(buffer, 64);
         ffStrbufAppendS(buffer, xdgConfigHome);
         ffStrbufTrimRight(buffer, '/');
@@ -47,7 +48,7 @@ static void initConfigDirs(FFstate* state)
         uint32_t colonIndex = ffStrbufNextIndexC(&xdgConfigDirs, startIndex, ':');
         xdgConfigDirs.chars[colonIndex] = '\0';
 
-        FFstrbuf* buffer = (FFstrbuf*) ffListAdd(&state->configDirs);
+        FFstrbuf* buffer = FF_LIST_ADD(FFstrbuf, &state->configDirs);
         ffStrbufInitA(buffer, 64);
         ffStrbufAppendS(buffer, xdgConfigDirs.chars + startIndex);
         ffStrbufTrimRight(buffer, '/');
@@ -92,6 +93,9 @@ static void initCacheDir(FFstate* state)
 static void initState(FFstate* state)
 {
     state->logoWidth = 0;
+    state->logoLineIndex = 0;
+    state->jsonResults = 0;
+    memset(state->modules, 0, sizeof(state->modules));
     state->passwd = getpwuid(getuid());
     uname(&state->utsname);
     sysinfo(&state->sysinfo);
@@ -118,66 +122,20 @@ static void defaultConfig(FFinstance* instance)
     instance->config.disableLinewrap = true;
     instance->config.hideCursor = true;
     instance->config.userLogoIsRaw = false;
+    instance->config.multithreading = true;
+    instance->config.samplingWindow = 1000;
+    instance->config.outputFormat = FF_OUTPUT_FORMAT_DEFAULT;
 
     for(uint8_t i = 0; i < (uint8_t) FASTFETCH_LOGO_MAX_COLORS; ++i)
         ffStrbufInit(&instance->config.logoColors[i]);
 
-    ffStrbufInitA(&instance->config.osFormat, 0);
-    ffStrbufInitA(&instance->config.osKey, 0);
-    ffStrbufInitA(&instance->config.hostFormat, 0);
-    ffStrbufInitA(&instance->config.hostKey, 0);
-    ffStrbufInitA(&instance->config.kernelFormat, 0);
-    ffStrbufInitA(&instance->config.kernelKey, 0);
-    ffStrbufInitA(&instance->config.uptimeFormat, 0);
-    ffStrbufInitA(&instance->config.uptimeKey, 0);
-    ffStrbufInitA(&instance->config.processesFormat, 0);
-    ffStrbufInitA(&instance->config.processesKey, 0);
-    ffStrbufInitA(&instance->config.packagesFormat, 0);
-    ffStrbufInitA(&instance->config.packagesKey, 0);
-    ffStrbufInitA(&instance->config.shellFormat, 0);
-    ffStrbufInitA(&instance->config.shellKey, 0);
-    ffStrbufInitA(&instance->config.resolutionFormat, 0);
-    ffStrbufInitA(&instance->config.resolutionKey, 0);
-    ffStrbufInitA(&instance->config.deFormat, 0);
-    ffStrbufInitA(&instance->config.deKey, 0);
-    ffStrbufInitA(&instance->config.wmFormat, 0);
-    ffStrbufInitA(&instance->config.wmKey, 0);
-    ffStrbufInitA(&instance->config.wmThemeFormat, 0);
-    ffStrbufInitA(&instance->config.wmThemeKey, 0);
-    ffStrbufInitA(&instance->config.themeFormat, 0);
-    ffStrbufInitA(&instance->config.themeKey, 0);
-    ffStrbufInitA(&instance->config.iconsFormat, 0);
-    ffStrbufInitA(&instance->config.iconsKey, 0);
-    ffStrbufInitA(&instance->config.fontFormat, 0);
-    ffStrbufInitA(&instance->config.fontKey, 0);
-    ffStrbufInitA(&instance->config.cursorKey, 0);
-    ffStrbufInitA(&instance->config.cursorFormat, 0);
-    ffStrbufInitA(&instance->config.terminalFormat, 0);
-    ffStrbufInitA(&instance->config.terminalKey, 0);
-    ffStrbufInitA(&instance->config.termFontFormat, 0);
-    ffStrbufInitA(&instance->config.termFontKey, 0);
-    ffStrbufInitA(&instance->config.cpuFormat, 0);
-    ffStrbufInitA(&instance->config.cpuKey, 0);
-    ffStrbufInitA(&instance->config.cpuUsageFormat, 0);
-    ffStrbufInitA(&instance->config.cpuUsageKey, 0);
-    ffStrbufInitA(&instance->config.gpuFormat, 0);
-    ffStrbufInitA(&instance->config.gpuKey, 0);
-    ffStrbufInitA(&instance->config.memoryFormat, 0);
-    ffStrbufInitA(&instance->config.memoryKey, 0);
-    ffStrbufInitA(&instance->config.diskFormat, 0);
-    ffStrbufInitA(&instance->config.diskKey, 0);
-    ffStrbufInitA(&instance->config.batteryFormat, 0);
-    ffStrbufInitA(&instance->config.batteryKey, 0);
-    ffStrbufInitA(&instance->config.localeFormat, 0);
-    ffStrbufInitA(&instance->config.localeKey, 0);
-    ffStrbufInitA(&instance->config.localIpKey, 0);
-    ffStrbufInitA(&instance->config.localIpFormat, 0);
-    ffStrbufInitA(&instance->config.publicIpKey, 0);
-    ffStrbufInitA(&instance->config.publicIpFormat, 0);
-    ffStrbufInitA(&instance->config.playerKey, 0);
-    ffStrbufInitA(&instance->config.playerFormat, 0);
-    ffStrbufInitA(&instance->config.songKey, 0);
-    ffStrbufInitA(&instance->config.songFormat, 0);
+    for(uint32_t i = 0; i < FF_MODULE_ID_COUNT; ++i)
+    {
+        FFmoduleConfig* module = &instance->config.modules[i];
+        ffStrbufInit(&module->key);
+        ffStrbufInit(&module->format);
+        module->timeout = 0;
+    }
 
     ffStrbufInitA(&instance->config.libPCI, 0);
     ffStrbufInitA(&instance->config.libVulkan, 0);
@@ -191,8 +149,10 @@ static void defaultConfig(FFinstance* instance)
     ffStrbufInitA(&instance->config.libDBus, 0);
     ffStrbufInitA(&instance->config.libXFConf, 0);
     ffStrbufInitA(&instance->config.librpm, 0);
+    ffStrbufInitA(&instance->config.libSQLite3, 0);
 
     ffStrbufInitA(&instance->config.diskFolders, 0);
+    instance->config.diskShowAll = false;
 
     ffStrbufInitA(&instance->config.batteryDir, 0);
 
@@ -202,7 +162,7 @@ static void defaultConfig(FFinstance* instance)
     instance->config.localIpShowIpV6 = false;
     instance->config.localIpShowLoop = false;
 
-    instance->config.publicIpTimeout = 0;
+    ffStrbufInitA(&instance->config.publicIpUrls, 0);
 
     ffStrbufInitA(&instance->config.osFile, 0);
 
@@ -212,31 +172,57 @@ static void defaultConfig(FFinstance* instance)
 void ffInitInstance(FFinstance* instance)
 {
     initState(&instance->state);
+    ffOutputInit(instance);
     defaultConfig(instance);
     ffCacheValidate(instance);
 }
 
-static void resetConsole(bool disableLinewrap, bool hideCursor)
-{
-    if(disableLinewrap)
-        fputs("\033[?7h", stdout);
-
-    if(hideCursor)
-        fputs("\033[?25h", stdout);
-}
-
 static volatile bool ffDisableLinewrap = true;
 static volatile bool ffHideCursor = true;
 
 static void exitSignalHandler(int signal)
 {
     FF_UNUSED(signal);
-    resetConsole(ffDisableLinewrap, ffHideCursor);
+
+    //The output sink isn't safe to use here, write to the terminal directly
+    if(ffDisableLinewrap)
+        FF_UNUSED(write(STDOUT_FILENO, "\033[?7h", 5));
+
+    if(ffHideCursor)
+        FF_UNUSED(write(STDOUT_FILENO, "\033[?25h", 6));
+
     exit(0);
 }
 
+//NULL for empty strings, modules print their default output then
+static FFformat* compileModuleString(const FFstrbuf* formatstr)
+{
+    if(formatstr->length == 0)
+        return NULL;
+
+    FFformat* format = malloc(sizeof(FFformat));
+    ffFormatCompile(format, formatstr);
+    return format;
+}
+
 void ffStart(FFinstance* instance)
 {
+    //The config doesn't change anymore. Compile the module strings now, so printing them is a plain lookup
+    for(uint32_t i = 0; i < FF_MODULE_ID_COUNT; ++i)
+    {
+        instance->state.modules[i].key = compileModuleString(&instance->config.modules[i].key);
+        instance->state.modules[i].format = compileModuleString(&instance->config.modules[i].format);
+    }
+
+    //JSON output is meant for other programs, don't touch the terminal
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+    {
+        instance->config.disableLinewrap = false;
+        instance->config.hideCursor = false;
+        instance->config.printRemainingLogo = false;
+        ffPrintJsonStart(instance);
+    }
+
     ffDisableLinewrap = instance->config.disableLinewrap;
     ffHideCursor = instance->config.hideCursor;
 
@@ -248,10 +234,10 @@ void ffStart(FFinstance* instance)
     sigaction(SIGQUIT, &action, NULL);
 
     if(instance->config.hideCursor)
-        fputs("\033[?25l", stdout);
+        ffOutputWriteS(instance, "\033[?25l");
 
     if(instance->config.disableLinewrap)
-        fputs("\033[?7l", stdout);
+        ffOutputWriteS(instance, "\033[?7l");
 }
 
 void ffFinish(FFinstance* instance)
@@ -259,7 +245,16 @@ void ffFinish(FFinstance* instance)
     if(instance->config.printRemainingLogo)
         ffPrintRemainingLogo(instance);
 
-    resetConsole(instance->config.disableLinewrap, instance->config.hideCursor);
+    if(instance->config.disableLinewrap)
+        ffOutputWriteS(instance, "\033[?7h");
+
+    if(instance->config.hideCursor)
+        ffOutputWriteS(instance, "\033[?25h");
+
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        ffPrintJsonFinish(instance);
+
+    ffOutputFlush(instance);
 }
 
 void ffListFeatures()
@@ -301,6 +296,9 @@ void ffListFeatures()
         #ifdef FF_HAVE_RPM
             "librpm\n"
         #endif
+        #ifdef FF_HAVE_SQLITE3
+            "sqlite3\n"
+        #endif
         ""
     , stdout);
 }
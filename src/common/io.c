@@ -1,84 +1,105 @@
 #include "fastfetch.h"
 
 #include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <pthread.h>
 
 #define FF_IO_CACHE_VALUE_EXTENSION "ffcv"
 #define FF_IO_CACHE_SPLIT_EXTENSION "ffcs"
 
-void ffPrintLogoAndKey(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat)
+void ffPrintLogoAndKey(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey)
 {
+    //JSON output has no keys. Modules print their values with ffPrintFormatString instead
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        return;
+
     ffPrintLogoLine(instance);
 
-    fputs(FASTFETCH_TEXT_MODIFIER_BOLT, stdout);
-    ffPrintColor(&instance->config.color);
+    ffOutputWriteS(instance, FASTFETCH_TEXT_MODIFIER_BOLT);
+    ffPrintColor(instance, &instance->config.color);
 
-    if(customKeyFormat == NULL || customKeyFormat->length == 0)
+    if(customKey == NULL)
     {
-        fputs(moduleName, stdout);
+        ffOutputWriteS(instance, moduleName);
 
         if(moduleIndex > 0)
-            printf(" %hhu", moduleIndex);
+            ffOutputWriteF(instance, " %hhu", moduleIndex);
     }
     else
     {
         FFstrbuf key;
         ffStrbufInit(&key);
-        ffParseFormatString(&key, customKeyFormat, NULL, 1, (FFformatarg[]){
+        ffFormatRender(&key, customKey, NULL, 1, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_UINT8, &moduleIndex}
         });
-        ffStrbufWriteTo(&key, stdout);
+        ffOutputWrite(instance, &key);
         ffStrbufDestroy(&key);
     }
 
-    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stdout);
-    ffStrbufWriteTo(&instance->config.separator, stdout);
+    ffOutputWriteS(instance, FASTFETCH_TEXT_MODIFIER_RESET);
+    ffOutputWrite(instance, &instance->config.separator);
 }
 
-void ffPrintError(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, uint32_t numFormatArgs, const char* message, ...)
+void ffPrintError(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey, const FFformat* format, uint32_t numFormatArgs, const char* message, ...)
 {
-    if(!instance->config.showErrors)
+    //Errors are always part of the JSON output, consumers can filter them easily
+    if(!instance->config.showErrors && instance->config.outputFormat != FF_OUTPUT_FORMAT_JSON)
         return;
 
     va_list arguments;
     va_start(arguments, message);
 
-    if(formatString == NULL || formatString->length == 0)
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        ffPrintJsonError(instance, moduleName, moduleIndex, message, arguments);
+    else if(format == NULL)
     {
-        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKeyFormat);
-        fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stdout);
-        vprintf(message, arguments);
-        puts(FASTFETCH_TEXT_MODIFIER_RESET);
+        FF_STRBUF_CREATE(error);
+        ffStrbufAppendS(&error, FASTFETCH_TEXT_MODIFIER_ERROR);
+        ffStrbufAppendVF(&error, message, arguments);
+        ffStrbufAppendS(&error, FASTFETCH_TEXT_MODIFIER_RESET);
+
+        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKey);
+        ffOutputPut(instance, &error);
+        ffStrbufDestroy(&error);
     }
     else
     {
         FF_STRBUF_CREATE(error);
         ffStrbufAppendVF(&error, message, arguments);
 
-        // calloc sets all to 0 and FF_FORMAT_ARG_TYPE_NULL also has value 0 so we don't need to explictly set it
-        FFformatarg* nullArgs = calloc(numFormatArgs, sizeof(FFformatarg));
+        //FF_FORMAT_ARG_TYPE_NULL has value 0, so zeroing them is enough
+        FFformatarg* nullArgs = ffArenaAlloc(sizeof(FFformatarg) * numFormatArgs);
+        memset(nullArgs, 0, sizeof(FFformatarg) * numFormatArgs);
 
-        ffPrintFormatString(instance, moduleName, moduleIndex, customKeyFormat, formatString, &error, numFormatArgs, nullArgs);
+        ffPrintFormatString(instance, moduleName, moduleIndex, customKey, format, &error, numFormatArgs, nullArgs);
 
-        free(nullArgs);
+        ffArenaFree(nullArgs, sizeof(FFformatarg) * numFormatArgs);
         ffStrbufDestroy(&error);
     }
 
     va_end(arguments);
 }
 
-void ffPrintFormatString(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments)
+void ffPrintFormatString(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey, const FFformat* format, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments)
 {
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+    {
+        ffPrintJsonResult(instance, moduleName, moduleIndex, numArgs, arguments);
+        return;
+    }
+
     FFstrbuf buffer;
     ffStrbufInitA(&buffer, 256);
 
-    ffParseFormatString(&buffer, formatString, error, numArgs, arguments);
+    ffFormatRender(&buffer, format, error, numArgs, arguments);
 
     if(buffer.length > 0)
     {
-        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKeyFormat);
-        ffStrbufPutTo(&buffer, stdout);
+        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKey);
+        ffOutputPut(instance, &buffer);
     }
 
     ffStrbufDestroy(&buffer);
@@ -114,7 +135,7 @@ void ffWriteCacheFile(FFinstance* instance, const char* moduleName, const char*
     ffStrbufDestroy(&path);
 }
 
-static bool printCachedValue(FFinstance* instance, const char* moduleName, const FFstrbuf* customKeyFormat)
+static bool printCachedValue(FFinstance* instance, const char* moduleName, const FFformat* customKey)
 {
     FFstrbuf content;
     ffStrbufInitA(&content, 512);
@@ -132,8 +153,8 @@ static bool printCachedValue(FFinstance* instance, const char* moduleName, const
     {
         uint32_t nullByteIndex = ffStrbufNextIndexC(&content, startIndex, '\0');
         uint8_t moduleIndex = (moduleCounter == 1 && nullByteIndex == content.length) ? 0 : moduleCounter;
-        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKeyFormat);
-        puts(content.chars + startIndex);
+        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKey);
+        ffOutputPutS(instance, content.chars + startIndex);
         startIndex = nullByteIndex + 1;
         ++moduleCounter;
     }
@@ -143,7 +164,7 @@ static bool printCachedValue(FFinstance* instance, const char* moduleName, const
     return moduleCounter > 1;
 }
 
-static bool printCachedFormat(FFinstance* instance, const char* moduleName, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, uint32_t numArgs)
+static bool printCachedFormat(FFinstance* instance, const char* moduleName, const FFformat* customKey, const FFformat* format, uint32_t numArgs)
 {
     FFstrbuf content;
     ffStrbufInitA(&content, 512);
@@ -152,14 +173,26 @@ static bool printCachedFormat(FFinstance* instance, const char* moduleName, cons
     ffStrbufTrimRight(&content, '\0'); //Strbuf always appends a '\0' at the end. We want the last null byte to be at the position of the length
 
     if(content.length == 0)
+    {
+        ffStrbufDestroy(&content);
         return false;
+    }
+
+    //The first value are the args which were detected. If the format needs one which was skipped, we must detect it again
+    uint64_t cachedArgs = strtoull(content.chars, NULL, 16);
+    uint64_t usedArgs = ffOutputGetUsedArgs(instance, format);
+    if((cachedArgs & usedArgs) != usedArgs)
+    {
+        ffStrbufDestroy(&content);
+        return false;
+    }
 
     uint8_t moduleCounter = 1;
 
-    FFformatarg* arguments = calloc(numArgs, sizeof(FFformatarg));
+    FFformatarg* arguments = ffArenaAlloc(sizeof(FFformatarg) * numArgs);
     uint32_t argumentCounter = 0;
 
-    uint32_t startIndex = 0;
+    uint32_t startIndex = ffStrbufFirstIndexC(&content, '\0') + 1;
     while(startIndex < content.length)
     {
         arguments[argumentCounter].type = FF_FORMAT_ARG_TYPE_STRING;
@@ -171,7 +204,7 @@ static bool printCachedFormat(FFinstance* instance, const char* moduleName, cons
         if(argumentCounter == numArgs)
         {
             uint8_t moduleIndex = (moduleCounter == 1 && nullByteIndex == content.length) ? 0 : moduleCounter;
-            ffPrintFormatString(instance, moduleName, moduleIndex, customKeyFormat, formatString, NULL, numArgs, arguments);
+            ffPrintFormatString(instance, moduleName, moduleIndex, customKey, format, NULL, numArgs, arguments);
             ++moduleCounter;
             argumentCounter = 0;
         }
@@ -179,33 +212,34 @@ static bool printCachedFormat(FFinstance* instance, const char* moduleName, cons
         startIndex = nullByteIndex + 1;
     }
 
-    free(arguments);
+    ffArenaFree(arguments, sizeof(FFformatarg) * numArgs);
     ffStrbufDestroy(&content);
 
     return moduleCounter > 1;
 }
 
-bool ffPrintFromCache(FFinstance* instance, const char* moduleName, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, uint32_t numArgs)
+bool ffPrintFromCache(FFinstance* instance, const char* moduleName, const FFformat* customKey, const FFformat* format, uint32_t numArgs)
 {
-    if(instance->config.recache)
+    //The cache only stores strings, JSON output needs the typed values
+    if(instance->config.recache || instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
         return false;
 
-    if(formatString == NULL || formatString->length == 0)
-        return printCachedValue(instance, moduleName, customKeyFormat);
+    if(format == NULL)
+        return printCachedValue(instance, moduleName, customKey);
     else
-        return printCachedFormat(instance, moduleName, customKeyFormat, formatString, numArgs);
+        return printCachedFormat(instance, moduleName, customKey, format, numArgs);
 }
 
-void ffPrintAndAppendToCache(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat, FFcache* cache, const FFstrbuf* value, const FFstrbuf* formatString, uint32_t numArgs, const FFformatarg* arguments)
+void ffPrintAndAppendToCache(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey, FFcache* cache, const FFstrbuf* value, const FFformat* format, uint32_t numArgs, const FFformatarg* arguments)
 {
-    if(formatString == NULL || formatString->length == 0)
+    if(ffOutputIsDefault(instance, format))
     {
-        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKeyFormat);
-        ffStrbufPutTo(value, stdout);
+        ffPrintLogoAndKey(instance, moduleName, moduleIndex, customKey);
+        ffOutputPut(instance, value);
     }
     else
     {
-        ffPrintFormatString(instance, moduleName, moduleIndex, customKeyFormat, formatString, NULL, numArgs, arguments);
+        ffPrintFormatString(instance, moduleName, moduleIndex, customKey, format, NULL, numArgs, arguments);
     }
 
     if(cache->value != NULL)
@@ -217,6 +251,12 @@ void ffPrintAndAppendToCache(FFinstance* instance, const char* moduleName, uint8
     if(cache->split == NULL)
         return;
 
+    if(ftell(cache->split) == 0)
+    {
+        fprintf(cache->split, "%llx", (unsigned long long) cache->args);
+        fputc('\0', cache->split);
+    }
+
     for(uint32_t i = 0; i < numArgs; i++)
     {
         FFstrbuf buffer;
@@ -228,11 +268,25 @@ void ffPrintAndAppendToCache(FFinstance* instance, const char* moduleName, uint8
     }
 }
 
-void ffPrintAndSaveToCache(FFinstance* instance, const char* moduleName, const FFstrbuf* customKeyFormat, const FFstrbuf* value, const FFstrbuf* formatString, uint32_t numArgs, const FFformatarg* arguments)
+bool ffOutputIsDefault(const FFinstance* instance, const FFformat* format)
+{
+    return format == NULL && instance->config.outputFormat != FF_OUTPUT_FORMAT_JSON;
+}
+
+uint64_t ffOutputGetUsedArgs(const FFinstance* instance, const FFformat* format)
+{
+    //JSON output prints every arg, regardless of the format string
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        return UINT64_MAX;
+
+    return format == NULL ? 0 : format->usedArgs;
+}
+
+void ffPrintAndSaveToCache(FFinstance* instance, const char* moduleName, const FFformat* customKey, const FFstrbuf* value, const FFformat* format, uint32_t numArgs, const FFformatarg* arguments)
 {
     FFcache cache;
     ffCacheOpenWrite(instance, moduleName, &cache);
-    ffPrintAndAppendToCache(instance, moduleName, 0, customKeyFormat, &cache, value, formatString, numArgs, arguments);
+    ffPrintAndAppendToCache(instance, moduleName, 0, customKey, &cache, value, format, numArgs, arguments);
     ffCacheClose(&cache);
 }
 
@@ -278,6 +332,8 @@ void ffCacheOpenWrite(FFinstance* instance, const char* moduleName, FFcache* cac
     ffGetCacheFilePath(instance, moduleName, FF_IO_CACHE_SPLIT_EXTENSION, &cacheFileSplit);
     cache->split = fopen(cacheFileSplit.chars, "w");
     ffStrbufDestroy(&cacheFileSplit);
+
+    cache->args = UINT64_MAX;
 }
 
 void ffCacheClose(FFcache* cache)
@@ -291,28 +347,28 @@ void ffCacheClose(FFcache* cache)
 
 bool ffParsePropFileValues(const char* filename, uint32_t numQueries, FFpropquery* queries)
 {
-    bool* searchedValues = malloc(sizeof(bool) * numQueries);
     bool allSet = true;
     for(uint32_t i = 0; i < numQueries; i++)
     {
-        if((searchedValues[i] = queries[i].buffer->length == 0))
+        if(queries[i].buffer->length == 0)
             allSet = false;
     }
 
     if(allSet)
-    {
-        free(searchedValues);
         return true;
-    }
 
-    FILE* file = fopen(filename, "r");
-    if(file == NULL)
+    const FFstrbuf* content = ffReadFileCached(filename);
+    if(content == NULL)
         return false;
 
-    char* line = NULL;
-    size_t len = 0;
+    //Queries that already had a value are skipped
+    bool* searchedValues = ffArenaAlloc(sizeof(bool) * numQueries);
+    for(uint32_t i = 0; i < numQueries; i++)
+        searchedValues[i] = queries[i].buffer->length == 0;
 
-    while (getline(&line, &len, file) != -1)
+    //ffGetPropValue stops at the end of the line, so we can parse the shared content in place
+    const char* line = content->chars;
+    while(*line != '\0')
     {
         for(uint32_t i = 0; i < numQueries; i++)
         {
@@ -324,14 +380,14 @@ bool ffParsePropFileValues(const char* filename, uint32_t numQueries, FFpropquer
             if(!ffGetPropValue(line, queries[i].start, queries[i].buffer))
                 queries[i].buffer->length = currentLength;
         }
-    }
-
-    free(searchedValues);
 
-    if(line != NULL)
-        free(line);
+        line = strchr(line, '\n');
+        if(line == NULL)
+            break;
+        ++line;
+    }
 
-    fclose(file);
+    ffArenaFree(searchedValues, sizeof(bool) * numQueries);
 
     return true;
 }
@@ -365,21 +421,22 @@ bool ffParsePropFileConfigValues(const FFinstance* instance, const char* relativ
 {
     bool foundAFile = false;
 
-    for(uint32_t i = 0; i < instance->state.configDirs.length; i++)
+    //Detection threads parse config files in parallel, so we must not modify the shared config dirs
+    FFstrbuf absolutePath;
+    ffStrbufInitA(&absolutePath, 64);
+
+    FF_LIST_FOR_EACH(FFstrbuf, baseDir, &instance->state.configDirs)
     {
-        FFstrbuf* baseDir = (FFstrbuf*) ffListGet(&instance->state.configDirs, i);
-        uint32_t baseDirLength = baseDir->length;
+        ffStrbufSet(&absolutePath, baseDir);
 
         if(*relativeFile != '/')
-            ffStrbufAppendC(baseDir, '/');
+            ffStrbufAppendC(&absolutePath, '/');
 
-        ffStrbufAppendS(baseDir, relativeFile);
+        ffStrbufAppendS(&absolutePath, relativeFile);
 
-        if(ffParsePropFileValues(baseDir->chars, numQueries, queries))
+        if(ffParsePropFileValues(absolutePath.chars, numQueries, queries))
             foundAFile = true;
 
-        ffStrbufSubstrBefore(baseDir, baseDirLength);
-
         bool allSet = true;
         for(uint32_t k = 0; k < numQueries; k++)
         {
@@ -394,6 +451,8 @@ bool ffParsePropFileConfigValues(const FFinstance* instance, const char* relativ
             break;
     }
 
+    ffStrbufDestroy(&absolutePath);
+
     return foundAFile;
 }
 
@@ -409,7 +468,7 @@ bool ffWriteFDContent(int fd, const FFstrbuf* content)
 
 void ffWriteFileContent(const char* fileName, const FFstrbuf* content)
 {
-    int fd = open(fileName, O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    int fd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
     if(fd == -1)
         return;
 
@@ -462,40 +521,133 @@ bool ffGetFileContent(const char* fileName, FFstrbuf* buffer)
     return ffAppendFileContent(fileName, buffer);
 }
 
-// Not thread safe!
+uint32_t ffReadFileAt(int dirfd, const char* fileName, char* buffer, uint32_t size)
+{
+    int fd = openat(dirfd, fileName, O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        return 0;
+
+    ssize_t length = read(fd, buffer, size - 1);
+    close(fd);
+
+    if(length <= 0)
+        return 0;
+
+    buffer[length] = '\0';
+    return (uint32_t) length;
+}
+
+bool ffReadUIntAt(int dirfd, const char* fileName, int base, uint32_t* value)
+{
+    char buffer[32];
+    if(ffReadFileAt(dirfd, fileName, buffer, sizeof(buffer)) == 0)
+        return false;
+
+    char* end;
+    unsigned long result = strtoul(buffer, &end, base);
+    if(end == buffer)
+        return false;
+
+    *value = (uint32_t) result;
+    return true;
+}
+
+typedef struct FFFileCacheEntry
+{
+    struct FFFileCacheEntry* next;
+    bool loaded;
+    bool exists;
+    FFstrbuf content;
+    char path[];
+} FFFileCacheEntry;
+
+static pthread_mutex_t fileCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fileCacheCond = PTHREAD_COND_INITIALIZER;
+static FFFileCacheEntry* fileCache = NULL;
+
+const FFstrbuf* ffReadFileCached(const char* fileName)
+{
+    pthread_mutex_lock(&fileCacheMutex);
+
+    FFFileCacheEntry* entry = fileCache;
+    while(entry != NULL && strcmp(entry->path, fileName) != 0)
+        entry = entry->next;
+
+    if(entry != NULL)
+    {
+        //Another thread is currently reading the file, wait for it instead of reading it twice
+        while(!entry->loaded)
+            pthread_cond_wait(&fileCacheCond, &fileCacheMutex);
+
+        pthread_mutex_unlock(&fileCacheMutex);
+        return entry->exists ? &entry->content : NULL;
+    }
+
+    size_t pathLength = strlen(fileName);
+    //Entries live until the end of the run
+    entry = ffArenaAlloc(sizeof(FFFileCacheEntry) + pathLength + 1);
+    memcpy(entry->path, fileName, pathLength + 1);
+    entry->loaded = false;
+    entry->exists = false;
+    ffStrbufInit(&entry->content);
+    entry->next = fileCache;
+    fileCache = entry;
+
+    pthread_mutex_unlock(&fileCacheMutex);
+
+    //Read without holding the lock, so other files can be looked up in the meantime
+    bool exists = ffAppendFileContent(fileName, &entry->content);
+
+    pthread_mutex_lock(&fileCacheMutex);
+    entry->exists = exists;
+    entry->loaded = true;
+    pthread_cond_broadcast(&fileCacheCond);
+    pthread_mutex_unlock(&fileCacheMutex);
+
+    return exists ? &entry->content : NULL;
+}
+
 void ffSuppressIO(bool suppress)
 {
-    static bool init = false;
+    static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    static uint32_t suppressCount = 0;
     static int origOut = -1;
     static int origErr = -1;
     static int nullFile = -1;
 
-    if(!init)
+    pthread_mutex_lock(&mutex);
+
+    //Only the first caller replaces the fds, and only the last one restores them
+    if(suppress ? suppressCount++ > 0 : (suppressCount == 0 || --suppressCount > 0))
     {
-        if(!suppress)
-            return;
+        pthread_mutex_unlock(&mutex);
+        return;
+    }
 
+    if(nullFile == -1)
+    {
         origOut = dup(STDOUT_FILENO);
         origErr = dup(STDERR_FILENO);
         nullFile = open("/dev/null", O_WRONLY);
-        init = true;
     }
 
-    if(nullFile == -1)
-        return;
+    if(nullFile != -1)
+    {
+        fflush(stdout);
+        fflush(stderr);
 
-    fflush(stdout);
-    fflush(stderr);
+        dup2(suppress ? nullFile : origOut, STDOUT_FILENO);
+        dup2(suppress ? nullFile : origErr, STDERR_FILENO);
+    }
 
-    dup2(suppress ? nullFile : origOut, STDOUT_FILENO);
-    dup2(suppress ? nullFile : origErr, STDERR_FILENO);
+    pthread_mutex_unlock(&mutex);
 }
 
-void ffPrintColor(const FFstrbuf* colorValue)
+void ffPrintColor(FFinstance* instance, const FFstrbuf* colorValue)
 {
-    fputs("\033[", stdout);
-    ffStrbufWriteTo(colorValue, stdout);
-    fputc('m', stdout);
+    ffOutputWriteS(instance, "\033[");
+    ffOutputWrite(instance, colorValue);
+    ffOutputWriteC(instance, 'm');
 }
 
 bool ffFileExists(const char* fileName, mode_t mode)
@@ -0,0 +1,208 @@
+#include "fastfetch.h"
+
+#include <math.h>
+
+//Length of the UTF-8 sequence value starts with, 0 if it isn't valid.
+//Overlong encodings, surrogates and code points above U+10FFFF are invalid. The terminating NUL is never a continuation byte
+static uint32_t getUtf8SequenceLength(const unsigned char* value)
+{
+    uint32_t length;
+    unsigned char min = 0x80, max = 0xBF; //Range of the second byte
+
+    if(value[0] >= 0xC2 && value[0] <= 0xDF)
+        length = 2;
+    else if(value[0] >= 0xE0 && value[0] <= 0xEF)
+    {
+        length = 3;
+        if(value[0] == 0xE0)
+            min = 0xA0;
+        else if(value[0] == 0xED)
+            max = 0x9F;
+    }
+    else if(value[0] >= 0xF0 && value[0] <= 0xF4)
+    {
+        length = 4;
+        if(value[0] == 0xF0)
+            min = 0x90;
+        else if(value[0] == 0xF4)
+            max = 0x8F;
+    }
+    else
+        return 0;
+
+    if(value[1] < min || value[1] > max)
+        return 0;
+
+    for(uint32_t i = 2; i < length; ++i)
+    {
+        if(value[i] < 0x80 || value[i] > 0xBF)
+            return 0;
+    }
+
+    return length;
+}
+
+void ffJsonAppendString(FFstrbuf* buffer, const char* value)
+{
+    ffStrbufAppendC(buffer, '"');
+
+    while(*value != '\0')
+    {
+        char c = *value;
+
+        if(c == '"' || c == '\\')
+        {
+            ffStrbufAppendC(buffer, '\\');
+            ffStrbufAppendC(buffer, c);
+        }
+        else if(c == '\n')
+            ffStrbufAppendS(buffer, "\\n");
+        else if(c == '\t')
+            ffStrbufAppendS(buffer, "\\t");
+        else if((unsigned char) c < 0x20)
+            ffStrbufAppendF(buffer, "\\u%04x", (unsigned) c);
+        else if((unsigned char) c >= 0x80)
+        {
+            //Values like file system labels or song titles are raw bytes. Invalid UTF-8 would make the whole output invalid JSON
+            uint32_t length = getUtf8SequenceLength((const unsigned char*) value);
+            if(length == 0)
+                ffStrbufAppendS(buffer, "\\uFFFD");
+            else
+            {
+                ffStrbufAppendNS(buffer, length, value);
+                value += length;
+                continue;
+            }
+        }
+        else
+            ffStrbufAppendC(buffer, c);
+
+        ++value;
+    }
+
+    ffStrbufAppendC(buffer, '"');
+}
+
+static void appendDouble(FFstrbuf* buffer, double value)
+{
+    //JSON has no representation for them
+    if(isnan(value) || isinf(value))
+        ffStrbufAppendS(buffer, "null");
+    else
+        ffStrbufAppendDouble(buffer, value);
+}
+
+void ffJsonAppendFormatArg(FFstrbuf* buffer, const FFformatarg* formatarg)
+{
+    if(formatarg->type == FF_FORMAT_ARG_TYPE_INT)
+        ffStrbufAppendInt(buffer, *(int*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT)
+        ffStrbufAppendUInt(buffer, *(uint32_t*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT64)
+        ffStrbufAppendUInt(buffer, *(uint64_t*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT16)
+        ffStrbufAppendUInt(buffer, *(uint16_t*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_UINT8)
+        ffStrbufAppendUInt(buffer, *(uint8_t*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_STRING)
+        ffJsonAppendString(buffer, (const char*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_STRBUF)
+        ffJsonAppendString(buffer, ((const FFstrbuf*)formatarg->value)->chars);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_DOUBLE)
+        appendDouble(buffer, *(double*)formatarg->value);
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_LIST)
+    {
+        const FFlist* list = formatarg->value;
+        ffStrbufAppendC(buffer, '[');
+        for(uint32_t i = 0; i < list->length; i++)
+        {
+            if(i > 0)
+                ffStrbufAppendC(buffer, ',');
+            ffJsonAppendString(buffer, FF_LIST_GET(const FFstrbuf, list, i)->chars);
+        }
+        ffStrbufAppendC(buffer, ']');
+    }
+    else if(formatarg->type == FF_FORMAT_ARG_TYPE_DOUBLE_LIST)
+    {
+        const FFlist* list = formatarg->value;
+        ffStrbufAppendC(buffer, '[');
+        for(uint32_t i = 0; i < list->length; i++)
+        {
+            if(i > 0)
+                ffStrbufAppendC(buffer, ',');
+            appendDouble(buffer, *FF_LIST_GET(const double, list, i));
+        }
+        ffStrbufAppendC(buffer, ']');
+    }
+    else
+        ffStrbufAppendS(buffer, "null");
+}
+
+void ffPrintJsonStart(FFinstance* instance)
+{
+    instance->state.jsonResults = 0;
+    ffOutputWriteC(instance, '[');
+}
+
+//Starts a new object in the array, with the members every object has
+static void appendObjectStart(FFinstance* instance, FFstrbuf* buffer, const char* moduleName, uint8_t moduleIndex)
+{
+    ffStrbufAppendS(buffer, instance->state.jsonResults > 0 ? ",\n  {\"type\":" : "\n  {\"type\":");
+    ffJsonAppendString(buffer, moduleName);
+
+    if(moduleIndex > 0)
+    {
+        ffStrbufAppendS(buffer, ",\"index\":");
+        ffStrbufAppendUInt(buffer, moduleIndex);
+    }
+
+    ++instance->state.jsonResults;
+}
+
+void ffPrintJsonResult(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, uint32_t numArgs, const FFformatarg* arguments)
+{
+    FFstrbuf buffer;
+    ffStrbufInitA(&buffer, 256);
+
+    appendObjectStart(instance, &buffer, moduleName, moduleIndex);
+    ffStrbufAppendS(&buffer, ",\"result\":[");
+
+    for(uint32_t i = 0; i < numArgs; i++)
+    {
+        if(i > 0)
+            ffStrbufAppendC(&buffer, ',');
+        ffJsonAppendFormatArg(&buffer, &arguments[i]);
+    }
+
+    ffStrbufAppendS(&buffer, "]}");
+
+    //Write every object at once, so a consumer never sees half of it
+    ffOutputWrite(instance, &buffer);
+    ffOutputFlush(instance);
+    ffStrbufDestroy(&buffer);
+}
+
+void ffPrintJsonError(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const char* message, va_list arguments)
+{
+    FF_STRBUF_CREATE(error);
+    ffStrbufAppendVF(&error, message, arguments);
+
+    FFstrbuf buffer;
+    ffStrbufInitA(&buffer, 128);
+
+    appendObjectStart(instance, &buffer, moduleName, moduleIndex);
+    ffStrbufAppendS(&buffer, ",\"error\":");
+    ffJsonAppendString(&buffer, error.chars);
+    ffStrbufAppendC(&buffer, '}');
+
+    ffOutputWrite(instance, &buffer);
+    ffOutputFlush(instance);
+
+    ffStrbufDestroy(&buffer);
+    ffStrbufDestroy(&error);
+}
+
+void ffPrintJsonFinish(FFinstance* instance)
+{
+    ffOutputWriteS(instance, instance->state.jsonResults > 0 ? "\n]\n" : "]\n");
+}
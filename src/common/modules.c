@@ -0,0 +1,20 @@
+#include "fastfetch.h"
+
+#include <strings.h>
+
+//Generated at build time from modules/list.h by modules/generator.c
+#include "fastfetch_modules.h"
+
+#define FF_MODULE(id, name, alias, option, print, detectors, cache, numFormatArgs) { FF_MODULE_ID_ ## id, name, alias, print, detectors, FF_MODULE_CACHE_ ## cache, numFormatArgs },
+const FFmodule ffModules[FF_MODULE_ID_COUNT] = { FF_MODULE_LIST };
+#undef FF_MODULE
+
+const FFmodule* ffGetModule(const char* name)
+{
+    uint32_t slot = ffPerfectHashGetSlot(name, moduleNameDisplacements, FF_MODULE_NAME_TABLE_SIZE);
+
+    if(moduleNameTable[slot].name == NULL || strcasecmp(moduleNameTable[slot].name, name) != 0)
+        return NULL;
+
+    return &ffModules[moduleNameTable[slot].value];
+}
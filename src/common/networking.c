@@ -1,69 +1,551 @@
 #include "fastfetch.h"
 
-#include <sys/types.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <poll.h>
+#include <pthread.h>
 #include <unistd.h>
+#include <sys/types.h>
 #include <sys/socket.h>
 #include <netdb.h>
 
-void ffNetworkingGetHttp(const char* host, const char* path, uint32_t timeout, FFstrbuf* buffer)
+#define FF_NETWORKING_MAX_ENDPOINTS 16
+#define FF_NETWORKING_MAX_RESPONSE_SIZE (64 * 1024)
+
+// getaddrinfo can't be cancelled, so every endpoint is resolved in its own detached thread.
+// The threads notify the caller through a pipe, which is polled together with the sockets.
+// The context is reference counted, so threads that outlive the deadline clean up after themselves.
+typedef struct FFResolveContext FFResolveContext;
+
+typedef struct FFResolveJob
+{
+    FFResolveContext* context;
+    char host[256];
+    char port[8];
+    bool done;
+    bool consumed;
+    struct addrinfo* result;
+} FFResolveJob;
+
+struct FFResolveContext
+{
+    pthread_mutex_t mutex;
+    uint32_t references;
+    int pipefds[2];
+    uint32_t numJobs;
+    FFResolveJob jobs[FF_NETWORKING_MAX_ENDPOINTS];
+};
+
+typedef enum FFConnectionState
+{
+    FF_CONNECTION_STATE_CONNECTING,
+    FF_CONNECTION_STATE_SENDING,
+    FF_CONNECTION_STATE_RECEIVING
+} FFConnectionState;
+
+typedef struct FFConnection
+{
+    int sock;
+    FFConnectionState state;
+    uint32_t endpoint;
+    uint32_t sent;
+    FFstrbuf response;
+} FFConnection;
+
+typedef enum FFResponseStatus
+{
+    FF_RESPONSE_STATUS_INCOMPLETE,
+    FF_RESPONSE_STATUS_COMPLETE,
+    FF_RESPONSE_STATUS_INVALID
+} FFResponseStatus;
+
+static void releaseResolveContext(FFResolveContext* context)
+{
+    pthread_mutex_lock(&context->mutex);
+    uint32_t references = --context->references;
+    pthread_mutex_unlock(&context->mutex);
+
+    if(references > 0)
+        return;
+
+    for(uint32_t i = 0; i < context->numJobs; i++)
+    {
+        if(context->jobs[i].result != NULL)
+            freeaddrinfo(context->jobs[i].result);
+    }
+
+    close(context->pipefds[0]);
+    close(context->pipefds[1]);
+    pthread_mutex_destroy(&context->mutex);
+    free(context);
+}
+
+static void resolve(FFResolveJob* job)
 {
     struct addrinfo hints = {0};
-    hints.ai_family = AF_INET;
+    hints.ai_family = AF_UNSPEC;
     hints.ai_socktype = SOCK_STREAM;
     hints.ai_protocol = 0;
 
-    struct addrinfo* addr;
+    struct addrinfo* result = NULL;
+    if(getaddrinfo(job->host, job->port, &hints, &result) != 0)
+        result = NULL;
 
-    if(getaddrinfo(host, "80", &hints, &addr) != 0)
-        return;
+    pthread_mutex_lock(&job->context->mutex);
+    job->result = result;
+    job->done = true;
+    pthread_mutex_unlock(&job->context->mutex);
+
+    char c = 0;
+    ssize_t written = write(job->context->pipefds[1], &c, 1);
+    FF_UNUSED(written);
+}
+
+static void* resolveThreadMain(void* arg)
+{
+    FFResolveJob* job = arg;
+    resolve(job);
+    releaseResolveContext(job->context);
+    return NULL;
+}
+
+static uint64_t getTimeMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+// Splits "host[:port][/path]" into its parts. IPv6 literals must be written in brackets, e.g. "[::1]:8080/ip"
+static bool parseEndpoint(const char* url, FFResolveJob* job, FFstrbuf* path)
+{
+    if(strncasecmp(url, "http://", 7) == 0)
+        url += 7;
+
+    const char* hostStart = url;
+    const char* hostEnd;
+    const char* rest;
+
+    if(*url == '[')
+    {
+        hostStart = url + 1;
+        hostEnd = strchr(hostStart, ']');
+        if(hostEnd == NULL)
+            return false;
+        rest = hostEnd + 1;
+    }
+    else
+    {
+        hostEnd = url + strcspn(url, ":/");
+        rest = hostEnd;
+    }
+
+    size_t hostLength = (size_t) (hostEnd - hostStart);
+    if(hostLength == 0 || hostLength >= sizeof(job->host))
+        return false;
+
+    memcpy(job->host, hostStart, hostLength);
+    job->host[hostLength] = '\0';
+
+    if(*rest == ':')
+    {
+        ++rest;
+        size_t portLength = strspn(rest, "0123456789");
+        if(portLength == 0 || portLength >= sizeof(job->port))
+            return false;
+        memcpy(job->port, rest, portLength);
+        job->port[portLength] = '\0';
+        rest += portLength;
+    }
+    else
+        strcpy(job->port, "80");
+
+    if(*rest != '\0' && *rest != '/')
+        return false;
+
+    ffStrbufSetS(path, *rest == '\0' ? "/" : rest);
+    return true;
+}
+
+static void buildRequest(FFstrbuf* request, const FFResolveJob* job, const FFstrbuf* path)
+{
+    ffStrbufAppendS(request, "GET ");
+    ffStrbufAppend(request, path);
+    ffStrbufAppendS(request, " HTTP/1.1\r\nHost: ");
+    if(strchr(job->host, ':') != NULL)
+    {
+        ffStrbufAppendC(request, '[');
+        ffStrbufAppendS(request, job->host);
+        ffStrbufAppendC(request, ']');
+    }
+    else
+        ffStrbufAppendS(request, job->host);
+    if(strcmp(job->port, "80") != 0)
+    {
+        ffStrbufAppendC(request, ':');
+        ffStrbufAppendS(request, job->port);
+    }
+    ffStrbufAppendS(request, "\r\nUser-Agent: fastfetch/" FASTFETCH_PROJECT_VERSION "\r\nAccept: */*\r\nConnection: close\r\n\r\n");
+}
+
+// Returns the value of the given header, or NULL. headers points after the status line, end to the empty line.
+static const char* findHeader(const char* headers, const char* end, const char* name, size_t* valueLength)
+{
+    size_t nameLength = strlen(name);
+
+    while(headers < end)
+    {
+        const char* lineEnd = strstr(headers, "\r\n");
+        if(lineEnd == NULL || lineEnd > end)
+            lineEnd = end;
+
+        if((size_t) (lineEnd - headers) > nameLength && headers[nameLength] == ':' && strncasecmp(headers, name, nameLength) == 0)
+        {
+            const char* value = headers + nameLength + 1;
+            while(value < lineEnd && (*value == ' ' || *value == '\t'))
+                ++value;
+            *valueLength = (size_t) (lineEnd - value);
+            return value;
+        }
+
+        headers = lineEnd + 2;
+    }
+
+    return NULL;
+}
+
+static FFResponseStatus decodeChunked(const char* data, const char* end, FFstrbuf* body)
+{
+    while(data < end)
+    {
+        char* sizeEnd;
+        unsigned long size = strtoul(data, &sizeEnd, 16);
+        if(sizeEnd == data)
+            return FF_RESPONSE_STATUS_INVALID;
+
+        const char* chunk = strstr(sizeEnd, "\r\n");
+        if(chunk == NULL || chunk >= end)
+            return FF_RESPONSE_STATUS_INCOMPLETE;
+        chunk += 2;
+
+        if(size == 0)
+            return FF_RESPONSE_STATUS_COMPLETE; // Trailers are ignored
+
+        if(size > (unsigned long) (end - chunk) || (unsigned long) (end - chunk) - size < 2)
+            return FF_RESPONSE_STATUS_INCOMPLETE;
+
+        ffStrbufAppendNS(body, (uint32_t) size, chunk);
+        data = chunk + size + 2;
+    }
+
+    return FF_RESPONSE_STATUS_INCOMPLETE;
+}
+
+// Checks if the response received so far is complete. If it is, body is set to the decoded body.
+static FFResponseStatus parseResponse(const FFstrbuf* response, bool eof, FFstrbuf* body)
+{
+    const char* headerEnd = strstr(response->chars, "\r\n\r\n");
+    if(headerEnd == NULL)
+        return eof ? FF_RESPONSE_STATUS_INVALID : FF_RESPONSE_STATUS_INCOMPLETE;
+
+    unsigned status;
+    if(sscanf(response->chars, "HTTP/%*u.%*u %u", &status) != 1 || status < 200 || status > 299)
+        return FF_RESPONSE_STATUS_INVALID;
 
-    int sock = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+    const char* headers = strstr(response->chars, "\r\n") + 2;
+    const char* data = headerEnd + 4;
+    const char* end = response->chars + response->length;
+
+    ffStrbufClear(body);
+
+    size_t valueLength;
+    const char* value = findHeader(headers, headerEnd, "Transfer-Encoding", &valueLength);
+    if(value != NULL && valueLength >= 7 && strncasecmp(value, "chunked", 7) == 0)
+    {
+        FFResponseStatus result = decodeChunked(data, end, body);
+        return result == FF_RESPONSE_STATUS_INCOMPLETE && eof ? FF_RESPONSE_STATUS_INVALID : result;
+    }
+
+    value = findHeader(headers, headerEnd, "Content-Length", &valueLength);
+    if(value != NULL)
+    {
+        unsigned long length = strtoul(value, NULL, 10);
+        if((unsigned long) (end - data) < length)
+            return eof ? FF_RESPONSE_STATUS_INVALID : FF_RESPONSE_STATUS_INCOMPLETE;
+        ffStrbufAppendNS(body, (uint32_t) length, data);
+        return FF_RESPONSE_STATUS_COMPLETE;
+    }
+
+    // No length information, the body ends when the server closes the connection
+    if(!eof)
+        return FF_RESPONSE_STATUS_INCOMPLETE;
+
+    ffStrbufAppendNS(body, (uint32_t) (end - data), data);
+    return FF_RESPONSE_STATUS_COMPLETE;
+}
+
+static void startConnection(FFlist* connections, const struct addrinfo* addr, uint32_t endpoint)
+{
+    int sock = socket(addr->ai_family, addr->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, addr->ai_protocol);
     if(sock == -1)
+        return;
+
+    if(connect(sock, addr->ai_addr, addr->ai_addrlen) == -1 && errno != EINPROGRESS)
     {
-        freeaddrinfo(addr);
+        close(sock);
         return;
     }
 
-    if(timeout > 0)
+    FFConnection* connection = ffListAdd(connections);
+    connection->sock = sock;
+    connection->state = FF_CONNECTION_STATE_CONNECTING;
+    connection->endpoint = endpoint;
+    connection->sent = 0;
+    ffStrbufInitA(&connection->response, 1024);
+}
+
+// Connects to the first IPv4 and the first IPv6 address of the endpoint, whichever is faster wins
+static void startConnections(FFlist* connections, const struct addrinfo* result, uint32_t endpoint)
+{
+    bool startedIpv4 = false;
+    bool startedIpv6 = false;
+
+    for(const struct addrinfo* addr = result; addr != NULL; addr = addr->ai_next)
     {
-        struct timeval timev;
-        timev.tv_sec = 0;
-        timev.tv_usec = timeout * 1000; //milliseconds to microseconds
-        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timev, sizeof(timev));
+        if(addr->ai_family == AF_INET && !startedIpv4)
+        {
+            startedIpv4 = true;
+            startConnection(connections, addr, endpoint);
+        }
+        else if(addr->ai_family == AF_INET6 && !startedIpv6)
+        {
+            startedIpv6 = true;
+            startConnection(connections, addr, endpoint);
+        }
     }
+}
 
-    if(connect(sock, addr->ai_addr, addr->ai_addrlen) == -1)
+static void closeConnection(FFlist* connections, uint32_t index)
+{
+    FFConnection* connection = ffListGet(connections, index);
+    close(connection->sock);
+    ffStrbufDestroy(&connection->response);
+
+    //Move the last connection into the free slot
+    --connections->length;
+    if(index < connections->length)
+        memcpy(connection, ffListGet(connections, connections->length), sizeof(FFConnection));
+}
+
+// Advances the connection after poll reported events. Returns false if it failed and must be closed.
+static bool handleConnection(FFConnection* connection, short revents, const FFstrbuf* request, FFstrbuf* buffer, bool* finished)
+{
+    if(connection->state == FF_CONNECTION_STATE_CONNECTING)
     {
-        close(sock);
-        freeaddrinfo(addr);
+        int error = 0;
+        socklen_t errorLength = sizeof(error);
+        if(getsockopt(connection->sock, SOL_SOCKET, SO_ERROR, &error, &errorLength) == -1 || error != 0)
+            return false;
+
+        connection->state = FF_CONNECTION_STATE_SENDING;
+    }
+
+    if(connection->state == FF_CONNECTION_STATE_SENDING)
+    {
+        ssize_t sent = send(connection->sock, request->chars + connection->sent, request->length - connection->sent, MSG_NOSIGNAL);
+        if(sent == -1)
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+
+        connection->sent += (uint32_t) sent;
+        if(connection->sent == request->length)
+            connection->state = FF_CONNECTION_STATE_RECEIVING;
+        return true;
+    }
+
+    if(!(revents & (POLLIN | POLLHUP | POLLERR)))
+        return true;
+
+    ffStrbufEnsureFree(&connection->response, 1024);
+    ssize_t received = recv(connection->sock, connection->response.chars + connection->response.length, ffStrbufGetFree(&connection->response), 0);
+    if(received == -1)
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+
+    connection->response.length += (uint32_t) received;
+    connection->response.chars[connection->response.length] = '\0';
+
+    if(connection->response.length > FF_NETWORKING_MAX_RESPONSE_SIZE)
+        return false;
+
+    FFstrbuf body;
+    ffStrbufInit(&body);
+    FFResponseStatus status = parseResponse(&connection->response, received == 0, &body);
+
+    if(status == FF_RESPONSE_STATUS_COMPLETE && body.length > 0)
+    {
+        ffStrbufAppend(buffer, &body);
+        *finished = true;
+    }
+
+    ffStrbufDestroy(&body);
+    return status == FF_RESPONSE_STATUS_INCOMPLETE;
+}
+
+void ffNetworkingGetHttpFirst(uint32_t numUrls, const char* const* urls, uint32_t timeout, FFstrbuf* buffer)
+{
+    if(numUrls > FF_NETWORKING_MAX_ENDPOINTS)
+        numUrls = FF_NETWORKING_MAX_ENDPOINTS;
+
+    uint64_t deadline = timeout > 0 ? getTimeMs() + timeout : 0;
+
+    FFResolveContext* context = calloc(1, sizeof(FFResolveContext));
+    if(pipe(context->pipefds) == -1)
+    {
+        free(context);
         return;
     }
+    for(int i = 0; i < 2; i++)
+    {
+        fcntl(context->pipefds[i], F_SETFL, O_NONBLOCK);
+        fcntl(context->pipefds[i], F_SETFD, FD_CLOEXEC);
+    }
+    pthread_mutex_init(&context->mutex, NULL);
+    context->references = 1;
 
-    freeaddrinfo(addr);
+    FFstrbuf requests[FF_NETWORKING_MAX_ENDPOINTS];
+    FFstrbuf path;
+    ffStrbufInit(&path);
 
-    FFstrbuf command;
-    ffStrbufInitA(&command, 64);
-    ffStrbufAppendS(&command, "GET ");
-    ffStrbufAppendS(&command, path);
-    ffStrbufAppendS(&command, " HTTP/1.1\nHost: ");
-    ffStrbufAppendS(&command, host);
-    ffStrbufAppendS(&command, "\r\n\r\n");
+    for(uint32_t i = 0; i < numUrls; i++)
+    {
+        FFResolveJob* job = &context->jobs[context->numJobs];
+        if(!parseEndpoint(urls[i], job, &path))
+            continue;
+
+        job->context = context;
+        ffStrbufInitA(&requests[context->numJobs], 128);
+        buildRequest(&requests[context->numJobs], job, &path);
+        ++context->numJobs;
+    }
 
-    if(send(sock, command.chars, command.length, 0) == -1)
+    ffStrbufDestroy(&path);
+
+    uint32_t numJobs = context->numJobs;
+    if(numJobs == 0)
     {
-        ffStrbufDestroy(&command);
-        close(sock);
+        releaseResolveContext(context);
         return;
     }
 
-    ssize_t received = recv(sock, buffer->chars + buffer->length, ffStrbufGetFree(buffer), 0);
+    for(uint32_t i = 0; i < numJobs; i++)
+    {
+        pthread_mutex_lock(&context->mutex);
+        ++context->references;
+        pthread_mutex_unlock(&context->mutex);
+
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, resolveThreadMain, &context->jobs[i]) == 0)
+            pthread_detach(thread);
+        else
+            resolveThreadMain(&context->jobs[i]);
+    }
+
+    FFlist connections;
+    ffListInitA(&connections, sizeof(FFConnection), numJobs * 2);
 
-    if(received > 0)
+    struct pollfd* pollfds = malloc(sizeof(struct pollfd) * (numJobs * 2 + 1));
+
+    uint32_t numResolved = 0;
+    bool finished = false;
+
+    while(!finished)
     {
-        buffer->length += (uint32_t) received;
-        buffer->chars[buffer->length] = '\0';
+        //Start connecting to every endpoint that got resolved since the last iteration
+        pthread_mutex_lock(&context->mutex);
+        for(uint32_t i = 0; i < numJobs; i++)
+        {
+            FFResolveJob* job = &context->jobs[i];
+            if(!job->done || job->consumed)
+                continue;
+
+            job->consumed = true;
+            ++numResolved;
+            if(job->result != NULL)
+                startConnections(&connections, job->result, i);
+        }
+        pthread_mutex_unlock(&context->mutex);
+
+        if(numResolved == numJobs && connections.length == 0)
+            break;
+
+        int pollTimeout = -1;
+        if(deadline > 0)
+        {
+            uint64_t now = getTimeMs();
+            if(now >= deadline)
+                break;
+            pollTimeout = (int) (deadline - now);
+        }
+
+        pollfds[0].fd = context->pipefds[0];
+        pollfds[0].events = POLLIN;
+        for(uint32_t i = 0; i < connections.length; i++)
+        {
+            FFConnection* connection = ffListGet(&connections, i);
+            pollfds[i + 1].fd = connection->sock;
+            pollfds[i + 1].events = connection->state == FF_CONNECTION_STATE_RECEIVING ? POLLIN : POLLOUT;
+            pollfds[i + 1].revents = 0;
+        }
+
+        int ready = poll(pollfds, connections.length + 1, pollTimeout);
+        if(ready == -1 && errno != EINTR)
+            break;
+        if(ready <= 0)
+            continue;
+
+        if(pollfds[0].revents & POLLIN)
+        {
+            char drain[FF_NETWORKING_MAX_ENDPOINTS];
+            while(read(context->pipefds[0], drain, sizeof(drain)) > 0);
+        }
+
+        //Iterate backwards, so closing a connection doesn't move one that wasn't handled yet
+        for(uint32_t i = connections.length; i > 0 && !finished; i--)
+        {
+            short revents = pollfds[i].revents;
+            if(revents == 0)
+                continue;
+
+            FFConnection* connection = ffListGet(&connections, i - 1);
+            if(!handleConnection(connection, revents, &requests[connection->endpoint], buffer, &finished) || finished)
+                closeConnection(&connections, i - 1);
+        }
     }
 
-    ffStrbufDestroy(&command);
-    close(sock);
+    while(connections.length > 0)
+        closeConnection(&connections, connections.length - 1);
+
+    ffListDestroy(&connections);
+    free(pollfds);
+
+    for(uint32_t i = 0; i < numJobs; i++)
+        ffStrbufDestroy(&requests[i]);
+
+    releaseResolveContext(context);
+}
+
+void ffNetworkingGetHttp(const char* host, const char* path, uint32_t timeout, FFstrbuf* buffer)
+{
+    FFstrbuf url;
+    ffStrbufInitA(&url, 64);
+    ffStrbufAppendS(&url, host);
+    ffStrbufAppendS(&url, path);
+
+    const char* urls[] = { url.chars };
+    ffNetworkingGetHttpFirst(1, urls, timeout, buffer);
+
+    ffStrbufDestroy(&url);
 }
@@ -0,0 +1,191 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+//Pending output of fd and callback sinks is flushed once it reaches this size
+#define FF_OUTPUT_PENDING_SIZE 4096
+
+static void flushPending(FFoutputSink* sink)
+{
+    if(sink->pending.length == 0)
+        return;
+
+    if(sink->type == FF_OUTPUT_SINK_TYPE_FD)
+    {
+        const char* data = sink->pending.chars;
+        uint32_t remaining = sink->pending.length;
+
+        while(remaining > 0)
+        {
+            ssize_t written = write(sink->fd, data, remaining);
+            if(written < 0 && errno == EINTR)
+                continue;
+            if(written <= 0)
+                break;
+
+            data += written;
+            remaining -= (uint32_t) written;
+        }
+    }
+    else if(sink->type == FF_OUTPUT_SINK_TYPE_CALLBACK)
+        sink->callback(sink->pending.chars, sink->pending.length, sink->userData);
+
+    ffStrbufClear(&sink->pending);
+}
+
+//Flushes the old sink and closes what it owns, before another one is set
+static void resetSink(FFoutputSink* sink)
+{
+    if(sink->type == FF_OUTPUT_SINK_TYPE_FILE)
+        fflush(sink->file);
+    else
+        flushPending(sink);
+
+    if(sink->ownsFd)
+        close(sink->fd);
+
+    sink->file = NULL;
+    sink->fd = -1;
+    sink->ownsFd = false;
+    sink->lineBuffered = false;
+    sink->buffer = NULL;
+    sink->callback = NULL;
+    sink->userData = NULL;
+}
+
+void ffOutputInit(FFinstance* instance)
+{
+    FFoutputSink* sink = &instance->state.output;
+    sink->type = FF_OUTPUT_SINK_TYPE_FILE;
+    sink->file = stdout;
+    sink->fd = -1;
+    sink->ownsFd = false;
+    sink->lineBuffered = false;
+    sink->buffer = NULL;
+    sink->callback = NULL;
+    sink->userData = NULL;
+    ffStrbufInitA(&sink->pending, FF_OUTPUT_PENDING_SIZE);
+
+    //Some libraries print to stdout and are silenced with ffSuppressIO, which replaces fd 1 for the whole process.
+    //Write our own output to a copy of it, so it is never affected by that
+    int fd = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+    if(fd == -1)
+        return;
+
+    ffOutputSetFD(instance, fd);
+    sink->ownsFd = true;
+}
+
+void ffOutputSetFile(FFinstance* instance, FILE* file)
+{
+    resetSink(&instance->state.output);
+    instance->state.output.type = FF_OUTPUT_SINK_TYPE_FILE;
+    instance->state.output.file = file;
+}
+
+void ffOutputSetFD(FFinstance* instance, int fd)
+{
+    resetSink(&instance->state.output);
+    instance->state.output.type = FF_OUTPUT_SINK_TYPE_FD;
+    instance->state.output.fd = fd;
+    instance->state.output.lineBuffered = isatty(fd);
+}
+
+void ffOutputSetBuffer(FFinstance* instance, FFstrbuf* buffer)
+{
+    resetSink(&instance->state.output);
+    instance->state.output.type = FF_OUTPUT_SINK_TYPE_BUFFER;
+    instance->state.output.buffer = buffer;
+}
+
+void ffOutputSetCallback(FFinstance* instance, FFoutputCallback callback, void* userData)
+{
+    resetSink(&instance->state.output);
+    instance->state.output.type = FF_OUTPUT_SINK_TYPE_CALLBACK;
+    instance->state.output.callback = callback;
+    instance->state.output.userData = userData;
+}
+
+void ffOutputWriteNS(FFinstance* instance, uint32_t length, const char* value)
+{
+    FFoutputSink* sink = &instance->state.output;
+
+    if(sink->type == FF_OUTPUT_SINK_TYPE_FILE)
+    {
+        fwrite(value, 1, length, sink->file);
+        return;
+    }
+
+    if(sink->type == FF_OUTPUT_SINK_TYPE_BUFFER)
+    {
+        ffStrbufAppendNS(sink->buffer, length, value);
+        return;
+    }
+
+    ffStrbufAppendNS(&sink->pending, length, value);
+
+    if(sink->pending.length >= FF_OUTPUT_PENDING_SIZE || (sink->lineBuffered && memchr(value, '\n', length) != NULL))
+        flushPending(sink);
+}
+
+void ffOutputWriteS(FFinstance* instance, const char* value)
+{
+    ffOutputWriteNS(instance, (uint32_t) strlen(value), value);
+}
+
+void ffOutputWriteC(FFinstance* instance, char c)
+{
+    ffOutputWriteNS(instance, 1, &c);
+}
+
+void ffOutputWrite(FFinstance* instance, const FFstrbuf* value)
+{
+    ffOutputWriteNS(instance, value->length, value->chars);
+}
+
+void ffOutputWriteF(FFinstance* instance, const char* format, ...)
+{
+    FFoutputSink* sink = &instance->state.output;
+
+    va_list arguments;
+    va_start(arguments, format);
+
+    //Format directly into the destination, instead of into a temporary buffer
+    if(sink->type == FF_OUTPUT_SINK_TYPE_FILE)
+        vfprintf(sink->file, format, arguments);
+    else if(sink->type == FF_OUTPUT_SINK_TYPE_BUFFER)
+        ffStrbufAppendVF(sink->buffer, format, arguments);
+    else
+    {
+        uint32_t start = sink->pending.length;
+        ffStrbufAppendVF(&sink->pending, format, arguments);
+
+        if(sink->pending.length >= FF_OUTPUT_PENDING_SIZE || (sink->lineBuffered && memchr(sink->pending.chars + start, '\n', sink->pending.length - start) != NULL))
+            flushPending(sink);
+    }
+
+    va_end(arguments);
+}
+
+void ffOutputPutS(FFinstance* instance, const char* value)
+{
+    ffOutputWriteS(instance, value);
+    ffOutputWriteC(instance, '\n');
+}
+
+void ffOutputPut(FFinstance* instance, const FFstrbuf* value)
+{
+    ffOutputWrite(instance, value);
+    ffOutputWriteC(instance, '\n');
+}
+
+void ffOutputFlush(FFinstance* instance)
+{
+    if(instance->state.output.type == FF_OUTPUT_SINK_TYPE_FILE)
+        fflush(instance->state.output.file);
+    else
+        flushPending(&instance->state.output);
+}
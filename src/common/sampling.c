@@ -0,0 +1,239 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+
+//The first sample of every type is taken at startup, the second one when the module prints.
+//So the measured window overlaps with the detection of the modules printed in between
+static FFsample samples[FF_SAMPLE_TYPE_COUNT][2];
+static bool started[FF_SAMPLE_TYPE_COUNT];
+
+static uint64_t getTimeNs()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t) time.tv_sec * 1000000000ULL + (uint64_t) time.tv_nsec;
+}
+
+static inline void addValue(FFlist* values, uint64_t value)
+{
+    *FF_LIST_ADD(uint64_t, values) = value;
+}
+
+static const char* nextLine(const char* line)
+{
+    line = strchr(line, '\n');
+    return line == NULL ? NULL : line + 1;
+}
+
+bool ffSampleParseCPU(const char* content, FFlist* values)
+{
+    values->length = 0;
+
+    //The cpu lines are the first ones, "cpu" is the sum of all cpus
+    for(const char* line = content; line != NULL && strncmp(line, "cpu", 3) == 0; line = nextLine(line))
+    {
+        uint64_t id = UINT64_MAX;
+        char* start = (char*) line + 3;
+
+        if(*start >= '0' && *start <= '9')
+            id = strtoull(start, &start, 10);
+        else if(*start != ' ')
+            break;
+
+        unsigned long long user, nice, system, idle, iowait, irq, softirq;
+        if(sscanf(start, "%llu%llu%llu%llu%llu%llu%llu", &user, &nice, &system, &idle, &iowait, &irq, &softirq) != 7)
+            continue;
+
+        // https://stackoverflow.com/questions/3017162/how-to-get-total-cpu-usage-in-linux-using-c#answer-3017438
+        uint64_t work = user + nice + system;
+        addValue(values, id);
+        addValue(values, work);
+        addValue(values, work + idle + iowait + irq + softirq);
+    }
+
+    return values->length > 0;
+}
+
+bool ffSampleParseDisk(const char* content, const char* blockDir, FFlist* values)
+{
+    values->length = 0;
+
+    FFstrbuf path;
+    ffStrbufInitA(&path, 64);
+    ffStrbufAppendS(&path, blockDir);
+    ffStrbufAppendC(&path, '/');
+    uint32_t baseLength = path.length;
+
+    uint64_t bytesRead = 0, bytesWritten = 0;
+    bool found = false;
+
+    for(const char* line = content; line != NULL && *line != '\0'; line = nextLine(line))
+    {
+        char name[64];
+        unsigned long long sectorsRead, sectorsWritten;
+        if(sscanf(line, "%*u %*u %63s %*u %*u %llu %*u %*u %*u %llu", name, &sectorsRead, &sectorsWritten) != 3)
+            continue;
+
+        //Only count physical disks. Partitions aren't in /sys/block, virtual devices like loop or dm have no device link.
+        //Slashes in the name are '!' in sysfs
+        for(char* c = name; *c != '\0'; ++c)
+        {
+            if(*c == '/')
+                *c = '!';
+        }
+
+        ffStrbufSubstrBefore(&path, baseLength);
+        ffStrbufAppendS(&path, name);
+        ffStrbufAppendS(&path, "/device");
+        if(access(path.chars, F_OK) != 0)
+            continue;
+
+        //Sectors in diskstats are always 512 bytes
+        bytesRead += sectorsRead * 512;
+        bytesWritten += sectorsWritten * 512;
+        found = true;
+    }
+
+    ffStrbufDestroy(&path);
+
+    if(!found)
+        return false;
+
+    addValue(values, bytesRead);
+    addValue(values, bytesWritten);
+    return true;
+}
+
+bool ffSampleParseNetwork(const char* content, FFlist* values)
+{
+    values->length = 0;
+
+    uint64_t bytesReceived = 0, bytesSent = 0;
+    bool found = false;
+
+    for(const char* line = content; line != NULL && *line != '\0'; line = nextLine(line))
+    {
+        //The two header lines have no colon before the end of the line
+        const char* colon = strchr(line, ':');
+        const char* end = strchr(line, '\n');
+        if(colon == NULL || (end != NULL && colon > end))
+            continue;
+
+        while(*line == ' ')
+            ++line;
+
+        if(colon - line == 2 && strncmp(line, "lo", 2) == 0)
+            continue;
+
+        unsigned long long received, sent;
+        if(sscanf(colon + 1, "%llu %*u %*u %*u %*u %*u %*u %*u %llu", &received, &sent) != 2)
+            continue;
+
+        bytesReceived += received;
+        bytesSent += sent;
+        found = true;
+    }
+
+    if(!found)
+        return false;
+
+    addValue(values, bytesReceived);
+    addValue(values, bytesSent);
+    return true;
+}
+
+static bool takeSample(FFsampleType type, FFsample* sample)
+{
+    static const char* files[FF_SAMPLE_TYPE_COUNT] = {
+        [FF_SAMPLE_TYPE_CPU] = "/proc/stat",
+        [FF_SAMPLE_TYPE_DISK] = "/proc/diskstats",
+        [FF_SAMPLE_TYPE_NETWORK] = "/proc/net/dev"
+    };
+
+    if(sample->values.elementSize == 0)
+        ffListInit(&sample->values, sizeof(uint64_t));
+
+    FFstrbuf content;
+    ffStrbufInitA(&content, 4096);
+
+    bool result = ffAppendFileContent(files[type], &content);
+    sample->time = getTimeNs();
+
+    if(result)
+    {
+        if(type == FF_SAMPLE_TYPE_CPU)
+            result = ffSampleParseCPU(content.chars, &sample->values);
+        else if(type == FF_SAMPLE_TYPE_DISK)
+            result = ffSampleParseDisk(content.chars, "/sys/block", &sample->values);
+        else
+            result = ffSampleParseNetwork(content.chars, &sample->values);
+    }
+
+    ffStrbufDestroy(&content);
+    return result;
+}
+
+void ffSamplingStart(uint32_t detectors)
+{
+    static const FFdetector sampleDetectors[FF_SAMPLE_TYPE_COUNT] = {
+        [FF_SAMPLE_TYPE_CPU] = FF_DETECTOR_SAMPLE_CPU,
+        [FF_SAMPLE_TYPE_DISK] = FF_DETECTOR_SAMPLE_DISK,
+        [FF_SAMPLE_TYPE_NETWORK] = FF_DETECTOR_SAMPLE_NETWORK
+    };
+
+    for(uint32_t type = 0; type < FF_SAMPLE_TYPE_COUNT; type++)
+    {
+        if(detectors & sampleDetectors[type])
+            started[type] = takeSample((FFsampleType) type, &samples[type][0]);
+    }
+}
+
+bool ffSamplingMeasure(const FFinstance* instance, FFsampleType type, const FFsample** first, const FFsample** second)
+{
+    //Not started at startup, e.g. by flashfetch. Then the whole window must be waited for here
+    if(!started[type])
+    {
+        if(!takeSample(type, &samples[type][0]))
+            return false;
+        started[type] = true;
+    }
+
+    uint64_t window = (uint64_t) instance->config.samplingWindow * 1000000ULL;
+    uint64_t elapsed = getTimeNs() - samples[type][0].time;
+
+    if(elapsed < window)
+    {
+        uint64_t remaining = window - elapsed;
+        struct timespec duration = {
+            .tv_sec = (time_t) (remaining / 1000000000ULL),
+            .tv_nsec = (long) (remaining % 1000000000ULL)
+        };
+        while(nanosleep(&duration, &duration) == -1 && errno == EINTR);
+    }
+
+    if(!takeSample(type, &samples[type][1]))
+        return false;
+
+    *first = &samples[type][0];
+    *second = &samples[type][1];
+    return true;
+}
+
+double ffSamplingGetRate(const FFsample* first, const FFsample* second, uint32_t index)
+{
+    if(index >= first->values.length || index >= second->values.length || second->time <= first->time)
+        return 0;
+
+    uint64_t before = *FF_LIST_GET(uint64_t, &first->values, index);
+    uint64_t after = *FF_LIST_GET(uint64_t, &second->values, index);
+
+    //The counter was reset, e.g. because a device was removed
+    if(after < before)
+        return 0;
+
+    return (double) (after - before) / ((double) (second->time - first->time) / 1000000000.0);
+}
@@ -1,5 +1,8 @@
 #include "fastfetch.h"
 
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include <pthread.h>
 
 static inline void* detectPlasmaThreadMain(void* instance)
@@ -32,41 +35,196 @@ static inline void* connectDisplayServerThreadMain(void* instance)
     return NULL;
 }
 
-static inline void* startThreadsThreadMain(void* instance)
+typedef struct FFdetectionThreadsArgs
 {
-    pthread_t dsThread;
-    pthread_create(&dsThread, NULL, connectDisplayServerThreadMain, instance);
-    pthread_detach(dsThread);
+    FFinstance* instance;
+    uint32_t detectors;
+} FFdetectionThreadsArgs;
 
-    pthread_t gtk2Thread;
-    pthread_create(&gtk2Thread, NULL, detectGTK2ThreadMain, instance);
-    pthread_detach(gtk2Thread);
+static inline void startThread(void* (*threadMain)(void*), FFinstance* instance)
+{
+    pthread_t thread;
+    pthread_create(&thread, NULL, threadMain, instance);
+    pthread_detach(thread);
+}
+
+static inline void* startThreadsThreadMain(void* args)
+{
+    FFinstance* instance = ((FFdetectionThreadsArgs*) args)->instance;
+    uint32_t detectors = ((FFdetectionThreadsArgs*) args)->detectors;
+    free(args);
 
-    pthread_t gtk3Thread;
-    pthread_create(&gtk3Thread, NULL, detectGTK3ThreadMain, instance);
-    pthread_detach(gtk3Thread);
+    if(detectors & FF_DETECTOR_DISPLAY_SERVER)
+        startThread(connectDisplayServerThreadMain, instance);
 
-    pthread_t gtk4Thread;
-    pthread_create(&gtk4Thread, NULL, detectGTK4ThreadMain, instance);
-    pthread_detach(gtk4Thread);
+    if(detectors & FF_DETECTOR_GTK2)
+        startThread(detectGTK2ThreadMain, instance);
 
-    pthread_t plasmaThread;
-    pthread_create(&plasmaThread, NULL, detectPlasmaThreadMain, instance);
-    pthread_detach(plasmaThread);
+    if(detectors & FF_DETECTOR_GTK3)
+        startThread(detectGTK3ThreadMain, instance);
+
+    if(detectors & FF_DETECTOR_GTK4)
+        startThread(detectGTK4ThreadMain, instance);
+
+    if(detectors & FF_DETECTOR_PLASMA)
+        startThread(detectPlasmaThreadMain, instance);
 
     return NULL;
 }
 
-void ffStartDetectionThreads(FFinstance* instance)
+void ffStartDetectionThreadsFor(FFinstance* instance, uint32_t detectors)
 {
     //Android needs none of the things that are detected here
     //And using gsettings sometimes hangs the program in android for some unknown reason,
     //and since we don't need it we just never call it.
     #ifdef __ANDROID__
+        FF_UNUSED(instance, detectors)
         return;
     #endif
 
+    if(detectors == FF_DETECTOR_NONE)
+        return;
+
+    FFdetectionThreadsArgs* args = malloc(sizeof(FFdetectionThreadsArgs));
+    args->instance = instance;
+    args->detectors = detectors;
+
     pthread_t startThreadsThread;
-    pthread_create(&startThreadsThread, NULL, startThreadsThreadMain, instance);
+    pthread_create(&startThreadsThread, NULL, startThreadsThreadMain, args);
     pthread_detach(startThreadsThread);
 }
+
+void ffStartDetectionThreads(FFinstance* instance)
+{
+    ffStartDetectionThreadsFor(instance, FF_DETECTOR_ALL);
+}
+
+//Shared between ffRunDeadlineTasks and the task threads. Freed by whoever releases it last,
+//because threads which missed their deadline are not waited for. They may never return
+typedef struct FFdeadlineTasksState
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t references;
+    void (*task)(void* data, uint32_t index, void* result);
+    void* data;
+    void (*freeData)(void* data);
+    size_t resultSize;
+    uint8_t* results; //Every task writes only its own, the caller reads only those of finished tasks
+    bool* done;
+} FFdeadlineTasksState;
+
+typedef struct FFdeadlineTask
+{
+    FFdeadlineTasksState* state;
+    uint32_t index;
+} FFdeadlineTask;
+
+static void releaseDeadlineTasksState(FFdeadlineTasksState* state)
+{
+    pthread_mutex_lock(&state->mutex);
+    bool last = --state->references == 0;
+    pthread_mutex_unlock(&state->mutex);
+
+    if(!last)
+        return;
+
+    if(state->freeData != NULL)
+        state->freeData(state->data);
+
+    free(state->results);
+    free(state->done);
+    pthread_cond_destroy(&state->cond);
+    pthread_mutex_destroy(&state->mutex);
+    free(state);
+}
+
+static void* deadlineTaskThreadMain(void* arg)
+{
+    FFdeadlineTask task = *(FFdeadlineTask*) arg;
+    free(arg);
+
+    FFdeadlineTasksState* state = task.state;
+    state->task(state->data, task.index, state->results + task.index * state->resultSize);
+
+    pthread_mutex_lock(&state->mutex);
+    state->done[task.index] = true;
+    pthread_cond_broadcast(&state->cond);
+    pthread_mutex_unlock(&state->mutex);
+
+    releaseDeadlineTasksState(state);
+    return NULL;
+}
+
+static void addMilliseconds(struct timespec* time, uint32_t milliseconds)
+{
+    time->tv_sec += milliseconds / 1000;
+    time->tv_nsec += (long) (milliseconds % 1000) * 1000000L;
+
+    if(time->tv_nsec >= 1000000000L)
+    {
+        ++time->tv_sec;
+        time->tv_nsec -= 1000000000L;
+    }
+}
+
+void ffRunDeadlineTasks(uint32_t numTasks, const uint32_t* timeouts, void (*task)(void* data, uint32_t index, void* result), void* data, void (*freeData)(void* data), size_t resultSize, void* results, bool* done)
+{
+    FFdeadlineTasksState* state = calloc(1, sizeof(FFdeadlineTasksState));
+    state->references = 1 + numTasks; //Ours and one of every task
+    state->task = task;
+    state->data = data;
+    state->freeData = freeData;
+    state->resultSize = resultSize;
+    state->results = calloc(numTasks, resultSize);
+    state->done = calloc(numTasks, sizeof(bool));
+    pthread_mutex_init(&state->mutex, NULL);
+
+    pthread_condattr_t condattr;
+    pthread_condattr_init(&condattr);
+    pthread_condattr_setclock(&condattr, CLOCK_MONOTONIC);
+    pthread_cond_init(&state->cond, &condattr);
+    pthread_condattr_destroy(&condattr);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    //Always in their own threads, independent of --multithreading. Called inline, a hanging task would take fastfetch with it
+    for(uint32_t i = 0; i < numTasks; ++i)
+    {
+        FFdeadlineTask* arg = malloc(sizeof(FFdeadlineTask));
+        arg->state = state;
+        arg->index = i;
+
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, deadlineTaskThreadMain, arg) == 0)
+        {
+            pthread_detach(thread);
+            continue;
+        }
+
+        //Never done, like a task that missed its deadline
+        free(arg);
+        releaseDeadlineTasksState(state);
+    }
+
+    pthread_mutex_lock(&state->mutex);
+
+    for(uint32_t i = 0; i < numTasks; ++i)
+    {
+        struct timespec deadline = start;
+        addMilliseconds(&deadline, timeouts[i]);
+
+        while(!state->done[i] && pthread_cond_timedwait(&state->cond, &state->mutex, &deadline) == 0);
+
+        if(state->done[i])
+            memcpy((uint8_t*) results + i * resultSize, state->results + i * resultSize, resultSize);
+
+        if(done != NULL)
+            done[i] = state->done[i];
+    }
+
+    pthread_mutex_unlock(&state->mutex);
+
+    releaseDeadlineTasksState(state);
+}
@@ -0,0 +1,519 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+//Size of the chunks /proc/cpuinfo is read in. The kernel only generates the blocks which are actually read
+#define FF_CPU_CPUINFO_CHUNK_SIZE 4096
+
+void ffCPUResultInit(FFCPUResult* result)
+{
+    ffStrbufInit(&result->name);
+    ffStrbufInit(&result->vendor);
+    result->family = 0;
+    result->model = 0;
+    result->stepping = 0;
+    result->packages = 0;
+    result->physicalCores = 0;
+    result->threads = 0;
+    result->clusters = 0;
+    result->cacheL1d = 0;
+    result->cacheL1i = 0;
+    result->cacheL2 = 0;
+    result->cacheL3 = 0;
+    ffListInit(&result->policies, sizeof(FFCPUPolicy));
+    result->procGhz = 0;
+}
+
+void ffCPUResultDestroy(FFCPUResult* result)
+{
+    ffStrbufDestroy(&result->name);
+    ffStrbufDestroy(&result->vendor);
+    ffListDestroy(&result->policies);
+}
+
+bool ffCPUIDNative(uint32_t leaf, uint32_t registers[4])
+{
+    #if defined(__x86_64__) || defined(__i386__)
+        //__get_cpuid checks the highest supported leaf of the range first
+        return __get_cpuid(leaf, &registers[0], &registers[1], &registers[2], &registers[3]) != 0;
+    #else
+        FF_UNUSED(leaf, registers);
+        return false;
+    #endif
+}
+
+static void appendRegisters(FFstrbuf* buffer, uint32_t numRegisters, const uint32_t* registers)
+{
+    char chars[16];
+    for(uint32_t i = 0; i < numRegisters; i++)
+        memcpy(chars + i * 4, &registers[i], 4);
+
+    //Stops at the first '\0'
+    ffStrbufAppendNS(buffer, numRegisters * 4, chars);
+}
+
+bool ffDetectCPUID(FFCPUIDFunction cpuid, FFCPUResult* result)
+{
+    uint32_t registers[4]; //eax, ebx, ecx, edx
+
+    if(!cpuid(0, registers))
+        return false;
+
+    uint32_t maxLeaf = registers[0];
+
+    if(result->vendor.length == 0)
+        appendRegisters(&result->vendor, 3, (uint32_t[]) {registers[1], registers[3], registers[2]});
+
+    if(maxLeaf >= 1 && cpuid(1, registers))
+    {
+        uint32_t family = (registers[0] >> 8) & 0xF;
+        uint32_t model = (registers[0] >> 4) & 0xF;
+
+        //Same as the kernel does for "cpu family" and "model" in /proc/cpuinfo
+        if(family == 0xF)
+            family += (registers[0] >> 20) & 0xFF;
+        if(family >= 6)
+            model += ((registers[0] >> 16) & 0xF) << 4;
+
+        result->family = family;
+        result->model = model;
+        result->stepping = registers[0] & 0xF;
+    }
+
+    if(result->name.length > 0)
+        return true;
+
+    //The brand string is 48 chars in the extended leafs 0x80000002 - 0x80000004
+    if(!cpuid(0x80000000, registers) || registers[0] < 0x80000004)
+        return true;
+
+    for(uint32_t leaf = 0x80000002; leaf <= 0x80000004; leaf++)
+    {
+        if(!cpuid(leaf, registers))
+            break;
+
+        appendRegisters(&result->name, 4, registers);
+        if(result->name.length < (leaf - 0x80000001) * 16)
+            break; //String ended
+    }
+
+    ffStrbufTrim(&result->name, ' ');
+
+    return true;
+}
+
+//Number of cpus in a list like "0-3,8,10-11" or "0 1 2 3", like related_cpus uses
+static uint32_t countCpuList(const char* list)
+{
+    uint32_t count = 0;
+
+    while(*list >= '0' && *list <= '9')
+    {
+        char* end;
+        unsigned long first = strtoul(list, &end, 10);
+        unsigned long last = first;
+
+        if(*end == '-')
+            last = strtoul(end + 1, &end, 10);
+
+        if(last >= first)
+            count += (uint32_t) (last - first + 1);
+
+        list = *end == ',' || *end == ' ' ? end + 1 : end;
+    }
+
+    return count;
+}
+
+static int compareUInt64(const void* a, const void* b)
+{
+    uint64_t left = *(const uint64_t*) a;
+    uint64_t right = *(const uint64_t*) b;
+    return left < right ? -1 : left > right;
+}
+
+static int comparePolicies(const void* a, const void* b)
+{
+    uint32_t left = ((const FFCPUPolicy*) a)->id;
+    uint32_t right = ((const FFCPUPolicy*) b)->id;
+    return left < right ? -1 : left > right;
+}
+
+//Values are (package << 32 | id). Returns the number of unique values, packages is set to the number of unique packages
+static uint32_t countUnique(FFlist* values, uint32_t* packages)
+{
+    qsort(ffListData(values), values->length, sizeof(uint64_t), compareUInt64);
+
+    uint32_t result = 0;
+    *packages = 0;
+
+    for(uint32_t i = 0; i < values->length; i++)
+    {
+        uint64_t value = *FF_LIST_GET(uint64_t, values, i);
+        uint64_t previous = i > 0 ? *FF_LIST_GET(uint64_t, values, i - 1) : UINT64_MAX;
+
+        if(i > 0 && value == previous)
+            continue;
+
+        ++result;
+        if(i == 0 || (value >> 32) != (previous >> 32))
+            ++*packages;
+    }
+
+    return result;
+}
+
+static void detectCaches(int cpufd, uint32_t cpu, FFCPUResult* result)
+{
+    int cachefd = openat(cpufd, "cache", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(cachefd == -1)
+        return;
+
+    char name[32];
+    char buffer[64];
+
+    for(uint32_t index = 0;; index++)
+    {
+        snprintf(name, sizeof(name), "index%u", index);
+        int indexfd = openat(cachefd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(indexfd == -1)
+            break;
+
+        //Shared caches are counted once, by the first cpu which shares them
+        uint32_t level;
+        if(
+            ffReadFileAt(indexfd, "shared_cpu_list", buffer, sizeof(buffer)) > 0 &&
+            strtoul(buffer, NULL, 10) == cpu &&
+            ffReadUIntAt(indexfd, "level", 10, &level) &&
+            ffReadFileAt(indexfd, "size", buffer, sizeof(buffer)) > 0
+        ) {
+            char* unit;
+            uint32_t size = (uint32_t) strtoul(buffer, &unit, 10); //KiB
+            if(*unit == 'M')
+                size *= 1024;
+            else if(*unit != 'K')
+                size /= 1024;
+
+            if(level == 1)
+            {
+                ffReadFileAt(indexfd, "type", buffer, sizeof(buffer));
+                if(strncmp(buffer, "Instruction", 11) == 0)
+                    result->cacheL1i += size;
+                else
+                    result->cacheL1d += size;
+            }
+            else if(level == 2)
+                result->cacheL2 += size;
+            else if(level == 3)
+                result->cacheL3 += size;
+        }
+
+        close(indexfd);
+    }
+
+    close(cachefd);
+}
+
+static void detectPolicies(int cpuDirfd, FFCPUResult* result)
+{
+    int cpufreqfd = openat(cpuDirfd, "cpufreq", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(cpufreqfd == -1)
+        return;
+
+    DIR* dirp = fdopendir(cpufreqfd);
+    if(dirp == NULL)
+    {
+        close(cpufreqfd);
+        return;
+    }
+
+    char buffer[256];
+
+    struct dirent* entry;
+    while((entry = readdir(dirp)) != NULL)
+    {
+        if(strncmp(entry->d_name, "policy", 6) != 0 || entry->d_name[6] < '0' || entry->d_name[6] > '9')
+            continue;
+
+        int policyfd = openat(cpufreqfd, entry->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(policyfd == -1)
+            continue;
+
+        FFCPUPolicy policy;
+        policy.id = (uint32_t) strtoul(entry->d_name + 6, NULL, 10);
+        policy.numCpus = 0;
+        policy.maxFrequency = 0;
+
+        //Same priority as the displayed frequency of the module
+        (void) (
+            ffReadUIntAt(policyfd, "bios_limit", 10, &policy.maxFrequency) ||
+            ffReadUIntAt(policyfd, "scaling_max_freq", 10, &policy.maxFrequency) ||
+            ffReadUIntAt(policyfd, "cpuinfo_max_freq", 10, &policy.maxFrequency)
+        );
+
+        if(
+            ffReadFileAt(policyfd, "related_cpus", buffer, sizeof(buffer)) > 0 ||
+            ffReadFileAt(policyfd, "affected_cpus", buffer, sizeof(buffer)) > 0
+        ) policy.numCpus = countCpuList(buffer);
+
+        close(policyfd);
+
+        if(policy.maxFrequency > 0)
+            *FF_LIST_ADD(FFCPUPolicy, &result->policies) = policy;
+    }
+
+    closedir(dirp);
+
+    qsort(ffListData(&result->policies), result->policies.length, sizeof(FFCPUPolicy), comparePolicies);
+}
+
+bool ffDetectCPUTopology(const char* cpuDir, FFCPUResult* result)
+{
+    int dirfd = open(cpuDir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(dirfd == -1)
+        return false;
+
+    DIR* dirp = fdopendir(dirfd);
+    if(dirp == NULL)
+    {
+        close(dirfd);
+        return false;
+    }
+
+    //(package << 32 | core) and (package << 32 | cluster) of every online cpu
+    FFlist cores;
+    ffListInitA(&cores, sizeof(uint64_t), 64);
+    FFlist clusters;
+    ffListInitA(&clusters, sizeof(uint64_t), 64);
+
+    result->cacheL1d = result->cacheL1i = result->cacheL2 = result->cacheL3 = 0;
+
+    struct dirent* entry;
+    while((entry = readdir(dirp)) != NULL)
+    {
+        if(strncmp(entry->d_name, "cpu", 3) != 0 || entry->d_name[3] < '0' || entry->d_name[3] > '9')
+            continue;
+
+        int cpufd = openat(dirfd, entry->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(cpufd == -1)
+            continue;
+
+        //Offline cpus don't have a topology directory
+        uint32_t package, core, cluster;
+        if(
+            ffReadUIntAt(cpufd, "topology/physical_package_id", 10, &package) &&
+            ffReadUIntAt(cpufd, "topology/core_id", 10, &core)
+        ) {
+            *FF_LIST_ADD(uint64_t, &cores) = ((uint64_t) package << 32) | core;
+
+            //Exists since Linux 5.16
+            if(ffReadUIntAt(cpufd, "topology/cluster_id", 10, &cluster))
+                *FF_LIST_ADD(uint64_t, &clusters) = ((uint64_t) package << 32) | cluster;
+
+            detectCaches(cpufd, (uint32_t) strtoul(entry->d_name + 3, NULL, 10), result);
+        }
+
+        close(cpufd);
+    }
+
+    result->policies.length = 0;
+    detectPolicies(dirfd, result);
+
+    closedir(dirp);
+
+    bool found = cores.length > 0;
+    if(found)
+    {
+        uint32_t packages;
+        result->threads = cores.length;
+        result->physicalCores = countUnique(&cores, &result->packages);
+        result->clusters = countUnique(&clusters, &packages);
+    }
+
+    ffListDestroy(&clusters);
+    ffListDestroy(&cores);
+    return found;
+}
+
+//Line 1: boot id, line 2: the counts and cache sizes, then one line per policy
+static void writeTopology(const FFCPUResult* result, const FFstrbuf* bootId, FFstrbuf* content)
+{
+    ffStrbufAppend(content, bootId);
+    ffStrbufAppendF(content, "\n%u %u %u %u %u %u %u %u\n",
+        result->packages, result->clusters, result->physicalCores, result->threads,
+        result->cacheL1d, result->cacheL1i, result->cacheL2, result->cacheL3
+    );
+
+    for(uint32_t i = 0; i < result->policies.length; i++)
+    {
+        const FFCPUPolicy* policy = FF_LIST_GET(FFCPUPolicy, &result->policies, i);
+        ffStrbufAppendF(content, "%u %u %u\n", policy->id, policy->numCpus, policy->maxFrequency);
+    }
+}
+
+static bool readTopology(const FFstrbuf* content, const FFstrbuf* bootId, FFCPUResult* result)
+{
+    if(!ffStrbufStartsWithS(content, bootId->chars) || content->chars[bootId->length] != '\n')
+        return false;
+
+    const char* line = content->chars + bootId->length + 1;
+    int offset = 0;
+
+    if(sscanf(line, "%u %u %u %u %u %u %u %u\n%n",
+        &result->packages, &result->clusters, &result->physicalCores, &result->threads,
+        &result->cacheL1d, &result->cacheL1i, &result->cacheL2, &result->cacheL3,
+        &offset
+    ) != 8 || offset == 0) return false;
+
+    result->policies.length = 0;
+
+    FFCPUPolicy policy;
+    for(line += offset; sscanf(line, "%u %u %u\n%n", &policy.id, &policy.numCpus, &policy.maxFrequency, &offset) == 3; line += offset)
+        *FF_LIST_ADD(FFCPUPolicy, &result->policies) = policy;
+
+    return true;
+}
+
+bool ffDetectCPUTopologyCached(FFinstance* instance, const char* cpuDir, FFCPUResult* result)
+{
+    //The topology only changes with a reboot (ignoring cpu hotplug), so it is cached until then
+    FFstrbuf bootId;
+    ffStrbufInit(&bootId);
+    ffGetFileContent("/proc/sys/kernel/random/boot_id", &bootId);
+    ffStrbufTrimRight(&bootId, '\n');
+
+    FFstrbuf content;
+    ffStrbufInit(&content);
+
+    bool found = false;
+
+    if(bootId.length > 0 && !instance->config.recache)
+    {
+        ffReadCacheFile(instance, "cputopology", "fft", &content);
+        found = readTopology(&content, &bootId, result);
+    }
+
+    if(!found && ffDetectCPUTopology(cpuDir, result))
+    {
+        found = true;
+
+        if(bootId.length > 0 && instance->config.cacheSave)
+        {
+            ffStrbufClear(&content);
+            writeTopology(result, &bootId, &content);
+            ffWriteCacheFile(instance, "cputopology", "fft", &content);
+        }
+    }
+
+    ffStrbufDestroy(&content);
+    ffStrbufDestroy(&bootId);
+    return found;
+}
+
+static void parseCpuinfoLine(const char* line, FFCPUResult* result, FFstrbuf* value)
+{
+    ffStrbufClear(value);
+
+    if(result->name.length == 0 && ffGetPropValue(line, "model name :", &result->name))
+        return;
+
+    if(result->vendor.length == 0 && ffGetPropValue(line, "vendor_id :", &result->vendor))
+        return;
+
+    if(ffGetPropValue(line, "cpu cores :", value))
+    {
+        if(result->physicalCores == 0)
+            result->physicalCores = (uint32_t) strtoul(value->chars, NULL, 10);
+    }
+    else if(ffGetPropValue(line, "cpu MHz :", value))
+        result->procGhz = strtod(value->chars, NULL) / 1000.0; //to GHz
+    else if(ffGetPropValue(line, "cpu family :", value))
+    {
+        if(result->family == 0)
+            result->family = (uint32_t) strtoul(value->chars, NULL, 10);
+    }
+    else if(ffGetPropValue(line, "model :", value))
+    {
+        if(result->model == 0)
+            result->model = (uint32_t) strtoul(value->chars, NULL, 10);
+    }
+    else if(ffGetPropValue(line, "stepping :", value))
+    {
+        if(result->stepping == 0)
+            result->stepping = (uint32_t) strtoul(value->chars, NULL, 10);
+    }
+    else if(result->name.length == 0)
+        ffGetPropValue(line, "Hardware :", &result->name); //For Android devices
+}
+
+bool ffDetectCPUInfo(const char* fileName, FFCPUResult* result)
+{
+    int fd = open(fileName, O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        return false;
+
+    FFstrbuf content;
+    ffStrbufInitA(&content, FF_CPU_CPUINFO_CHUNK_SIZE + 1);
+
+    FFstrbuf value;
+    ffStrbufInit(&value);
+
+    uint32_t lineStart = 0;
+    bool done = false;
+
+    //Only read until the end of the first processor block. On many core machines the file is large and slow to generate
+    while(!done)
+    {
+        ffStrbufEnsureFree(&content, FF_CPU_CPUINFO_CHUNK_SIZE);
+        ssize_t readed = read(fd, content.chars + content.length, FF_CPU_CPUINFO_CHUNK_SIZE);
+        if(readed <= 0)
+        {
+            //Parse a last line without '\n'
+            if(lineStart < content.length)
+                parseCpuinfoLine(content.chars + lineStart, result, &value);
+            break;
+        }
+
+        content.length += (uint32_t) readed;
+        content.chars[content.length] = '\0';
+
+        uint32_t lineEnd;
+        while((lineEnd = ffStrbufNextIndexC(&content, lineStart, '\n')) < content.length)
+        {
+            //Stop after the first CPU
+            if(result->name.length > 0 && lineEnd == lineStart)
+            {
+                done = true;
+                break;
+            }
+
+            parseCpuinfoLine(content.chars + lineStart, result, &value);
+            lineStart = lineEnd + 1;
+        }
+    }
+
+    close(fd);
+    ffStrbufDestroy(&value);
+    ffStrbufDestroy(&content);
+    return true;
+}
+
+bool ffDetectCPU(FFinstance* instance, FFCPUIDFunction cpuid, const char* cpuDir, const char* cpuinfoFile, FFCPUResult* result)
+{
+    //Sockets, clusters, caches and cpufreq policies only come from sysfs. cpuid doesn't replace them, and on ARM there is no cpuid at all
+    bool topologyFound = ffDetectCPUTopologyCached(instance, cpuDir, result);
+
+    //On x86 cpuinfo is only needed for the frequency then, and it is slow to generate on many core machines
+    if(ffDetectCPUID(cpuid, result) && result->name.length > 0 && topologyFound)
+        return false;
+
+    return ffDetectCPUInfo(cpuinfoFile, result);
+}
@@ -0,0 +1,175 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+//Filesystems which don't store anything on a disk. Network filesystems and FUSE mounts are real ones, they may hang though
+static const char* pseudoFilesystems[] = {
+    "autofs", "binfmt_misc", "bpf", "cgroup", "cgroup2", "configfs", "debugfs", "devfs", "devpts", "devtmpfs",
+    "efivarfs", "fuse.gvfsd-fuse", "fuse.portal", "fusectl", "hugetlbfs", "mqueue", "nfsd", "nsfs", "proc",
+    "pstore", "ramfs", "rpc_pipefs", "securityfs", "selinuxfs", "squashfs", "sysfs", "tmpfs", "tracefs"
+};
+
+static bool isPseudoFilesystem(const char* fsType)
+{
+    for(uint32_t i = 0; i < sizeof(pseudoFilesystems) / sizeof(pseudoFilesystems[0]); i++)
+    {
+        if(strcmp(fsType, pseudoFilesystems[i]) == 0)
+            return true;
+    }
+    return false;
+}
+
+//Returns the field and moves line behind it. Fields are separated by single spaces
+static char* nextField(char** line)
+{
+    char* field = *line;
+    char* end = strchr(field, ' ');
+
+    if(end == NULL)
+        *line = field + strlen(field);
+    else
+    {
+        *end = '\0';
+        *line = end + 1;
+    }
+
+    return field;
+}
+
+//Spaces, tabs, newlines and backslashes in paths are escaped as octal, e.g. \040
+static void appendUnescaped(FFstrbuf* buffer, const char* value)
+{
+    for(; *value != '\0'; ++value)
+    {
+        if(value[0] == '\\' &&
+            value[1] >= '0' && value[1] <= '3' &&
+            value[2] >= '0' && value[2] <= '7' &&
+            value[3] >= '0' && value[3] <= '7'
+        ) {
+            ffStrbufAppendC(buffer, (char) ((value[1] - '0') * 64 + (value[2] - '0') * 8 + (value[3] - '0')));
+            value += 3;
+        }
+        else
+            ffStrbufAppendC(buffer, *value);
+    }
+}
+
+static void destroyMount(FFDiskMount* mount)
+{
+    ffStrbufDestroy(&mount->mountPoint);
+    ffStrbufDestroy(&mount->fsType);
+}
+
+void ffDiskMountsDestroy(FFlist* mounts)
+{
+    FF_LIST_FOR_EACH(FFDiskMount, mount, mounts)
+        destroyMount(mount);
+    ffListDestroy(mounts);
+}
+
+bool ffDetectDiskMounts(const char* fileName, bool all, FFlist* mounts)
+{
+    ffListInit(mounts, sizeof(FFDiskMount));
+
+    FFstrbuf content;
+    ffStrbufInitA(&content, 8192);
+
+    if(!ffAppendFileContent(fileName, &content))
+    {
+        ffStrbufDestroy(&content);
+        return false;
+    }
+
+    //"36 35 98:0 /root /mnt/point rw,noatime master:1 - ext4 /dev/sda1 rw"
+    //The optional fields before "-" can be any number
+    for(uint32_t start = 0; start < content.length;)
+    {
+        uint32_t end = ffStrbufNextIndexC(&content, start, '\n');
+        content.chars[end] = '\0';
+        char* line = content.chars + start;
+        start = end + 1;
+
+        nextField(&line); //mount id
+        nextField(&line); //parent id
+        char* device = nextField(&line);
+        char* root = nextField(&line);
+        char* mountPoint = nextField(&line);
+
+        char* separator = strstr(line, " - ");
+        if(separator == NULL)
+            continue;
+        line = separator + 3;
+        char* fsType = nextField(&line);
+
+        if(!all && isPseudoFilesystem(fsType))
+            continue;
+
+        char* minor;
+        uint64_t deviceId = strtoull(device, &minor, 10) << 32;
+        if(*minor != ':')
+            continue;
+        deviceId |= strtoull(minor + 1, NULL, 10);
+
+        //Unless all, a device mounted more than once (bind mounts, btrfs subvolumes of the same id) is shown once.
+        //Prefer the mount of its root over a bind mount of a subdirectory
+        bool isRoot = strcmp(root, "/") == 0;
+        FFDiskMount* mount = NULL;
+        FF_LIST_FOR_EACH(FFDiskMount, existing, mounts)
+        {
+            if(!all && existing->deviceId == deviceId)
+            {
+                mount = existing;
+                break;
+            }
+        }
+
+        if(mount != NULL)
+        {
+            if(mount->isRoot || !isRoot)
+                continue;
+            ffStrbufClear(&mount->mountPoint);
+            ffStrbufClear(&mount->fsType);
+        }
+        else
+        {
+            mount = FF_LIST_ADD(FFDiskMount, mounts);
+            ffStrbufInit(&mount->mountPoint);
+            ffStrbufInit(&mount->fsType);
+            mount->deviceId = deviceId;
+        }
+
+        mount->isRoot = isRoot;
+        appendUnescaped(&mount->mountPoint, mountPoint);
+        ffStrbufAppendS(&mount->fsType, fsType);
+    }
+
+    ffStrbufDestroy(&content);
+    return true;
+}
+
+//Mount points are prefixes of whole path components, "/home" contains "/home/user" but not "/homework"
+static bool containsPath(const FFstrbuf* mountPoint, const char* path)
+{
+    if(strncmp(path, mountPoint->chars, mountPoint->length) != 0)
+        return false;
+
+    return
+        path[mountPoint->length] == '\0' ||
+        path[mountPoint->length] == '/' ||
+        ffStrbufEndsWithC(mountPoint, '/');
+}
+
+const FFDiskMount* ffDiskMountsFind(const FFlist* mounts, const char* path)
+{
+    const FFDiskMount* result = NULL;
+
+    //Mounts are in mount order, a later one on the same mount point hides the earlier
+    FF_LIST_FOR_EACH(FFDiskMount, mount, mounts)
+    {
+        if(containsPath(&mount->mountPoint, path) && (result == NULL || mount->mountPoint.length >= result->mountPoint.length))
+            result = mount;
+    }
+
+    return result;
+}
@@ -97,7 +97,7 @@ const FFDisplayServerResult* ffConnectDisplayServer(const FFinstance* instance)
     ffStrbufInit(&result.deProcessName);
     ffStrbufInit(&result.dePrettyName);
     ffStrbufInit(&result.deVersion);
-    ffListInitA(&result.resolutions, sizeof(FFResolutionResult), 4);
+    ffListInit(&result.resolutions, sizeof(FFResolutionResult));
 
     //We try wayland as our prefered display server, as it supports the most features.
     //This method can't detect the name of our WM / DE
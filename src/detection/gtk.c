@@ -185,9 +185,8 @@ static void detectGTK(FFinstance* instance, const char* version, const char* env
     FFstrbuf baseDirCopy;
     ffStrbufInitA(&baseDirCopy, 64);
 
-    for(uint32_t i = 0; i < instance->state.configDirs.length; i++)
+    FF_LIST_FOR_EACH(FFstrbuf, baseDir, &instance->state.configDirs)
     {
-        FFstrbuf* baseDir = (FFstrbuf*) ffListGet(&instance->state.configDirs, i);
         ffStrbufSet(&baseDirCopy, baseDir);
         detectGTKFromConfigDir(&baseDirCopy, version, result);
         if(allPropertiesSet(result))
@@ -0,0 +1,135 @@
+#include "fastfetch.h"
+
+#include <string.h>
+
+//Parses the decimal number at the start of value, after leading spaces. Stops at the first non digit
+static uint64_t parseUInt64(const char* value)
+{
+    while(*value == ' ' || *value == '\t')
+        ++value;
+
+    uint64_t result = 0;
+    for(; *value >= '0' && *value <= '9'; ++value)
+        result = result * 10 + (uint64_t) (*value - '0');
+
+    return result;
+}
+
+//Returns the field of the meminfo key, or NULL if it isn't used. The switch narrows it down to a few keys, which are then compared as a whole
+static uint64_t* getMemInfoField(FFMemoryResult* result, const char* key, uint32_t length)
+{
+    #define FF_MEMINFO_FIELD(name, field) \
+        if(length == sizeof(name) - 1 && memcmp(key, name, sizeof(name) - 1) == 0) \
+            return &result->field;
+
+    switch(key[0])
+    {
+        case 'B':
+            FF_MEMINFO_FIELD("Buffers", buffers)
+            break;
+        case 'C':
+            FF_MEMINFO_FIELD("Cached", cached)
+            break;
+        case 'H':
+            FF_MEMINFO_FIELD("HugePages_Total", hugePagesTotal)
+            FF_MEMINFO_FIELD("HugePages_Free", hugePagesFree)
+            FF_MEMINFO_FIELD("Hugepagesize", hugePageSize)
+            break;
+        case 'M':
+            FF_MEMINFO_FIELD("MemTotal", total)
+            FF_MEMINFO_FIELD("MemFree", free)
+            FF_MEMINFO_FIELD("MemAvailable", available)
+            break;
+        case 'S':
+            FF_MEMINFO_FIELD("Shmem", shared)
+            FF_MEMINFO_FIELD("SReclaimable", sReclaimable)
+            FF_MEMINFO_FIELD("SwapTotal", swapTotal)
+            FF_MEMINFO_FIELD("SwapFree", swapFree)
+            break;
+        case 'Z':
+            FF_MEMINFO_FIELD("Zswap", zswap)
+            FF_MEMINFO_FIELD("Zswapped", zswapped)
+            break;
+        default:
+            break;
+    }
+
+    #undef FF_MEMINFO_FIELD
+
+    return NULL;
+}
+
+bool ffDetectMemInfo(const char* fileName, FFMemoryResult* result)
+{
+    memset(result, 0, sizeof(*result));
+
+    FFstrbuf content;
+    ffStrbufInitA(&content, 4096);
+
+    if(!ffAppendFileContent(fileName, &content))
+    {
+        ffStrbufDestroy(&content);
+        return false;
+    }
+
+    //Lines are "Key:   value kB" or "Key:   value" for counts
+    for(uint32_t start = 0; start < content.length;)
+    {
+        uint32_t end = ffStrbufNextIndexC(&content, start, '\n');
+        content.chars[end] = '\0';
+
+        const char* line = content.chars + start;
+        const char* colon = strchr(line, ':');
+        if(colon != NULL)
+        {
+            uint64_t* field = getMemInfoField(result, line, (uint32_t) (colon - line));
+            if(field != NULL)
+                *field = parseUInt64(colon + 1);
+        }
+
+        start = end + 1;
+    }
+
+    ffStrbufDestroy(&content);
+    return result->total > 0;
+}
+
+bool ffDetectZFSArc(const char* fileName, FFMemoryResult* result)
+{
+    FFstrbuf content;
+    ffStrbufInitA(&content, 8192);
+
+    if(!ffAppendFileContent(fileName, &content))
+    {
+        ffStrbufDestroy(&content);
+        return false;
+    }
+
+    //A kstat header line, then "name type data" and one line per value in that order
+    bool found = false;
+    for(uint32_t start = 0; start < content.length;)
+    {
+        uint32_t end = ffStrbufNextIndexC(&content, start, '\n');
+        content.chars[end] = '\0';
+
+        const char* line = content.chars + start;
+        if(strncmp(line, "size ", 5) == 0)
+        {
+            //Skip the type column
+            const char* value = line + 5;
+            while(*value == ' ')
+                ++value;
+            while(*value >= '0' && *value <= '9')
+                ++value;
+
+            result->arcSize = parseUInt64(value);
+            found = true;
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    ffStrbufDestroy(&content);
+    return found;
+}
@@ -0,0 +1,152 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <dirent.h>
+
+#ifdef FF_HAVE_SQLITE3
+#include <sqlite3.h>
+#endif
+
+uint32_t ffPackagesCountDirEntries(const char* dirname, unsigned char type)
+{
+    DIR* dirp = opendir(dirname);
+    if(dirp == NULL)
+        return 0;
+
+    uint32_t num_elements = 0;
+
+    struct dirent *entry;
+    while((entry = readdir(dirp)) != NULL) {
+        if(entry->d_type == type)
+            ++num_elements;
+    }
+
+    if(type == DT_DIR)
+        num_elements -= 2; // accounting for . and ..
+
+    closedir(dirp);
+
+    return num_elements;
+}
+
+uint32_t ffPackagesCountSQLite3(FFinstance* instance, const char* path, const char* query, uint32_t numParams, const char* const* params)
+{
+    #ifdef FF_HAVE_SQLITE3
+        if(!ffFileExists(path, S_IFREG))
+            return 0;
+
+        FF_LIBRARY_LOAD(libsqlite3, instance->config.libSQLite3, 0, "libsqlite3.so", "libsqlite3.so.0")
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_open_v2, 0)
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_prepare_v2, 0)
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_bind_text, 0)
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_step, 0)
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_column_int64, 0)
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_finalize, 0)
+        FF_LIBRARY_LOAD_SYMBOL(libsqlite3, sqlite3_close, 0)
+
+        uint32_t count = 0;
+        sqlite3* db = NULL;
+        sqlite3_stmt* stmt = NULL;
+
+        if (ffsqlite3_open_v2(path, &db, SQLITE_OPEN_READONLY, NULL) != SQLITE_OK) goto exit;
+        if (ffsqlite3_prepare_v2(db, query, -1, &stmt, NULL) != SQLITE_OK) goto exit;
+        for (uint32_t i = 0; i < numParams; i++)
+        {
+            if (ffsqlite3_bind_text(stmt, (int) i + 1, params[i], -1, SQLITE_STATIC) != SQLITE_OK) goto exit;
+        }
+        if (ffsqlite3_step(stmt) != SQLITE_ROW) goto exit;
+        count = (uint32_t) ffsqlite3_column_int64(stmt, 0);
+
+    exit:
+        if (stmt) ffsqlite3_finalize(stmt);
+        if (db) ffsqlite3_close(db); //Must be called, even if opening failed
+        dlclose(libsqlite3);
+        return count;
+    #else
+        FF_UNUSED(instance, path, query, numParams, params)
+        return 0;
+    #endif
+}
+
+//Every package in the database starts with a "P:<name>" line
+uint32_t ffDetectPackagesApk(const char* installedFile)
+{
+    FFstrbuf installed;
+    ffStrbufInit(&installed);
+
+    if(!ffAppendFileContent(installedFile, &installed))
+    {
+        ffStrbufDestroy(&installed);
+        return 0;
+    }
+
+    uint32_t count = ffStrbufStartsWithS(&installed, "P:") ? 1 : 0;
+    for(uint32_t i = ffStrbufNextIndexS(&installed, 0, "\nP:"); i < installed.length; i = ffStrbufNextIndexS(&installed, i + 3, "\nP:"))
+        ++count;
+
+    ffStrbufDestroy(&installed);
+    return count;
+}
+
+uint32_t ffDetectPackagesFlatpak(const char* installationDir)
+{
+    FFstrbuf path;
+    ffStrbufInitA(&path, 64);
+    ffStrbufAppendS(&path, installationDir);
+    uint32_t length = path.length;
+
+    ffStrbufAppendS(&path, "/app");
+    uint32_t count = ffPackagesCountDirEntries(path.chars, DT_DIR);
+    ffStrbufSubstrBefore(&path, length);
+
+    ffStrbufAppendS(&path, "/runtime");
+    count += ffPackagesCountDirEntries(path.chars, DT_DIR);
+
+    ffStrbufDestroy(&path);
+    return count;
+}
+
+//Direct references of the store paths of the profiles, like nix-store -q --references prints them.
+//A package referenced by more than one profile is counted once
+uint32_t ffDetectPackagesNix(FFinstance* instance, const char* dbFile, uint32_t numProfiles, const char* const* profiles)
+{
+    char** storePaths = calloc(numProfiles, sizeof(char*));
+    uint32_t numStorePaths = 0;
+
+    FFstrbuf query;
+    ffStrbufInitA(&query, 192);
+    ffStrbufAppendS(&query, "SELECT count(DISTINCT reference) FROM Refs WHERE referrer != reference AND referrer IN (SELECT id FROM ValidPaths WHERE path IN (");
+
+    //Profiles can link to the same store path, e.g. the user profile of root is the default one
+    for(uint32_t i = 0; i < numProfiles; i++)
+    {
+        char* storePath = realpath(profiles[i], NULL);
+
+        for(uint32_t k = 0; k < numStorePaths && storePath != NULL; k++)
+        {
+            if(strcmp(storePaths[k], storePath) == 0)
+            {
+                free(storePath);
+                storePath = NULL;
+            }
+        }
+
+        if(storePath == NULL)
+            continue;
+
+        ffStrbufAppendS(&query, numStorePaths == 0 ? "?" : ", ?");
+        storePaths[numStorePaths++] = storePath;
+    }
+
+    ffStrbufAppendS(&query, "))");
+
+    uint32_t count = numStorePaths > 0 ? ffPackagesCountSQLite3(instance, dbFile, query.chars, numStorePaths, (const char* const*) storePaths) : 0;
+
+    for(uint32_t i = 0; i < numStorePaths; i++)
+        free(storePaths[i]);
+    free(storePaths);
+    ffStrbufDestroy(&query);
+
+    return count;
+}
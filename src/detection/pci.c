@@ -0,0 +1,438 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#define FF_PCI_IDS_MAGIC "FFPCIIDS"
+#define FF_PCI_IDS_VERSION 1
+
+//Where distributions install pci.ids. The first one which exists is used
+static const char* pciIdsPaths[] = {
+    "/usr/share/hwdata/pci.ids",
+    "/usr/share/misc/pci.ids",
+    "/usr/share/pci.ids",
+    "/usr/local/share/pci.ids",
+    "/var/lib/pciutils/pci.ids"
+};
+
+//The index is a header, the vendors sorted by id, the devices sorted by id per vendor and the NUL terminated names.
+//Everything is aligned to its size, so the mmap'd file can be used as is
+typedef struct FFPCIIdsHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t numVendors;
+    uint32_t numDevices;
+    uint32_t stringsSize;
+    uint64_t sourceSize; //Size and mtime of pci.ids when the index was built
+    int64_t sourceMtime;
+} FFPCIIdsHeader;
+
+typedef struct FFPCIIdsVendor
+{
+    uint16_t id;
+    uint16_t padding;
+    uint32_t name; //Offset into the strings
+    uint32_t firstDevice;
+    uint32_t numDevices;
+} FFPCIIdsVendor;
+
+typedef struct FFPCIIdsDevice
+{
+    uint16_t id;
+    uint16_t padding;
+    uint32_t name;
+} FFPCIIdsDevice;
+
+//"0000:01:00.0" as a sortable number
+static uint64_t parseAddress(const char* name)
+{
+    unsigned int domain, bus, device, function;
+    if(sscanf(name, "%x:%x:%x.%x", &domain, &bus, &device, &function) != 4)
+        return UINT64_MAX;
+    return (uint64_t) domain << 32 | (uint64_t) bus << 16 | (uint64_t) device << 8 | (uint64_t) function;
+}
+
+static int compareDevices(const void* a, const void* b)
+{
+    uint64_t addressA = ((const FFPCIDevice*) a)->address;
+    uint64_t addressB = ((const FFPCIDevice*) b)->address;
+    return addressA < addressB ? -1 : addressA > addressB;
+}
+
+void ffPCIDevicesDestroy(FFlist* devices)
+{
+    FF_LIST_FOR_EACH(FFPCIDevice, device, devices)
+        ffStrbufDestroy(&device->driver);
+    ffListDestroy(devices);
+}
+
+bool ffDetectPCIDisplayDevices(const char* devicesDir, FFlist* devices)
+{
+    ffListInit(devices, sizeof(FFPCIDevice));
+
+    int dirfd = open(devicesDir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(dirfd == -1)
+        return false;
+
+    DIR* dir = fdopendir(dirfd);
+    if(dir == NULL)
+    {
+        close(dirfd);
+        return false;
+    }
+
+    struct dirent* entry;
+    while((entry = readdir(dir)) != NULL)
+    {
+        if(entry->d_name[0] == '.')
+            continue;
+
+        //The entries are symlinks to the device directories
+        int deviceFd = openat(dirfd, entry->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(deviceFd == -1)
+            continue;
+
+        //Base class 0x03 is display controller: VGA, XGA and 3D controllers
+        uint32_t deviceClass, vendorId, deviceId;
+        if(
+            !ffReadUIntAt(deviceFd, "class", 16, &deviceClass) ||
+            (deviceClass >> 16) != 0x03 ||
+            !ffReadUIntAt(deviceFd, "vendor", 16, &vendorId) ||
+            !ffReadUIntAt(deviceFd, "device", 16, &deviceId)
+        ) {
+            close(deviceFd);
+            continue;
+        }
+
+        FFPCIDevice* device = FF_LIST_ADD(FFPCIDevice, devices);
+        device->address = parseAddress(entry->d_name);
+        device->vendorId = (uint16_t) vendorId;
+        device->deviceId = (uint16_t) deviceId;
+        device->deviceClass = deviceClass;
+        ffStrbufInit(&device->driver);
+
+        char driver[256];
+        ssize_t length = readlinkat(deviceFd, "driver", driver, sizeof(driver) - 1);
+        if(length > 0)
+        {
+            driver[length] = '\0';
+            const char* name = strrchr(driver, '/');
+            ffStrbufAppendS(&device->driver, name == NULL ? driver : name + 1);
+        }
+
+        close(deviceFd);
+    }
+
+    closedir(dir);
+
+    //Same order as lspci, so the indexes of the GPUs are stable
+    qsort(ffListData(devices), devices->length, sizeof(FFPCIDevice), compareDevices);
+    return true;
+}
+
+//Parses 4 hex digits followed by two spaces, the format of the ids in pci.ids
+static bool parseId(const char* line, uint16_t* id)
+{
+    uint32_t result = 0;
+    for(uint32_t i = 0; i < 4; i++)
+    {
+        char c = line[i];
+        uint32_t digit;
+        if(c >= '0' && c <= '9')
+            digit = (uint32_t) (c - '0');
+        else if(c >= 'a' && c <= 'f')
+            digit = (uint32_t) (c - 'a' + 10);
+        else if(c >= 'A' && c <= 'F')
+            digit = (uint32_t) (c - 'A' + 10);
+        else
+            return false;
+        result = result << 4 | digit;
+    }
+
+    if(line[4] != ' ' || line[5] != ' ')
+        return false;
+
+    *id = (uint16_t) result;
+    return true;
+}
+
+static int compareVendors(const void* a, const void* b)
+{
+    return (int) ((const FFPCIIdsVendor*) a)->id - (int) ((const FFPCIIdsVendor*) b)->id;
+}
+
+static int compareIdsDevices(const void* a, const void* b)
+{
+    return (int) ((const FFPCIIdsDevice*) a)->id - (int) ((const FFPCIIdsDevice*) b)->id;
+}
+
+static uint32_t appendName(FFstrbuf* strings, const char* name, uint32_t length)
+{
+    uint32_t offset = strings->length;
+    ffStrbufAppendNS(strings, length, name);
+    ffStrbufAppendC(strings, '\0'); //Increases the length, the names are separated by it
+    return offset;
+}
+
+bool ffPCIIdsBuild(const char* pciIdsFile, FFPCIIds* ids)
+{
+    ids->data = NULL;
+    ids->size = 0;
+    ids->mapped = false;
+
+    FFstrbuf content;
+    ffStrbufInitA(&content, 1 << 21);
+    struct stat st;
+    if(stat(pciIdsFile, &st) != 0 || !ffAppendFileContent(pciIdsFile, &content))
+    {
+        ffStrbufDestroy(&content);
+        return false;
+    }
+
+    FFlist vendors, devices;
+    ffListInitA(&vendors, sizeof(FFPCIIdsVendor), 4096);
+    ffListInitA(&devices, sizeof(FFPCIIdsDevice), 1 << 16);
+
+    FFstrbuf strings;
+    ffStrbufInitA(&strings, 1 << 20);
+
+    FFPCIIdsVendor* vendor = NULL;
+
+    for(uint32_t start = 0; start < content.length;)
+    {
+        uint32_t end = ffStrbufNextIndexC(&content, start, '\n');
+        const char* line = content.chars + start;
+        uint32_t length = end - start;
+        start = end + 1;
+
+        uint16_t id;
+
+        //Vendors are "1002  Advanced Micro Devices, Inc. [AMD/ATI]", their devices "\t67df  Ellesmere [Radeon RX 470/480/570/570X/580/580X/590]".
+        //Subsystems have two tabs and aren't needed
+        if(length > 6 && parseId(line, &id))
+        {
+            vendor = FF_LIST_ADD(FFPCIIdsVendor, &vendors);
+            vendor->id = id;
+            vendor->padding = 0;
+            vendor->name = appendName(&strings, line + 6, length - 6);
+            vendor->firstDevice = devices.length;
+            vendor->numDevices = 0;
+        }
+        else if(length > 7 && line[0] == '\t' && vendor != NULL && parseId(line + 1, &id))
+        {
+            FFPCIIdsDevice* device = FF_LIST_ADD(FFPCIIdsDevice, &devices);
+            device->id = id;
+            device->padding = 0;
+            device->name = appendName(&strings, line + 7, length - 7);
+            ++vendor->numDevices;
+        }
+        else if(line[0] == 'C' && line[1] == ' ')
+            break; //The device classes follow, which aren't needed
+    }
+
+    ffStrbufDestroy(&content);
+
+    //pci.ids is sorted, but don't rely on it. The device ranges stay valid when the vendors are moved
+    FF_LIST_FOR_EACH(FFPCIIdsVendor, v, &vendors)
+        qsort(FF_LIST_GET(FFPCIIdsDevice, &devices, v->firstDevice), v->numDevices, sizeof(FFPCIIdsDevice), compareIdsDevices);
+    qsort(ffListData(&vendors), vendors.length, sizeof(FFPCIIdsVendor), compareVendors);
+
+    FFPCIIdsHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FF_PCI_IDS_MAGIC, sizeof(header.magic));
+    header.version = FF_PCI_IDS_VERSION;
+    header.numVendors = vendors.length;
+    header.numDevices = devices.length;
+    header.stringsSize = strings.length;
+    header.sourceSize = (uint64_t) st.st_size;
+    header.sourceMtime = (int64_t) st.st_mtime;
+
+    size_t vendorsSize = sizeof(FFPCIIdsVendor) * vendors.length;
+    size_t devicesSize = sizeof(FFPCIIdsDevice) * devices.length;
+    ids->size = sizeof(header) + vendorsSize + devicesSize + strings.length;
+
+    uint8_t* data = malloc(ids->size);
+    memcpy(data, &header, sizeof(header));
+    memcpy(data + sizeof(header), ffListData(&vendors), vendorsSize);
+    memcpy(data + sizeof(header) + vendorsSize, ffListData(&devices), devicesSize);
+    memcpy(data + sizeof(header) + vendorsSize + devicesSize, strings.chars, strings.length);
+    ids->data = data;
+
+    ffListDestroy(&vendors);
+    ffListDestroy(&devices);
+    ffStrbufDestroy(&strings);
+    return true;
+}
+
+bool ffPCIIdsWrite(const FFPCIIds* ids, const char* indexFile)
+{
+    //Written to a temporary file first, a concurrent fastfetch may mmap the old index right now
+    FFstrbuf tempFile;
+    ffStrbufInitA(&tempFile, 64);
+    ffStrbufAppendS(&tempFile, indexFile);
+    ffStrbufAppendS(&tempFile, ".tmp");
+
+    bool result = false;
+
+    int fd = open(tempFile.chars, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if(fd != -1)
+    {
+        result = write(fd, ids->data, ids->size) == (ssize_t) ids->size;
+        close(fd);
+
+        if(result)
+            result = rename(tempFile.chars, indexFile) == 0;
+        if(!result)
+            unlink(tempFile.chars);
+    }
+
+    ffStrbufDestroy(&tempFile);
+    return result;
+}
+
+//Checks that every offset of the index stays inside of it, so a truncated or foreign file can't be read out of bounds
+static bool validateIndex(const uint8_t* data, size_t size)
+{
+    if(size < sizeof(FFPCIIdsHeader))
+        return false;
+
+    const FFPCIIdsHeader* header = (const FFPCIIdsHeader*) data;
+    if(memcmp(header->magic, FF_PCI_IDS_MAGIC, sizeof(header->magic)) != 0 || header->version != FF_PCI_IDS_VERSION)
+        return false;
+
+    size_t expected = sizeof(FFPCIIdsHeader) +
+        sizeof(FFPCIIdsVendor) * header->numVendors +
+        sizeof(FFPCIIdsDevice) * header->numDevices +
+        header->stringsSize;
+
+    //The strings must end with a NUL, so every name is terminated
+    return expected == size && (header->stringsSize == 0 || data[size - 1] == '\0');
+}
+
+bool ffPCIIdsOpen(const char* indexFile, FFPCIIds* ids)
+{
+    ids->data = NULL;
+    ids->size = 0;
+    ids->mapped = false;
+
+    int fd = open(indexFile, O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        return false;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if(data == MAP_FAILED)
+        return false;
+
+    if(!validateIndex(data, (size_t) st.st_size))
+    {
+        munmap(data, (size_t) st.st_size);
+        return false;
+    }
+
+    ids->data = data;
+    ids->size = (size_t) st.st_size;
+    ids->mapped = true;
+    return true;
+}
+
+void ffPCIIdsClose(FFPCIIds* ids)
+{
+    if(ids->data == NULL)
+        return;
+
+    if(ids->mapped)
+        munmap((void*) ids->data, ids->size);
+    else
+        free((void*) ids->data);
+
+    ids->data = NULL;
+    ids->size = 0;
+}
+
+bool ffPCIIdsOpenCached(FFinstance* instance, FFPCIIds* ids)
+{
+    const char* pciIdsFile = NULL;
+    struct stat st;
+    for(uint32_t i = 0; i < sizeof(pciIdsPaths) / sizeof(pciIdsPaths[0]); i++)
+    {
+        if(stat(pciIdsPaths[i], &st) == 0)
+        {
+            pciIdsFile = pciIdsPaths[i];
+            break;
+        }
+    }
+
+    if(pciIdsFile == NULL)
+    {
+        ids->data = NULL;
+        ids->size = 0;
+        ids->mapped = false;
+        return false;
+    }
+
+    FFstrbuf indexFile;
+    ffStrbufInitA(&indexFile, 64);
+    ffGetCacheFilePath(instance, "pciids", "ffi", &indexFile);
+
+    //The index is rebuilt whenever pci.ids is updated
+    if(!instance->config.recache && ffPCIIdsOpen(indexFile.chars, ids))
+    {
+        const FFPCIIdsHeader* header = (const FFPCIIdsHeader*) ids->data;
+        if(header->sourceSize == (uint64_t) st.st_size && header->sourceMtime == (int64_t) st.st_mtime)
+        {
+            ffStrbufDestroy(&indexFile);
+            return true;
+        }
+        ffPCIIdsClose(ids);
+    }
+
+    bool result = ffPCIIdsBuild(pciIdsFile, ids);
+    if(result && instance->config.cacheSave)
+        ffPCIIdsWrite(ids, indexFile.chars);
+
+    ffStrbufDestroy(&indexFile);
+    return result;
+}
+
+bool ffPCIIdsLookup(const FFPCIIds* ids, uint16_t vendorId, uint16_t deviceId, FFstrbuf* vendorName, FFstrbuf* deviceName)
+{
+    if(ids->data == NULL)
+        return false;
+
+    const FFPCIIdsHeader* header = (const FFPCIIdsHeader*) ids->data;
+    const FFPCIIdsVendor* vendors = (const FFPCIIdsVendor*) (header + 1);
+    const FFPCIIdsDevice* devices = (const FFPCIIdsDevice*) (vendors + header->numVendors);
+    const char* strings = (const char*) (devices + header->numDevices);
+
+    FFPCIIdsVendor vendorKey = {.id = vendorId};
+    const FFPCIIdsVendor* vendor = bsearch(&vendorKey, vendors, header->numVendors, sizeof(FFPCIIdsVendor), compareVendors);
+    if(vendor == NULL || vendor->name >= header->stringsSize)
+        return false;
+
+    ffStrbufAppendS(vendorName, strings + vendor->name);
+
+    if(vendor->firstDevice > header->numDevices || vendor->numDevices > header->numDevices - vendor->firstDevice)
+        return true;
+
+    FFPCIIdsDevice deviceKey = {.id = deviceId};
+    const FFPCIIdsDevice* device = bsearch(&deviceKey, devices + vendor->firstDevice, vendor->numDevices, sizeof(FFPCIIdsDevice), compareIdsDevices);
+    if(device != NULL && device->name < header->stringsSize)
+        ffStrbufAppendS(deviceName, strings + device->name);
+
+    return true;
+}
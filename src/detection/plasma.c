@@ -13,21 +13,19 @@ typedef enum PlasmaCategory
 
 static bool detectFromConfigFile(const FFstrbuf* filename, FFPlasmaResult* result)
 {
-    FILE* kdeglobals = fopen(filename->chars, "r");
+    const FFstrbuf* kdeglobals = ffReadFileCached(filename->chars);
     if(kdeglobals == NULL)
         return false;
 
-    char* line = NULL;
-    size_t len = 0;
-
     PlasmaCategory category = PLASMA_CATEGORY_OTHER;
 
-    while(getline(&line, &len, kdeglobals) != -1)
+    const char* line = kdeglobals->chars;
+    while(line != NULL && *line != '\0')
     {
         if(line[0] == '[')
         {
-            char categoryName[32];
-            sscanf(line, "[%31[^]]", categoryName);
+            char categoryName[32] = {0};
+            sscanf(line, "[%31[^]\n]", categoryName);
 
             if(strcasecmp(categoryName, "General") == 0)
                 category = PLASMA_CATEGORY_GENERAL;
@@ -37,11 +35,8 @@ static bool detectFromConfigFile(const FFstrbuf* filename, FFPlasmaResult* resul
                 category = PLASMA_CATEGORY_ICONS;
             else
                 category = PLASMA_CATEGORY_OTHER;
-
-            continue;
         }
-
-        if(category == PLASMA_CATEGORY_KDE && result->widgetStyle.length == 0)
+        else if(category == PLASMA_CATEGORY_KDE && result->widgetStyle.length == 0)
             ffGetPropValue(line, "widgetStyle =", &result->widgetStyle);
         else if(category == PLASMA_CATEGORY_ICONS && result->icons.length == 0)
             ffGetPropValue(line, "Theme =", &result->icons);
@@ -57,12 +52,12 @@ static bool detectFromConfigFile(const FFstrbuf* filename, FFPlasmaResult* resul
             if(result->font.length == 0)
                 ffGetPropValue(line, "Font =", &result->font);
         }
-    }
 
-    if(line != NULL)
-        free(line);
-
-    fclose(kdeglobals);
+        //The cached content is shared, so we walk through its lines instead of splitting it
+        line = strchr(line, '\n');
+        if(line != NULL)
+            ++line;
+    }
 
     return true;
 }
@@ -98,10 +93,8 @@ const FFPlasmaResult* ffDetectPlasma(FFinstance* instance)
     FFstrbuf baseDirCopy;
     ffStrbufInitA(&baseDirCopy, 64);
 
-    for(uint32_t i = 0; i < instance->state.configDirs.length; i++)
+    FF_LIST_FOR_EACH(FFstrbuf, baseDir, &instance->state.configDirs)
     {
-        FFstrbuf* baseDir = (FFstrbuf*) ffListGet(&instance->state.configDirs, i);
-
         ffStrbufSet(&baseDirCopy, baseDir);
         ffStrbufAppendS(&baseDirCopy, "/kdeglobals");
 
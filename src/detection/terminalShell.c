@@ -7,9 +7,9 @@
 
 static void setExeName(FFstrbuf* exe, const char** exeName)
 {
+    //Always set it, exe may have been reallocated since the pointer was set
     uint32_t lastSlashIndex = ffStrbufLastIndexC(exe, '/');
-    if(lastSlashIndex < exe->length)
-        *exeName = exe->chars + lastSlashIndex + 1;
+    *exeName = lastSlashIndex < exe->length ? exe->chars + lastSlashIndex + 1 : exe->chars;
 }
 
 static void getProcessInformation(const char* pid, FFstrbuf* processName, FFstrbuf* exe, const char** exeName)
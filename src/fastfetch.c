@@ -1,4 +1,5 @@
 #include "fastfetch.h"
+#include "options/list.h"
 
 #include <string.h>
 #include <malloc.h>
@@ -7,6 +8,9 @@
 #include <fcntl.h>
 #include <dirent.h>
 
+//Generated at build time from options/list.h by options/generator.c
+#include "fastfetch_options.h"
+
 // Things only needed by fastfetch
 typedef struct FFdata
 {
@@ -14,7 +18,6 @@ typedef struct FFdata
     FFstrbuf structure;
     FFstrbuf logoName;
     FFstrbuf logoColors[FASTFETCH_LOGO_MAX_COLORS];
-    bool multithreading;
 } FFdata;
 
 static void constructAndPrintCommandHelpFormat(const char* name, const char* def, uint32_t numArgs, ...)
@@ -95,7 +98,7 @@ static inline void printCommandHelp(const char* command)
     }
     else if(strcasecmp(command, "packages-format") == 0)
     {
-        constructAndPrintCommandHelpFormat("packages", "{2} (pacman){?3}[{3}]{?}, {4} (dpkg), {5} (rpm), {6} (emerge), {7} (xps), {8}, (flatpak), {9} (snap)", 9,
+        constructAndPrintCommandHelpFormat("packages", "{2} (pacman){?3}[{3}]{?}, {4} (dpkg), {5} (rpm), {6} (emerge), {7} (xps), {8}, (flatpak), {9} (snap), {10} (apk), {11} (nix)", 11,
             "Number of all packages",
             "Number of pacman packages",
             "Pacman branch on manjaro",
@@ -103,8 +106,10 @@ static inline void printCommandHelp(const char* command)
             "Number of rpm packages",
             "Number of emerge packages",
             "Number of xbps packages",
-            "Number of flatpak packages",
-            "Number of snap packages"
+            "Number of flatpak apps and runtimes",
+            "Number of snap packages",
+            "Number of apk packages",
+            "Number of nix packages"
         );
     }
     else if(strcasecmp(command, "shell-format") == 0)
@@ -224,7 +229,7 @@ static inline void printCommandHelp(const char* command)
     }
     else if(strcasecmp(command, "cpu-format") == 0)
     {
-        constructAndPrintCommandHelpFormat("cpu", "{2} ({7}) @ {14}GHz", 14,
+        constructAndPrintCommandHelpFormat("cpu", "{2} ({7}) @ {14}GHz", 24,
             "CPU name",
             "Prettified CPU name",
             "CPU Vendor name (Vendor ID)",
@@ -238,13 +243,24 @@ static inline void printCommandHelp(const char* command)
             "frequency info max",
             "frequency info min",
             "frequeny from /proc/cpuinfo",
-            "most accurate frequeny"
+            "most accurate frequeny",
+            "CPU family",
+            "CPU model",
+            "CPU stepping",
+            "CPU socket count",
+            "CPU cluster count",
+            "L1 data cache size in KiB",
+            "L1 instruction cache size in KiB",
+            "L2 cache size in KiB",
+            "L3 cache size in KiB",
+            "max frequency of every cpufreq policy"
         );
     }
     else if(strcasecmp(command, "cpu-usage-format") == 0)
     {
-        constructAndPrintCommandHelpFormat("cpu-usage", "{0}%", 1,
-            "CPU usage without percent mark"
+        constructAndPrintCommandHelpFormat("cpu-usage", "{1}%", 2,
+            "CPU usage without percent mark",
+            "Usage of every cpu without percent mark"
         );
     }
     else if(strcasecmp(command, "gpu-format") == 0)
@@ -259,19 +275,40 @@ static inline void printCommandHelp(const char* command)
     }
     else if(strcasecmp(command, "memory-format") == 0)
     {
-        constructAndPrintCommandHelpFormat("memory", "{}MiB / {}MiB ({}%)", 3,
+        constructAndPrintCommandHelpFormat("memory", "{}MiB / {}MiB ({}%)", 13,
             "Used memory",
             "Total memory",
-            "Used memory percentage"
+            "Used memory percentage",
+            "Available memory",
+            "Used swap",
+            "Total swap",
+            "Used swap percentage",
+            "Total huge pages",
+            "Free huge pages",
+            "Huge page size in KiB",
+            "Zswap pool size",
+            "Memory stored in zswap",
+            "ZFS ARC size"
         );
     }
     else if(strcasecmp(command, "disk-format") == 0)
     {
-        constructAndPrintCommandHelpFormat("disk", "{}GB / {}GB ({4}%)", 4,
-            "Used disk space",
-            "Total disk space",
+        constructAndPrintCommandHelpFormat("disk", "{5} / {6} ({4}%), with sizes in the largest fitting binary unit", 8,
+            "Used disk space in GiB",
+            "Total disk space in GiB",
             "Number of files",
-            "Used disk space percentage"
+            "Used disk space percentage",
+            "Used disk space in bytes",
+            "Total disk space in bytes",
+            "Filesystem type",
+            "Folder or mount path"
+        );
+    }
+    else if(strcasecmp(command, "disk-io-format") == 0)
+    {
+        constructAndPrintCommandHelpFormat("disk-io", "{1} MiB/s (read), {2} MiB/s (write)", 2,
+            "Bytes read per second in MiB",
+            "Bytes written per second in MiB"
         );
     }
     else if(strcasecmp(command, "battery-format") == 0)
@@ -292,8 +329,16 @@ static inline void printCommandHelp(const char* command)
     }
     else if(strcasecmp(command, "local-ip-format") == 0)
     {
-        constructAndPrintCommandHelpFormat("local-ip", "{}", 1,
-            "Local IP address"
+        constructAndPrintCommandHelpFormat("local-ip", "{}", 2,
+            "Local IP address",
+            "Interface name"
+        );
+    }
+    else if(strcasecmp(command, "net-io-format") == 0)
+    {
+        constructAndPrintCommandHelpFormat("net-io", "{1} MiB/s (received), {2} MiB/s (sent)", 2,
+            "Bytes received per second in MiB",
+            "Bytes sent per second in MiB"
         );
     }
     else if(strcasecmp(command, "public-ip-format") == 0)
@@ -579,325 +624,240 @@ static void optionParseColor(const char* key, const char* value, FFstrbuf* buffe
     }
 }
 
-static void parseOption(FFinstance* instance, FFdata* data, const char* key, const char* value)
+typedef enum FFoptionType
 {
-    if(strcasecmp(key, "-h") == 0 || strcasecmp(key, "--help") == 0)
-    {
-        printCommandHelp(value);
-        exit(0);
-    }
-    else if(strcasecmp(key, "-v") == 0 || strcasecmp(key, "--version") == 0)
-    {
-        puts(FASTFETCH_PROJECT_NAME" "FASTFETCH_PROJECT_VERSION);
-        exit(0);
-    }
-    else if(strcasecmp(key, "--list-logos") == 0)
-    {
-        ffListLogos();
-        exit(0);
-    }
-    else if(strcasecmp(key, "--list-logos-autocompletion") == 0)
-    {
-        ffListLogosForAutocompletion();
-        exit(0);
-    }
-    else if(strcasecmp(key, "--print-logos") == 0)
-    {
-        ffPrintLogos(instance);
-        exit(0);
-    }
-    else if(strcasecmp(key, "--print-config") == 0)
-    {
-        fputs(FASTFETCH_DATATEXT_CONFIG, stdout);
-        exit(0);
-    }
-    else if(strcasecmp(key, "--print-structure") == 0)
-    {
-        puts(FASTFETCH_DATATEXT_STRUCTURE);
-        exit(0);
-    }
-    else if(strcasecmp(key, "--list-modules") == 0)
-    {
-        fputs(FASTFETCH_DATATEXT_MODULES, stdout);
-        exit(0);
-    }
-    else if(strcasecmp(key, "--list-presets") == 0)
-    {
-        listAvailablePresets(instance);
-        exit(0);
-    }
-    else if(strcasecmp(key, "--list-features") == 0)
-    {
-        ffListFeatures();
-        exit(0);
-    }
-    else if(strcasecmp(key, "--spacing") == 0)
-    {
-        if(value == NULL)
-        {
-            fprintf(stderr, "Error: usage: %s <width>\n", key);
-            exit(404);
-        }
-        if(sscanf(value, "%hu", &instance->config.logoKeySpacing) != 1)
-        {
-            fprintf(stderr, "Error: couldn't parse %s to uint16_t\n", value);
-            exit(405);
-        }
-    }
-    else if(strcasecmp(key, "-x") == 0 || strcasecmp(key, "--offsetx") == 0)
-    {
-        if(value == NULL)
-        {
-            fprintf(stderr, "Error: usage: %s <offset>\n", key);
-            exit(408);
-        }
-        if(sscanf(value, "%hi", &instance->config.offsetx) != 1)
-        {
-            fprintf(stderr, "Error: couldn't parse %s to int16_t\n", value);
-            exit(409);
-        }
-    }
-    else if(strcasecmp(key, "--set") == 0)
-    {
-        if(value == NULL)
-        {
-            fprintf(stderr, "Error: usage: %s <key=value>\n", key);
-            exit(411);
-        }
+    FF_OPTION_TYPE_HELP,
+    FF_OPTION_TYPE_VERSION,
+    FF_OPTION_TYPE_LIST_LOGOS,
+    FF_OPTION_TYPE_LIST_LOGOS_AUTOCOMPLETION,
+    FF_OPTION_TYPE_PRINT_LOGOS,
+    FF_OPTION_TYPE_PRINT_CONFIG,
+    FF_OPTION_TYPE_PRINT_STRUCTURE,
+    FF_OPTION_TYPE_LIST_MODULES,
+    FF_OPTION_TYPE_LIST_PRESETS,
+    FF_OPTION_TYPE_LIST_FEATURES,
+    FF_OPTION_TYPE_SPACING,
+    FF_OPTION_TYPE_OFFSETX,
+    FF_OPTION_TYPE_SET,
+    FF_OPTION_TYPE_RECACHE,
+    FF_OPTION_TYPE_NOCACHE,
+    FF_OPTION_TYPE_LOAD_CONFIG,
+    FF_OPTION_TYPE_OUTPUT_FORMAT,
+    FF_OPTION_TYPE_TIMEOUT,
+    FF_OPTION_TYPE_STRING,
+    FF_OPTION_TYPE_COLOR,
+    FF_OPTION_TYPE_BOOL
+} FFoptionType;
+
+typedef enum FFoptionTarget
+{
+    FF_OPTION_TARGET_NONE,
+    FF_OPTION_TARGET_CONFIG,
+    FF_OPTION_TARGET_DATA
+} FFoptionTarget;
 
-        char* separator = strchr(value, '=');
+typedef struct FFoption
+{
+    FFoptionType type;
+    FFoptionTarget target;
+    size_t offset; //Of the field in FFconfig or FFdata the option sets
+} FFoption;
+
+#define FF_OPTION_OFFSET_NONE(field) 0
+#define FF_OPTION_OFFSET_CONFIG(field) offsetof(FFconfig, field)
+#define FF_OPTION_OFFSET_DATA(field) offsetof(FFdata, field)
+#define FF_OPTION(name, type, target, field) {FF_OPTION_TYPE_##type, FF_OPTION_TARGET_##target, FF_OPTION_OFFSET_##target(field)},
+#define FF_MODULE(id, name, alias, option, print, detectors, cache, numFormatArgs) \
+    {FF_OPTION_TYPE_STRING, FF_OPTION_TARGET_CONFIG, FF_OPTION_OFFSET_CONFIG(modules[FF_MODULE_ID_##id].format)}, \
+    {FF_OPTION_TYPE_STRING, FF_OPTION_TARGET_CONFIG, FF_OPTION_OFFSET_CONFIG(modules[FF_MODULE_ID_##id].key)},
+
+//Same order as the option generator, optionNameTable stores indices into it:
+//the option list, then the format and key option of every module. Modules without options have unreachable entries
+static const FFoption options[FF_OPTION_COUNT] = { FF_OPTION_LIST FF_MODULE_LIST };
+
+#undef FF_MODULE
+#undef FF_OPTION
+#undef FF_OPTION_OFFSET_DATA
+#undef FF_OPTION_OFFSET_CONFIG
+#undef FF_OPTION_OFFSET_NONE
+
+static const FFoption* getOption(const char* key)
+{
+    uint32_t slot = ffPerfectHashGetSlot(key, optionNameDisplacements, FF_OPTION_NAME_TABLE_SIZE);
 
-        if(separator == NULL)
-        {
-            fprintf(stderr, "Error: usage: %s <key=value>, '=' missing\n", key);
-            exit(412);
-        }
+    if(optionNameTable[slot].name == NULL || strcasecmp(optionNameTable[slot].name, key) != 0)
+        return NULL;
 
-        *separator = '\0';
+    return &options[optionNameTable[slot].value];
+}
 
-        ffValuestoreSet(&data->valuestore, value, separator + 1);
-    }
-    else if(strcasecmp(key, "-r") == 0 || strcasecmp(key, "--recache") == 0)
-    {
-        //Set cacheSave as well, beacuse the user expects the values to be cached when expliciting using --recache
-        instance->config.recache = optionParseBoolean(value);
-        instance->config.cacheSave = instance->config.recache;
-    }
-    else if(strcasecmp(key, "--nocache") == 0)
-    {
-        instance->config.recache = optionParseBoolean(value);
-        instance->config.cacheSave = false;
-    }
-    else if(strcasecmp(key, "--load-config") == 0)
-        optionParseConfigFile(instance, data, key, value);
-    else if(strcasecmp(key, "--show-errors") == 0)
-        instance->config.showErrors = optionParseBoolean(value);
-    else if(strcasecmp(key, "--color-logo") == 0)
-        instance->config.colorLogo = optionParseBoolean(value);
-    else if(strcasecmp(key, "--print-remaining-logo") == 0)
-        instance->config.printRemainingLogo = optionParseBoolean(value);
-    else if(strcasecmp(key, "--multithreading") == 0)
-        data->multithreading = optionParseBoolean(value);
-    else if(strcasecmp(key, "--allow-slow-operations") == 0)
-        instance->config.allowSlowOperations = optionParseBoolean(value);
-    else if(strcasecmp(key, "--disable-linewrap") == 0)
-        instance->config.disableLinewrap = optionParseBoolean(value);
-    else if(strcasecmp(key, "--hide-cursor") == 0)
-        instance->config.hideCursor = optionParseBoolean(value);
-    else if(strcasecmp(key, "--logo-raw") == 0)
-        instance->config.userLogoIsRaw = optionParseBoolean(value);
-    else if(strcasecmp(key, "--structure") == 0)
-        optionParseString(key, value, &data->structure);
-    else if(strcasecmp(key, "-l") == 0 || strcasecmp(key, "--logo") == 0)
-        optionParseString(key, value, &data->logoName);
-    else if(strcasecmp(key, "-s") == 0 || strcasecmp(key, "--separator") == 0)
-        optionParseString(key, value, &instance->config.separator);
-    else if(strcasecmp(key, "-c") == 0 || strcasecmp(key, "--color") == 0)
-        optionParseColor(key, value, &instance->config.color);
-    else if(strcasecmp(key, "--os-format") == 0)
-        optionParseString(key, value, &instance->config.osFormat);
-    else if(strcasecmp(key, "--os-key") == 0)
-        optionParseString(key, value, &instance->config.osKey);
-    else if(strcasecmp(key, "--host-format") == 0)
-        optionParseString(key, value, &instance->config.hostFormat);
-    else if(strcasecmp(key, "--host-key") == 0)
-        optionParseString(key, value, &instance->config.hostKey);
-    else if(strcasecmp(key, "--kernel-format") == 0)
-        optionParseString(key, value, &instance->config.kernelFormat);
-    else if(strcasecmp(key, "--kernel-key") == 0)
-        optionParseString(key, value, &instance->config.kernelKey);
-    else if(strcasecmp(key, "--uptime-format") == 0)
-        optionParseString(key, value, &instance->config.uptimeFormat);
-    else if(strcasecmp(key, "--uptime-key") == 0)
-        optionParseString(key, value, &instance->config.uptimeKey);
-    else if(strcasecmp(key, "--processes-format") == 0)
-        optionParseString(key, value, &instance->config.processesFormat);
-    else if(strcasecmp(key, "--processes-key") == 0)
-        optionParseString(key, value, &instance->config.processesKey);
-    else if(strcasecmp(key, "--packages-format") == 0)
-        optionParseString(key, value, &instance->config.packagesFormat);
-    else if(strcasecmp(key, "--packages-key") == 0)
-        optionParseString(key, value, &instance->config.packagesKey);
-    else if(strcasecmp(key, "--shell-format") == 0)
-        optionParseString(key, value, &instance->config.shellFormat);
-    else if(strcasecmp(key, "--shell-key") == 0)
-        optionParseString(key, value, &instance->config.shellKey);
-    else if(strcasecmp(key, "--resolution-format") == 0)
-        optionParseString(key, value, &instance->config.resolutionFormat);
-    else if(strcasecmp(key, "--resolution-key") == 0)
-        optionParseString(key, value, &instance->config.resolutionKey);
-    else if(strcasecmp(key, "--de-format") == 0)
-        optionParseString(key, value, &instance->config.deFormat);
-    else if(strcasecmp(key, "--de-key") == 0)
-        optionParseString(key, value, &instance->config.deKey);
-    else if(strcasecmp(key, "--wm-format") == 0)
-        optionParseString(key, value, &instance->config.wmFormat);
-    else if(strcasecmp(key, "--wm-key") == 0)
-        optionParseString(key, value, &instance->config.wmKey);
-    else if(strcasecmp(key, "--wm-theme-format") == 0)
-        optionParseString(key, value, &instance->config.wmThemeFormat);
-    else if(strcasecmp(key, "--wm-theme-key") == 0)
-        optionParseString(key, value, &instance->config.wmThemeKey);
-    else if(strcasecmp(key, "--theme-format") == 0)
-        optionParseString(key, value, &instance->config.themeFormat);
-    else if(strcasecmp(key, "--theme-key") == 0)
-        optionParseString(key, value, &instance->config.themeKey);
-    else if(strcasecmp(key, "--icons-format") == 0)
-        optionParseString(key, value, &instance->config.iconsFormat);
-    else if(strcasecmp(key, "--icons-key") == 0)
-        optionParseString(key, value, &instance->config.iconsKey);
-    else if(strcasecmp(key, "--font-format") == 0)
-        optionParseString(key, value, &instance->config.fontFormat);
-    else if(strcasecmp(key, "--font-key") == 0)
-        optionParseString(key, value, &instance->config.fontKey);
-    else if(strcasecmp(key, "--cursor-key") == 0)
-        optionParseString(key, value, &instance->config.cursorKey);
-    else if(strcasecmp(key, "--cursor-format") == 0)
-        optionParseString(key, value, &instance->config.cursorFormat);
-    else if(strcasecmp(key, "--terminal-format") == 0)
-        optionParseString(key, value, &instance->config.terminalFormat);
-    else if(strcasecmp(key, "--terminal-key") == 0)
-        optionParseString(key, value, &instance->config.terminalKey);
-    else if(strcasecmp(key, "--terminal-font-format") == 0)
-        optionParseString(key, value, &instance->config.termFontFormat);
-    else if(strcasecmp(key, "--terminal-font-key") == 0)
-        optionParseString(key, value, &instance->config.termFontKey);
-    else if(strcasecmp(key, "--cpu-format") == 0)
-        optionParseString(key, value, &instance->config.cpuFormat);
-    else if(strcasecmp(key, "--cpu-usage-format") == 0)
-        optionParseString(key, value, &instance->config.cpuUsageFormat);
-    else if(strcasecmp(key, "--cpu-key") == 0)
-        optionParseString(key, value, &instance->config.cpuKey);
-    else if(strcasecmp(key, "--cpu-usage-key") == 0)
-        optionParseString(key, value, &instance->config.cpuUsageKey);
-    else if(strcasecmp(key, "--gpu-format") == 0)
-        optionParseString(key, value, &instance->config.gpuFormat);
-    else if(strcasecmp(key, "--gpu-key") == 0)
-        optionParseString(key, value, &instance->config.gpuKey);
-    else if(strcasecmp(key, "--memory-format") == 0)
-        optionParseString(key, value, &instance->config.memoryFormat);
-    else if(strcasecmp(key, "--memory-key") == 0)
-        optionParseString(key, value, &instance->config.memoryKey);
-    else if(strcasecmp(key, "--disk-format") == 0)
-        optionParseString(key, value, &instance->config.diskFormat);
-    else if(strcasecmp(key, "--disk-key") == 0)
-        optionParseString(key, value, &instance->config.diskKey);
-    else if(strcasecmp(key, "--battery-format") == 0)
-        optionParseString(key, value, &instance->config.batteryFormat);
-    else if(strcasecmp(key, "--battery-key") == 0)
-        optionParseString(key, value, &instance->config.batteryKey);
-    else if(strcasecmp(key, "--locale-format") == 0)
-        optionParseString(key, value, &instance->config.localeFormat);
-    else if(strcasecmp(key, "--locale-key") == 0)
-        optionParseString(key, value, &instance->config.localeKey);
-    else if(strcasecmp(key, "--local-ip-key") == 0)
-        optionParseString(key, value, &instance->config.localIpKey);
-    else if(strcasecmp(key, "--local-ip-format") == 0)
-        optionParseString(key, value, &instance->config.localIpFormat);
-    else if(strcasecmp(key, "--public-ip-key") == 0)
-        optionParseString(key, value, &instance->config.publicIpKey);
-    else if(strcasecmp(key, "--public-ip-format") == 0)
-        optionParseString(key, value, &instance->config.publicIpFormat);
-    else if(strcasecmp(key, "--player-key") == 0)
-        optionParseString(key, value, &instance->config.playerKey);
-    else if(strcasecmp(key, "--player-format") == 0)
-        optionParseString(key, value, &instance->config.playerFormat);
-    else if(strcasecmp(key, "--song-key") == 0)
-        optionParseString(key, value, &instance->config.songKey);
-    else if(strcasecmp(key, "--song-format") == 0)
-        optionParseString(key, value, &instance->config.songFormat);
-    else if(strcasecmp(key, "--lib-PCI") == 0)
-        optionParseString(key, value, &instance->config.libPCI);
-    else if(strcasecmp(key, "--lib-vulkan") == 0)
-        optionParseString(key, value, &instance->config.libVulkan);
-    else if(strcasecmp(key, "--lib-wayland") == 0)
-        optionParseString(key, value, &instance->config.libWayland);
-    else if(strcasecmp(key, "--lib-xcb-randr") == 0)
-        optionParseString(key, value, &instance->config.libXcbRandr);
-    else if(strcasecmp(key, "--lib-xcb") == 0)
-        optionParseString(key, value, &instance->config.libXcb);
-    else if(strcasecmp(key, "--lib-Xrandr") == 0)
-        optionParseString(key, value, &instance->config.libXrandr);
-    else if(strcasecmp(key, "--lib-X11") == 0)
-        optionParseString(key, value, &instance->config.libX11);
-    else if(strcasecmp(key, "--lib-gio") == 0)
-        optionParseString(key, value, &instance->config.libGIO);
-    else if(strcasecmp(key, "--lib-DConf") == 0)
-        optionParseString(key, value, &instance->config.libDConf);
-    else if(strcasecmp(key, "--lib-dbus") == 0)
-        optionParseString(key, value, &instance->config.libDBus);
-    else if(strcasecmp(key, "--lib-XFConf") == 0)
-        optionParseString(key, value, &instance->config.libXFConf);
-    else if(strcasecmp(key, "--lib-rpm") == 0)
-        optionParseString(key, value, &instance->config.librpm);
-    else if(strcasecmp(key, "--disk-folders") == 0)
-        optionParseString(key, value, &instance->config.diskFolders);
-    else if(strcasecmp(key, "--battery-dir") == 0)
-        optionParseString(key, value, &instance->config.batteryDir);
-    else if(strcasecmp(key, "--separator-string") == 0)
-        optionParseString(key, value, &instance->config.separatorString);
-    else if(strcasecmp(key, "--localip-show-ipv4") == 0)
-        instance->config.localIpShowIpV4 = optionParseBoolean(value);
-    else if(strcasecmp(key, "--localip-show-ipv6") == 0)
-        instance->config.localIpShowIpV6 = optionParseBoolean(value);
-    else if(strcasecmp(key, "--localip-show-loop") == 0)
-        instance->config.localIpShowLoop = optionParseBoolean(value);
-    else if(strcasecmp(key, "--os-file") == 0)
-        optionParseString(key, value, &instance->config.osFile);
-    else if(strcasecmp(key, "--player-name") == 0)
-        optionParseString(key, value, &instance->config.playerName);
-    else if(strcasecmp(key, "--public-ip-timeout") == 0)
+static void* getOptionTarget(FFinstance* instance, FFdata* data, const FFoption* option)
+{
+    if(option->target == FF_OPTION_TARGET_CONFIG)
+        return (char*) &instance->config + option->offset;
+
+    if(option->target == FF_OPTION_TARGET_DATA)
+        return (char*) data + option->offset;
+
+    return NULL;
+}
+
+static void parseOption(FFinstance* instance, FFdata* data, const char* key, const char* value)
+{
+    const FFoption* option = getOption(key);
+
+    if(option == NULL)
     {
-        if(value == NULL)
+        if(strncasecmp(key, "--color-", 7) == 0 && key[8] != '\0' && key[9] == '\0') // matches "--color-*"
         {
-            fprintf(stderr, "Error: usage: %s <value>\n", key);
-            exit(465);
-        }
+            //Map the number to an array index, so that '1' -> 0, '2' -> 1, etc.
+            int index = (int)key[8] - 49;
 
-        if(sscanf(value, "%u", &instance->config.publicIpTimeout) != 1)
-        {
-            fprintf(stderr, "Error: couldn't parse %s to uint32_t\n", value);
-            exit(466);
+            //Match only --color-[1-9]
+            if(index < 0 || index >= FASTFETCH_LOGO_MAX_COLORS)
+            {
+                fprintf(stderr, "Error: invalid --color-[1-9] index: %c\n", key[8]);
+                exit(472);
+            }
+
+            optionParseColor(key, value, &data->logoColors[index]);
+            return;
         }
+
+        fprintf(stderr, "Error: unknown option: %s\n", key);
+        exit(400);
     }
-    else if(strncasecmp(key, "--color-", 7) == 0 && key[8] != '\0' && key[9] == '\0') // matches "--color-*"
-    {
-        //Map the number to an array index, so that '1' -> 0, '2' -> 1, etc.
-        int index = (int)key[8] - 49;
 
-        //Match only --color-[1-9]
-        if(index < 0 || index >= FASTFETCH_LOGO_MAX_COLORS)
+    void* target = getOptionTarget(instance, data, option);
+
+    switch(option->type)
+    {
+        case FF_OPTION_TYPE_HELP:
+            printCommandHelp(value);
+            exit(0);
+        case FF_OPTION_TYPE_VERSION:
+            puts(FASTFETCH_PROJECT_NAME" "FASTFETCH_PROJECT_VERSION);
+            exit(0);
+        case FF_OPTION_TYPE_LIST_LOGOS:
+            ffListLogos();
+            exit(0);
+        case FF_OPTION_TYPE_LIST_LOGOS_AUTOCOMPLETION:
+            ffListLogosForAutocompletion();
+            exit(0);
+        case FF_OPTION_TYPE_PRINT_LOGOS:
+            ffPrintLogos(instance);
+            exit(0);
+        case FF_OPTION_TYPE_PRINT_CONFIG:
+            fputs(FASTFETCH_DATATEXT_CONFIG, stdout);
+            exit(0);
+        case FF_OPTION_TYPE_PRINT_STRUCTURE:
+            puts(FASTFETCH_DATATEXT_STRUCTURE);
+            exit(0);
+        case FF_OPTION_TYPE_LIST_MODULES:
+            fputs(FASTFETCH_DATATEXT_MODULES, stdout);
+            exit(0);
+        case FF_OPTION_TYPE_LIST_PRESETS:
+            listAvailablePresets(instance);
+            exit(0);
+        case FF_OPTION_TYPE_LIST_FEATURES:
+            ffListFeatures();
+            exit(0);
+        case FF_OPTION_TYPE_SPACING:
+            if(value == NULL)
+            {
+                fprintf(stderr, "Error: usage: %s <width>\n", key);
+                exit(404);
+            }
+            if(sscanf(value, "%hu", (uint16_t*) target) != 1)
+            {
+                fprintf(stderr, "Error: couldn't parse %s to uint16_t\n", value);
+                exit(405);
+            }
+            break;
+        case FF_OPTION_TYPE_OFFSETX:
+            if(value == NULL)
+            {
+                fprintf(stderr, "Error: usage: %s <offset>\n", key);
+                exit(408);
+            }
+            if(sscanf(value, "%hi", (int16_t*) target) != 1)
+            {
+                fprintf(stderr, "Error: couldn't parse %s to int16_t\n", value);
+                exit(409);
+            }
+            break;
+        case FF_OPTION_TYPE_SET:
         {
-            fprintf(stderr, "Error: invalid --color-[1-9] index: %c\n", key[8]);
-            exit(472);
+            if(value == NULL)
+            {
+                fprintf(stderr, "Error: usage: %s <key=value>\n", key);
+                exit(411);
+            }
+
+            char* separator = strchr(value, '=');
+
+            if(separator == NULL)
+            {
+                fprintf(stderr, "Error: usage: %s <key=value>, '=' missing\n", key);
+                exit(412);
+            }
+
+            *separator = '\0';
+
+            ffValuestoreSet((FFvaluestore*) target, value, separator + 1);
+            break;
         }
+        case FF_OPTION_TYPE_RECACHE:
+            //Set cacheSave as well, beacuse the user expects the values to be cached when expliciting using --recache
+            instance->config.recache = optionParseBoolean(value);
+            instance->config.cacheSave = instance->config.recache;
+            break;
+        case FF_OPTION_TYPE_NOCACHE:
+            instance->config.recache = optionParseBoolean(value);
+            instance->config.cacheSave = false;
+            break;
+        case FF_OPTION_TYPE_LOAD_CONFIG:
+            optionParseConfigFile(instance, data, key, value);
+            break;
+        case FF_OPTION_TYPE_OUTPUT_FORMAT:
+            if(value == NULL)
+            {
+                fprintf(stderr, "Error: usage: %s <default|json>\n", key);
+                exit(478);
+            }
 
-        optionParseColor(key, value, &data->logoColors[index]);
-    }
-    else
-    {
-        fprintf(stderr, "Error: unknown option: %s\n", key);
-        exit(400);
+            if(strcasecmp(value, "default") == 0)
+                *(FFoutputformat*) target = FF_OUTPUT_FORMAT_DEFAULT;
+            else if(strcasecmp(value, "json") == 0)
+                *(FFoutputformat*) target = FF_OUTPUT_FORMAT_JSON;
+            else
+            {
+                fprintf(stderr, "Error: unknown output format: %s\n", value);
+                exit(479);
+            }
+            break;
+        case FF_OPTION_TYPE_TIMEOUT:
+            if(value == NULL)
+            {
+                fprintf(stderr, "Error: usage: %s <value>\n", key);
+                exit(465);
+            }
+
+            if(sscanf(value, "%u", (uint32_t*) target) != 1)
+            {
+                fprintf(stderr, "Error: couldn't parse %s to uint32_t\n", value);
+                exit(466);
+            }
+            break;
+        case FF_OPTION_TYPE_STRING:
+            optionParseString(key, value, (FFstrbuf*) target);
+            break;
+        case FF_OPTION_TYPE_COLOR:
+            optionParseColor(key, value, (FFstrbuf*) target);
+            break;
+        case FF_OPTION_TYPE_BOOL:
+            *(bool*) target = optionParseBoolean(value);
+            break;
     }
 }
 
@@ -951,85 +911,54 @@ static void parseArguments(FFinstance* instance, FFdata* data, int argc, const c
     }
 }
 
-static void parseStructureCommand(FFinstance* instance, FFdata* data, const char* line)
+//A module of the structure, resolved once before anything is printed
+typedef struct FFstructureEntry
 {
-    const char* setValue = ffValuestoreGet(&data->valuestore, line);
-    if(setValue != NULL)
+    const char* name;
+    const char* customValue; //Set if the name is a key of the value store
+    const FFmodule* module; //NULL if there is no such module
+} FFstructureEntry;
+
+//Splits the structure at colons into entries. Returns the detectors the modules of it need
+static uint32_t resolveStructure(FFdata* data, FFlist* entries)
+{
+    uint32_t detectors = FF_DETECTOR_NONE;
+
+    uint32_t startIndex = 0;
+    while (startIndex < data->structure.length)
     {
-        ffPrintCustom(instance, line, setValue);
-        return;
+        uint32_t colonIndex = ffStrbufNextIndexC(&data->structure, startIndex, ':');
+        data->structure.chars[colonIndex] = '\0';
+
+        FFstructureEntry* entry = ffListAdd(entries);
+        entry->name = data->structure.chars + startIndex;
+        entry->customValue = ffValuestoreGet(&data->valuestore, entry->name);
+        entry->module = entry->customValue == NULL ? ffGetModule(entry->name) : NULL;
+
+        if(entry->module != NULL)
+            detectors |= entry->module->detectors;
+
+        startIndex = colonIndex + 1;
     }
 
-    if(strcasecmp(line, "break") == 0)
-        ffPrintBreak(instance);
-    else if(strcasecmp(line, "title") == 0)
-        ffPrintTitle(instance);
-    else if(strcasecmp(line, "separator") == 0)
-        ffPrintSeparator(instance);
-    else if(strcasecmp(line, "os") == 0)
-        ffPrintOS(instance);
-    else if(strcasecmp(line, "host") == 0)
-        ffPrintHost(instance);
-    else if(strcasecmp(line, "kernel") == 0)
-        ffPrintKernel(instance);
-    else if(strcasecmp(line, "uptime") == 0)
-        ffPrintUptime(instance);
-    else if(strcasecmp(line, "processes") == 0)
-        ffPrintProcesses(instance);
-    else if(strcasecmp(line, "packages") == 0)
-        ffPrintPackages(instance);
-    else if(strcasecmp(line, "shell") == 0)
-        ffPrintShell(instance);
-    else if(strcasecmp(line, "resolution") == 0)
-        ffPrintResolution(instance);
-    else if(strcasecmp(line, "desktopenvironment") == 0 || strcasecmp(line, "de") == 0)
-        ffPrintDesktopEnvironment(instance);
-    else if(strcasecmp(line, "windowmanager") == 0 || strcasecmp(line, "wm") == 0)
-        ffPrintWM(instance);
-    else if(strcasecmp(line, "theme") == 0)
-        ffPrintTheme(instance);
-    else if(strcasecmp(line, "wmtheme") == 0)
-        ffPrintWMTheme(instance);
-    else if(strcasecmp(line, "icons") == 0)
-        ffPrintIcons(instance);
-    else if(strcasecmp(line, "font") == 0)
-        ffPrintFont(instance);
-    else if(strcasecmp(line, "cursor") == 0)
-        ffPrintCursor(instance);
-    else if(strcasecmp(line, "terminal") == 0)
-        ffPrintTerminal(instance);
-    else if(strcasecmp(line, "terminalfont") == 0)
-        ffPrintTerminalFont(instance);
-    else if(strcasecmp(line, "cpu") == 0)
-        ffPrintCPU(instance);
-    else if(strcasecmp(line, "cpuusage") == 0)
-        ffPrintCPUUsage(instance);
-    else if(strcasecmp(line, "gpu") == 0)
-        ffPrintGPU(instance);
-    else if(strcasecmp(line, "memory") == 0)
-        ffPrintMemory(instance);
-    else if(strcasecmp(line, "disk") == 0)
-        ffPrintDisk(instance);
-    else if(strcasecmp(line, "battery") == 0)
-        ffPrintBattery(instance);
-    else if(strcasecmp(line, "locale") == 0)
-        ffPrintLocale(instance);
-    else if(strcasecmp(line, "localip") == 0)
-        ffPrintLocalIp(instance);
-    else if(strcasecmp(line, "publicip") == 0)
-        ffPrintPublicIp(instance);
-    else if(strcasecmp(line, "player") == 0)
-        ffPrintPlayer(instance);
-    else if(strcasecmp(line, "song") == 0)
-        ffPrintSong(instance);
-    else if(strcasecmp(line, "colors") == 0)
-        ffPrintColors(instance);
+    return detectors;
+}
+
+static void printStructureEntry(FFinstance* instance, const FFstructureEntry* entry)
+{
+    if(entry->customValue != NULL)
+        ffPrintCustom(instance, entry->name, entry->customValue);
+    else if(entry->module != NULL)
+        entry->module->print(instance);
     else
-        ffPrintError(instance, line, 0, NULL, NULL, 0, "<no implementation provided>");
+        ffPrintError(instance, entry->name, 0, NULL, NULL, 0, "<no implementation provided>");
 }
 
 int main(int argc, const char** argv)
 {
+    //Everything fastfetch allocates lives until the end of the run, so take it from the arena
+    ffArenaEnable();
+
     FFinstance instance;
     ffInitInstance(&instance);
 
@@ -1038,7 +967,6 @@ int main(int argc, const char** argv)
     ffValuestoreInit(&data.valuestore);
     ffStrbufInitA(&data.structure, 256);
     ffStrbufInitA(&data.logoName, 0);
-    data.multithreading = true;
 
     for(uint8_t i = 0; i < FASTFETCH_LOGO_MAX_COLORS; i++)
         ffStrbufInitA(&data.logoColors[i], 0);
@@ -1046,8 +974,10 @@ int main(int argc, const char** argv)
     parseDefaultConfigFile(&instance, &data);
     parseArguments(&instance, &data, argc, argv);
 
-    //Load custom logo if it exists
-    if(data.logoName.length > 0)
+    //Load custom logo if it exists. JSON output doesn't print one
+    if(instance.config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        ffLoadLogoSet(&instance, "none");
+    else if(data.logoName.length > 0)
         ffLoadLogoSet(&instance, data.logoName.chars);
     else
         ffLoadLogo(&instance);
@@ -1063,27 +993,29 @@ int main(int argc, const char** argv)
             ffStrbufSet(&instance.config.logoColors[i], &data.logoColors[i]);
     }
 
-    //Start detection threads
-    if(data.multithreading)
-        ffStartDetectionThreads(&instance);
-
     //If we don't have a custom structure, use the default one
     if(data.structure.length == 0)
         ffStrbufSetS(&data.structure, FASTFETCH_DATATEXT_STRUCTURE);
 
-    ffStart(&instance);
+    FFlist structure;
+    ffListInitA(&structure, sizeof(FFstructureEntry), 32);
+    uint32_t detectors = resolveStructure(&data, &structure);
 
-    //Parse the structure and call the modules
-    uint32_t startIndex = 0;
-    while (startIndex < data.structure.length)
-    {
-        uint32_t colonIndex = ffStrbufNextIndexC(&data.structure, startIndex, ':');
-        data.structure.chars[colonIndex] = '\0';
+    //Take the first samples now, so the window of rate modules runs in parallel to everything printed before them
+    ffSamplingStart(detectors);
 
-        parseStructureCommand(&instance, &data, data.structure.chars + startIndex);
+    //Start detection threads, only the ones the structure needs
+    if(instance.config.multithreading)
+        ffStartDetectionThreadsFor(&instance, detectors);
 
-        startIndex = colonIndex + 1;
-    }
+    ffStart(&instance);
+
+    for(uint32_t i = 0; i < structure.length; ++i)
+        printStructureEntry(&instance, ffListGet(&structure, i));
 
     ffFinish(&instance);
+
+    //Everything is printed. Let the OS reclaim the arena and whatever the loaded libraries hold, instead of tearing it all down
+    fflush(NULL);
+    _exit(0);
 }
@@ -20,7 +20,10 @@
 
 #include "util/FFstrbuf.h"
 #include "util/FFlist.h"
+#include "util/FFarena.h"
 #include "util/FFvaluestore.h"
+#include "util/FFperfecthash.h"
+#include "modules/list.h"
 
 static inline void ffUnused(int dummy, ...) { (void) dummy; }
 #define FF_UNUSED(...) ffUnused(0, __VA_ARGS__);
@@ -31,14 +34,92 @@ static inline void ffUnused(int dummy, ...) { (void) dummy; }
 
 #define FASTFETCH_LOGO_MAX_COLORS 9 //two digits would make parsing much more complicated (index 1 - 9)
 
+typedef enum FFlogoSegmentType
+{
+    FF_LOGO_SEGMENT_TYPE_TEXT,
+    FF_LOGO_SEGMENT_TYPE_COLOR, //value is the index into logoColors
+    FF_LOGO_SEGMENT_TYPE_ESCAPE //\033[...m sequence of a user logo, printed as is
+} FFlogoSegmentType;
+
+typedef struct FFlogoSegment
+{
+    FFlogoSegmentType type;
+    uint32_t value; //Length of text in bytes or color index
+    uint32_t width; //Display width of text
+    const char* text;
+} FFlogoSegment;
+
+typedef struct FFlogoLine
+{
+    uint32_t firstSegment;
+    uint32_t numSegments;
+    uint32_t width;
+} FFlogoLine;
+
 typedef struct FFlogo
 {
     const char** names; //Null terminated
-    char* lines;
+    const FFlogoSegment* segments;
+    const FFlogoLine* lines;
+    uint32_t numLines;
+    uint32_t width; //Display width of the widest line
     bool isFromUser;
     const char** builtinColors; // [0] is used as key color, if not user specified
 } FFlogo;
 
+typedef enum FFoutputformat
+{
+    FF_OUTPUT_FORMAT_DEFAULT,
+    FF_OUTPUT_FORMAT_JSON //Typed module results as a JSON array, no logo, keys or colors
+} FFoutputformat;
+
+typedef enum FFoutputSinkType
+{
+    FF_OUTPUT_SINK_TYPE_FILE,
+    FF_OUTPUT_SINK_TYPE_FD,
+    FF_OUTPUT_SINK_TYPE_BUFFER,
+    FF_OUTPUT_SINK_TYPE_CALLBACK
+} FFoutputSinkType;
+
+typedef void(*FFoutputCallback)(const char* data, uint32_t length, void* userData);
+
+//Where everything fastfetch prints goes to. Set it with the ffOutputSet* functions
+typedef struct FFoutputSink
+{
+    FFoutputSinkType type;
+    FILE* file;
+    int fd;
+    bool ownsFd; //The fd was opened by fastfetch and is closed when the sink changes
+    bool lineBuffered; //Flush at every newline, like stdio does for terminals
+    FFstrbuf* buffer;
+    FFoutputCallback callback;
+    void* userData;
+    FFstrbuf pending; //Fd and callback sinks collect small writes here
+} FFoutputSink;
+
+#define FF_MODULE(id, name, alias, option, print, detectors, cache, numFormatArgs) FF_MODULE_ID_ ## id,
+typedef enum FFmoduleId
+{
+    FF_MODULE_LIST
+    FF_MODULE_ID_COUNT
+} FFmoduleId;
+#undef FF_MODULE
+
+//The settings every module has. Module specific ones are in FFconfig
+typedef struct FFmoduleConfig
+{
+    FFstrbuf key;
+    FFstrbuf format;
+    uint32_t timeout; //In ms, 0 if it isn't set
+} FFmoduleConfig;
+
+//The compiled key and format of a module. NULL if the string is empty
+typedef struct FFmoduleFormats
+{
+    const struct FFformat* key;
+    const struct FFformat* format; //NULL means the module prints its default output
+} FFmoduleFormats;
+
 typedef struct FFconfig
 {
     const FFlogo* logo;
@@ -57,63 +138,12 @@ typedef struct FFconfig
     bool disableLinewrap;
     bool hideCursor;
     bool userLogoIsRaw;
+    bool multithreading;
+    FFoutputformat outputFormat;
+    uint32_t samplingWindow; //Minimum time in ms between the two samples of rate modules
 
-    FFstrbuf osFormat;
-    FFstrbuf osKey;
-    FFstrbuf hostFormat;
-    FFstrbuf hostKey;
-    FFstrbuf kernelFormat;
-    FFstrbuf kernelKey;
-    FFstrbuf uptimeFormat;
-    FFstrbuf uptimeKey;
-    FFstrbuf processesFormat;
-    FFstrbuf processesKey;
-    FFstrbuf packagesFormat;
-    FFstrbuf packagesKey;
-    FFstrbuf shellFormat;
-    FFstrbuf shellKey;
-    FFstrbuf resolutionFormat;
-    FFstrbuf resolutionKey;
-    FFstrbuf deFormat;
-    FFstrbuf deKey;
-    FFstrbuf wmFormat;
-    FFstrbuf wmKey;
-    FFstrbuf wmThemeFormat;
-    FFstrbuf wmThemeKey;
-    FFstrbuf themeFormat;
-    FFstrbuf themeKey;
-    FFstrbuf iconsFormat;
-    FFstrbuf iconsKey;
-    FFstrbuf fontFormat;
-    FFstrbuf fontKey;
-    FFstrbuf cursorFormat;
-    FFstrbuf cursorKey;
-    FFstrbuf terminalFormat;
-    FFstrbuf terminalKey;
-    FFstrbuf termFontFormat;
-    FFstrbuf termFontKey;
-    FFstrbuf cpuFormat;
-    FFstrbuf cpuKey;
-    FFstrbuf cpuUsageFormat;
-    FFstrbuf cpuUsageKey;
-    FFstrbuf gpuFormat;
-    FFstrbuf gpuKey;
-    FFstrbuf memoryFormat;
-    FFstrbuf memoryKey;
-    FFstrbuf diskFormat;
-    FFstrbuf diskKey;
-    FFstrbuf batteryFormat;
-    FFstrbuf batteryKey;
-    FFstrbuf localeFormat;
-    FFstrbuf localeKey;
-    FFstrbuf localIpKey;
-    FFstrbuf localIpFormat;
-    FFstrbuf publicIpKey;
-    FFstrbuf publicIpFormat;
-    FFstrbuf playerKey;
-    FFstrbuf playerFormat;
-    FFstrbuf songKey;
-    FFstrbuf songFormat;
+    //Settings of every module, indexed by FFmoduleId
+    FFmoduleConfig modules[FF_MODULE_ID_COUNT];
 
     FFstrbuf libPCI;
     FFstrbuf libVulkan;
@@ -127,8 +157,10 @@ typedef struct FFconfig
     FFstrbuf libDBus;
     FFstrbuf libXFConf;
     FFstrbuf librpm;
+    FFstrbuf libSQLite3;
 
     FFstrbuf diskFolders;
+    bool diskShowAll;
 
     FFstrbuf batteryDir;
 
@@ -138,7 +170,7 @@ typedef struct FFconfig
     bool localIpShowIpV4;
     bool localIpShowIpV6;
 
-    uint32_t publicIpTimeout;
+    FFstrbuf publicIpUrls;
 
     FFstrbuf osFile;
 
@@ -148,7 +180,9 @@ typedef struct FFconfig
 typedef struct FFstate
 {
     uint32_t logoWidth;
-    char* logoLinesIndex;
+    uint32_t logoLineIndex;
+    uint32_t jsonResults; //Number of objects written to the JSON array
+    FFoutputSink output;
 
     struct passwd* passwd;
     struct utsname utsname;
@@ -156,8 +190,47 @@ typedef struct FFstate
 
     FFlist configDirs;
     FFstrbuf cacheDir;
+
+    //Compiled from config.modules by ffStart, the config doesn't change after it. All NULL before
+    FFmoduleFormats modules[FF_MODULE_ID_COUNT];
 } FFstate;
 
+//Background detections a module waits for. Only the ones used in the structure are started
+typedef enum FFdetector
+{
+    FF_DETECTOR_NONE = 0,
+    FF_DETECTOR_DISPLAY_SERVER = 1 << 0,
+    FF_DETECTOR_GTK2 = 1 << 1,
+    FF_DETECTOR_GTK3 = 1 << 2,
+    FF_DETECTOR_GTK4 = 1 << 3,
+    FF_DETECTOR_PLASMA = 1 << 4,
+    //First samples of rate modules, taken before anything is printed. See common/sampling.c
+    FF_DETECTOR_SAMPLE_CPU = 1 << 5,
+    FF_DETECTOR_SAMPLE_DISK = 1 << 6,
+    FF_DETECTOR_SAMPLE_NETWORK = 1 << 7,
+    FF_DETECTOR_ALL = (1 << 8) - 1
+} FFdetector;
+
+typedef enum FFmoduleCache
+{
+    FF_MODULE_CACHE_NONE,
+    FF_MODULE_CACHE_SAVED //Printed from the cache file, unless --recache is given
+} FFmoduleCache;
+
+typedef struct FFinstance FFinstance;
+
+//One entry of FF_MODULE_LIST in modules/list.h
+typedef struct FFmodule
+{
+    FFmoduleId id;
+    const char* name;
+    const char* alias; //May be NULL
+    void (*print)(FFinstance* instance);
+    uint32_t detectors;
+    FFmoduleCache cache;
+    uint32_t numFormatArgs;
+} FFmodule;
+
 typedef struct FFinstance
 {
     FFconfig config;
@@ -257,17 +330,111 @@ typedef struct FFMediaResult
     FFstrbuf album;
 } FFMediaResult;
 
+typedef struct FFCPUPolicy
+{
+    uint32_t id; //N of cpufreq/policyN
+    uint32_t numCpus;
+    uint32_t maxFrequency; //kHz
+} FFCPUPolicy;
+
+typedef struct FFCPUResult
+{
+    FFstrbuf name;
+    FFstrbuf vendor;
+    uint32_t family; //0 if unknown, like model and stepping
+    uint32_t model;
+    uint32_t stepping;
+    uint32_t packages; //0 if the topology is unknown, like physicalCores and threads
+    uint32_t physicalCores;
+    uint32_t threads;
+    uint32_t clusters; //0 if the kernel doesn't report them
+    uint32_t cacheL1d; //KiB, summed over all caches of the level
+    uint32_t cacheL1i;
+    uint32_t cacheL2;
+    uint32_t cacheL3;
+    FFlist policies; //List of FFCPUPolicy, sorted by id
+    double procGhz; //"cpu MHz" of /proc/cpuinfo
+} FFCPUResult;
+
+typedef struct FFMemoryResult
+{
+    //KiB, as in /proc/meminfo. 0 if the kernel doesn't report them
+    uint64_t total;
+    uint64_t free;
+    uint64_t available;
+    uint64_t buffers;
+    uint64_t cached;
+    uint64_t shared;
+    uint64_t sReclaimable;
+    uint64_t swapTotal;
+    uint64_t swapFree;
+    uint64_t hugePagesTotal; //Number of pages
+    uint64_t hugePagesFree;
+    uint64_t hugePageSize; //KiB
+    uint64_t zswap; //KiB of the compressed pool
+    uint64_t zswapped; //KiB stored in the pool, uncompressed
+    uint64_t arcSize; //Bytes, ZFS ARC from arcstats. 0 without ZFS
+} FFMemoryResult;
+
+typedef struct FFDiskMount
+{
+    FFstrbuf mountPoint;
+    FFstrbuf fsType;
+    uint64_t deviceId; //major << 32 | minor
+    bool isRoot; //false for bind mounts of a subdirectory
+} FFDiskMount;
+
+typedef struct FFPCIDevice
+{
+    uint64_t address; //domain << 32 | bus << 16 | device << 8 | function
+    uint16_t vendorId;
+    uint16_t deviceId;
+    uint32_t deviceClass; //e.g. 0x030000 for a VGA compatible controller
+    FFstrbuf driver; //Empty if no driver is bound
+} FFPCIDevice;
+
+//Binary index of pci.ids, see detection/pci.c
+typedef struct FFPCIIds
+{
+    const uint8_t* data; //NULL if none is loaded
+    size_t size;
+    bool mapped; //munmap instead of free
+} FFPCIIds;
+
+//Executes the cpuid instruction, registers are eax, ebx, ecx and edx. Returns false if the leaf isn't supported
+typedef bool(*FFCPUIDFunction)(uint32_t leaf, uint32_t registers[4]);
+
+typedef enum FFsampleType
+{
+    FF_SAMPLE_TYPE_CPU,
+    FF_SAMPLE_TYPE_DISK,
+    FF_SAMPLE_TYPE_NETWORK,
+    FF_SAMPLE_TYPE_COUNT
+} FFsampleType;
+
+//A snapshot of the counters of a /proc file
+typedef struct FFsample
+{
+    uint64_t time; //CLOCK_MONOTONIC, in ns
+    //CPU: id (UINT64_MAX for the sum of all cpus), work and total jiffies of every cpu line
+    //Disk: bytes read and written of all physical disks
+    //Network: bytes received and sent of all interfaces except lo
+    FFlist values; //uint64_t
+} FFsample;
+
 typedef enum FFformatargtype
 {
     FF_FORMAT_ARG_TYPE_NULL = 0,
     FF_FORMAT_ARG_TYPE_UINT,
+    FF_FORMAT_ARG_TYPE_UINT64,
     FF_FORMAT_ARG_TYPE_UINT16,
     FF_FORMAT_ARG_TYPE_UINT8,
     FF_FORMAT_ARG_TYPE_INT,
     FF_FORMAT_ARG_TYPE_STRING,
     FF_FORMAT_ARG_TYPE_STRBUF,
     FF_FORMAT_ARG_TYPE_DOUBLE,
-    FF_FORMAT_ARG_TYPE_LIST
+    FF_FORMAT_ARG_TYPE_LIST, //FFlist of FFstrbuf
+    FF_FORMAT_ARG_TYPE_DOUBLE_LIST //FFlist of double, numbers in JSON
 } FFformatargtype;
 
 typedef struct FFformatarg
@@ -276,10 +443,49 @@ typedef struct FFformatarg
     const void* value;
 } FFformatarg;
 
+typedef enum FFformatinstructiontype
+{
+    FF_FORMAT_INSTRUCTION_TYPE_LITERAL,      // Appends text
+    FF_FORMAT_INSTRUCTION_TYPE_ARG,          // Appends argument argIndex, or text if it doesn't exist
+    FF_FORMAT_INSTRUCTION_TYPE_NEXT_ARG,     // {}: appends the next unused argument, or text if none is left
+    FF_FORMAT_INSTRUCTION_TYPE_ERROR,
+    FF_FORMAT_INSTRUCTION_TYPE_STOP,
+    FF_FORMAT_INSTRUCTION_TYPE_IF,           // Continues at jump if argument argIndex is not set. Appends text if it doesn't exist
+    FF_FORMAT_INSTRUCTION_TYPE_NOT_IF,       // Continues at jump if argument argIndex is set. Appends text if it doesn't exist
+    FF_FORMAT_INSTRUCTION_TYPE_IF_ERROR,     // Continues at jump if no error is set
+    FF_FORMAT_INSTRUCTION_TYPE_NOT_IF_ERROR, // Continues at jump if an error is set
+    FF_FORMAT_INSTRUCTION_TYPE_END_IF,       // Appends text if no if is open
+    FF_FORMAT_INSTRUCTION_TYPE_END_NOT_IF,   // Appends text if no not if is open
+    FF_FORMAT_INSTRUCTION_TYPE_COLOR,        // Appends text, which is the escape sequence
+    FF_FORMAT_INSTRUCTION_TYPE_END_COLOR     // Appends text if no color is open
+} FFformatinstructiontype;
+
+typedef struct FFformatinstruction
+{
+    FFformatinstructiontype type;
+    uint32_t argIndex;
+    uint32_t textStart;
+    uint32_t textLength;
+    uint32_t next; // UINT32_MAX ends the rendering
+    uint32_t jump;
+} FFformatinstruction;
+
+typedef struct FFformat
+{
+    FFstrbuf text; //The source format string, followed by generated texts
+    uint32_t sourceLength;
+    FFlist instructions; //FFformatinstruction
+    uint32_t start;
+    uint64_t usedArgs; //Bit n is set if argument n + 1 may be printed or tested. {} counts conservatively
+} FFformat;
+
+#define FF_FORMAT_ARG_MASK(index) (1ULL << ((index) - 1)) //index is 1 based, like in format strings
+
 typedef struct FFcache
 {
     FILE* value;
     FILE* split;
+    uint64_t args; //The format args which were detected. Skipped ones aren't used from the split cache. Defaults to all
 } FFcache;
 
 typedef enum FFvarianttype
@@ -355,17 +561,28 @@ void ffListFeatures();
 
 //common/threading.c
 void ffStartDetectionThreads(FFinstance* instance);
+void ffStartDetectionThreadsFor(FFinstance* instance, uint32_t detectors); //Only starts the given FF_DETECTOR_* threads
+//Runs task(data, i, result) for every i < numTasks in its own thread and waits for each until timeouts[i] milliseconds after the call.
+//The results of the tasks done in time are copied to results[i], the others are left untouched. done may be NULL.
+//Tasks which missed their deadline keep running, so data belongs to them from now on and is freed with freeData (if not NULL) after the last one returned
+void ffRunDeadlineTasks(uint32_t numTasks, const uint32_t* timeouts, void (*task)(void* data, uint32_t index, void* result), void* data, void (*freeData)(void* data), size_t resultSize, void* results, bool* done);
+
+//common/modules.c
+extern const FFmodule ffModules[FF_MODULE_ID_COUNT];
+const FFmodule* ffGetModule(const char* name); //Case insensitive, aliases included. NULL if there is no such module
 
 //common/io.c
-void ffPrintLogoAndKey(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat);
-void ffPrintError(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, uint32_t numFormatArgs, const char* message, ...);
-void ffPrintFormatString(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments);
+void ffPrintLogoAndKey(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey);
+void ffPrintError(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey, const FFformat* format, uint32_t numFormatArgs, const char* message, ...);
+void ffPrintFormatString(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey, const FFformat* format, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments);
 void ffGetCacheFilePath(FFinstance* instance, const char* moduleName, const char* extension, FFstrbuf* buffer);
 void ffReadCacheFile(FFinstance* instance, const char* moduleName, const char* extension, FFstrbuf* buffer);
 void ffWriteCacheFile(FFinstance* instance, const char* moduleName, const char* extension, FFstrbuf* content);
-bool ffPrintFromCache(FFinstance* instance, const char* moduleName, const FFstrbuf* customKeyFormat, const FFstrbuf* formatString, uint32_t numArgs);
-void ffPrintAndSaveToCache(FFinstance* instance, const char* moduleName, const FFstrbuf* customKeyFormat, const FFstrbuf* value, const FFstrbuf* formatString, uint32_t numArgs, const FFformatarg* arguments);
-void ffPrintAndAppendToCache(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFstrbuf* customKeyFormat, FFcache* cache, const FFstrbuf* value, const FFstrbuf* formatString, uint32_t numArgs, const FFformatarg* arguments);
+bool ffPrintFromCache(FFinstance* instance, const char* moduleName, const FFformat* customKey, const FFformat* format, uint32_t numArgs);
+void ffPrintAndSaveToCache(FFinstance* instance, const char* moduleName, const FFformat* customKey, const FFstrbuf* value, const FFformat* format, uint32_t numArgs, const FFformatarg* arguments);
+void ffPrintAndAppendToCache(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const FFformat* customKey, FFcache* cache, const FFstrbuf* value, const FFformat* format, uint32_t numArgs, const FFformatarg* arguments);
+bool ffOutputIsDefault(const FFinstance* instance, const FFformat* format); //True if the module prints its default output, instead of its format args
+uint64_t ffOutputGetUsedArgs(const FFinstance* instance, const FFformat* format); //Format args the module must detect
 
 void ffCacheValidate(FFinstance* instance);
 void ffCacheOpenWrite(FFinstance* instance, const char* moduleName, FFcache* cache);
@@ -374,15 +591,23 @@ void ffCacheClose(FFcache* cache);
 void ffAppendFDContent(int fd, FFstrbuf* buffer);
 bool ffAppendFileContent(const char* fileName, FFstrbuf* buffer); //returns true if open() succeeds. This is used to differentiate between <file not found> and <empty file>
 bool ffGetFileContent(const char* fileName, FFstrbuf* buffer);
+uint32_t ffReadFileAt(int dirfd, const char* fileName, char* buffer, uint32_t size); //For small files like in sysfs, relative to dirfd. NUL terminates the content and returns its length, 0 on failure
+bool ffReadUIntAt(int dirfd, const char* fileName, int base, uint32_t* value); //Number at the start of a small file, base as in strtoul
+
+// Reads the file once per run and returns a shared, read only view of its content. Returns NULL if the file can't be opened.
+// Thread safe. The content stays valid until the program exits, so it must not be modified or destroyed by the caller.
+// Only use it for files which don't change during the run, e.g. config files. Never for the fastfetch cache or sampled files like /proc/stat.
+const FFstrbuf* ffReadFileCached(const char* fileName);
 bool ffWriteFDContent(int fd, const FFstrbuf* content);
 void ffWriteFileContent(const char* fileName, const FFstrbuf* buffer);
 
 bool ffFileExists(const char* fileName, mode_t mode);
 
-// Not thread safe!
+// Silences stdout and stderr of the whole process, e.g. for libraries which print messages. Calls can be nested, also from multiple threads.
+// The output sink writes to its own copy of stdout, so printing isn't affected by it
 void ffSuppressIO(bool suppress);
 
-void ffPrintColor(const FFstrbuf* colorValue);
+void ffPrintColor(FFinstance* instance, const FFstrbuf* colorValue);
 
 // They return true if the file was found, independently if start was found
 // Buffers which already contain content are not overwritten
@@ -395,6 +620,14 @@ bool ffParsePropFileHome(const FFinstance* instance, const char* relativeFile, c
 bool ffParsePropFileConfigValues(const FFinstance* instance, const char* relativeFile, uint32_t numQueries, FFpropquery* queries);
 bool ffParsePropFileConfig(const FFinstance* instance, const char* relativeFile, const char* start, FFstrbuf* buffer);
 
+//common/sampling.c
+bool ffSampleParseCPU(const char* content, FFlist* values); //content of /proc/stat
+bool ffSampleParseDisk(const char* content, const char* blockDir, FFlist* values); //content of /proc/diskstats, blockDir is normally /sys/block
+bool ffSampleParseNetwork(const char* content, FFlist* values); //content of /proc/net/dev
+void ffSamplingStart(uint32_t detectors); //Takes the first samples of the FF_DETECTOR_SAMPLE_* detectors
+bool ffSamplingMeasure(const FFinstance* instance, FFsampleType type, const FFsample** first, const FFsample** second); //Takes the second sample, at least --sampling-window after the first one
+double ffSamplingGetRate(const FFsample* first, const FFsample* second, uint32_t index); //Increase per second of the value at index
+
 //common/processing.c
 void ffProcessAppendStdOut(FFstrbuf* buffer, char* const argv[]);
 
@@ -403,6 +636,7 @@ void* ffLibraryLoad(const FFstrbuf* userProvidedName, ...);
 
 //common/networking.c
 void ffNetworkingGetHttp(const char* host, const char* path, uint32_t timeout, FFstrbuf* buffer);
+void ffNetworkingGetHttpFirst(uint32_t numUrls, const char* const* urls, uint32_t timeout, FFstrbuf* buffer);
 
 //common/logo.c
 void ffLoadLogoSet(FFinstance* instance, const char* logo);
@@ -414,9 +648,41 @@ void ffPrintLogos(FFinstance* instance);
 void ffListLogos();
 void ffListLogosForAutocompletion();
 
+//logo/compile.c
+uint32_t ffLogoCharWidth(uint32_t codepoint);
+uint32_t ffLogoNextChar(const char* text, uint32_t length, uint32_t* width); //Returns the length of the char in bytes
+uint32_t ffLogoCompile(const char* text, uint32_t length, bool parseColors, bool parseEscapes, FFlist* segments, FFlist* lines); //Returns the width of the widest line
+
 //common/format.c
 void ffFormatAppendFormatArg(FFstrbuf* buffer, const FFformatarg* formatarg);
-void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments);
+void ffParseFormatString(FFstrbuf* buffer, const FFstrbuf* formatstr, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments); //Reference implementation, use ffFormatRender(ffFormatGetCompiled()) instead
+void ffFormatCompile(FFformat* format, const FFstrbuf* formatstr);
+void ffFormatDestroy(FFformat* format);
+const FFformat* ffFormatGetCompiled(const FFstrbuf* formatstr); //Compiles the format string once and returns the shared result. Thread safe. Module strings are compiled by ffStart instead
+void ffFormatRender(FFstrbuf* buffer, const FFformat* format, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments);
+
+//common/output.c
+void ffOutputInit(FFinstance* instance); //Writes to a private copy of stdout, so that suppressing fd 1 doesn't swallow our output
+void ffOutputSetFile(FFinstance* instance, FILE* file);
+void ffOutputSetFD(FFinstance* instance, int fd);
+void ffOutputSetBuffer(FFinstance* instance, FFstrbuf* buffer);
+void ffOutputSetCallback(FFinstance* instance, FFoutputCallback callback, void* userData);
+void ffOutputWriteNS(FFinstance* instance, uint32_t length, const char* value);
+void ffOutputWriteS(FFinstance* instance, const char* value);
+void ffOutputWriteC(FFinstance* instance, char c);
+void ffOutputWrite(FFinstance* instance, const FFstrbuf* value);
+void ffOutputWriteF(FFinstance* instance, const char* format, ...);
+void ffOutputPutS(FFinstance* instance, const char* value); //Like ffOutputWriteS, followed by a newline
+void ffOutputPut(FFinstance* instance, const FFstrbuf* value); //Like ffOutputWrite, followed by a newline
+void ffOutputFlush(FFinstance* instance);
+
+//common/json.c
+void ffJsonAppendString(FFstrbuf* buffer, const char* value);
+void ffJsonAppendFormatArg(FFstrbuf* buffer, const FFformatarg* formatarg);
+void ffPrintJsonStart(FFinstance* instance);
+void ffPrintJsonResult(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, uint32_t numArgs, const FFformatarg* arguments);
+void ffPrintJsonError(FFinstance* instance, const char* moduleName, uint8_t moduleIndex, const char* message, va_list arguments);
+void ffPrintJsonFinish(FFinstance* instance);
 
 //common/parsing.c
 void ffGetGtkPretty(FFstrbuf* buffer, const FFstrbuf* gtk2, const FFstrbuf* gtk3, const FFstrbuf* gtk4);
@@ -466,6 +732,42 @@ const FFTempsResult* ffDetectTemps(const FFinstance* instance);
 //detection/media.c
 const FFMediaResult* ffDetectMedia(FFinstance* instance);
 
+//detection/cpu.c
+void ffCPUResultInit(FFCPUResult* result);
+void ffCPUResultDestroy(FFCPUResult* result);
+bool ffCPUIDNative(uint32_t leaf, uint32_t registers[4]); //Always false on non x86 architectures
+bool ffDetectCPUID(FFCPUIDFunction cpuid, FFCPUResult* result); //Returns false if cpuid isn't available
+bool ffDetectCPUTopology(const char* cpuDir, FFCPUResult* result); //cpuDir is normally /sys/devices/system/cpu
+bool ffDetectCPUTopologyCached(FFinstance* instance, const char* cpuDir, FFCPUResult* result); //Cached until the next boot
+bool ffDetectCPUInfo(const char* fileName, FFCPUResult* result); //Only fills values which are still unknown, except procGhz. Stops after the first processor
+bool ffDetectCPU(FFinstance* instance, FFCPUIDFunction cpuid, const char* cpuDir, const char* cpuinfoFile, FFCPUResult* result); //The topology from cpuDir, name, vendor and family from cpuid or cpuinfoFile. Returns whether cpuinfoFile was read
+
+//detection/memory.c
+bool ffDetectMemInfo(const char* fileName, FFMemoryResult* result); //fileName is normally /proc/meminfo. Returns false if MemTotal is missing
+bool ffDetectZFSArc(const char* fileName, FFMemoryResult* result); //fileName is normally /proc/spl/kstat/zfs/arcstats
+
+//detection/disk.c
+bool ffDetectDiskMounts(const char* fileName, bool all, FFlist* mounts); //fileName is normally /proc/self/mountinfo. Unless all, only real filesystems, every device once. Destroy mounts even if it fails
+const FFDiskMount* ffDiskMountsFind(const FFlist* mounts, const char* path); //The mount which contains path, it must be absolute without symlinks. NULL if none does
+void ffDiskMountsDestroy(FFlist* mounts);
+
+//detection/packages.c
+uint32_t ffPackagesCountDirEntries(const char* dirname, unsigned char type); //Entries of the dirent type, without . and ..
+uint32_t ffPackagesCountSQLite3(FFinstance* instance, const char* path, const char* query, uint32_t numParams, const char* const* params); //Runs a query returning a single number on the database, opened read only. 0 if anything fails
+uint32_t ffDetectPackagesApk(const char* installedFile); //installedFile is normally /lib/apk/db/installed
+uint32_t ffDetectPackagesFlatpak(const char* installationDir); //Apps and runtimes. installationDir is normally /var/lib/flatpak or ~/.local/share/flatpak
+uint32_t ffDetectPackagesNix(FFinstance* instance, const char* dbFile, uint32_t numProfiles, const char* const* profiles); //dbFile is normally /nix/var/nix/db/db.sqlite. Profiles which don't exist are skipped
+
+//detection/pci.c
+bool ffDetectPCIDisplayDevices(const char* devicesDir, FFlist* devices); //devicesDir is normally /sys/bus/pci/devices. List of FFPCIDevice of class 0x03, sorted by address. Destroy devices even if it fails
+void ffPCIDevicesDestroy(FFlist* devices);
+bool ffPCIIdsBuild(const char* pciIdsFile, FFPCIIds* ids); //Parses pci.ids into an index in memory
+bool ffPCIIdsWrite(const FFPCIIds* ids, const char* indexFile);
+bool ffPCIIdsOpen(const char* indexFile, FFPCIIds* ids); //mmaps an index written by ffPCIIdsWrite
+bool ffPCIIdsOpenCached(FFinstance* instance, FFPCIIds* ids); //Opens the index in the cache dir. Rebuilds it from the system pci.ids if that changed
+void ffPCIIdsClose(FFPCIIds* ids);
+bool ffPCIIdsLookup(const FFPCIIds* ids, uint16_t vendorId, uint16_t deviceId, FFstrbuf* vendorName, FFstrbuf* deviceName); //Appends the names. False if the vendor is unknown, deviceName stays empty if only the device is
+
 /********************/
 /* Module functions */
 /********************/
@@ -498,6 +800,8 @@ void ffPrintTerminal(FFinstance* instance);
 void ffPrintTerminalFont(FFinstance* instance);
 void ffPrintCPU(FFinstance* instance);
 void ffPrintCPUUsage(FFinstance* instance);
+void ffPrintDiskIO(FFinstance* instance);
+void ffPrintNetIO(FFinstance* instance);
 void ffPrintGPU(FFinstance* instance);
 void ffPrintMemory(FFinstance* instance);
 void ffPrintDisk(FFinstance* instance);
@@ -5,6 +5,9 @@ int main(int argc, char** argv)
     //Disable compiler warnings
     FF_UNUSED(argc, argv);
 
+    //Everything lives until the end of the run, so allocate it from the arena
+    ffArenaEnable();
+
     FFinstance instance;
     ffInitInstance(&instance); //This also applys default configuration to instance.config
 
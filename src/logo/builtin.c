@@ -0,0 +1,736 @@
+#include "logo/builtin.h"
+
+//The order of this list is the order of --list-logos and --print-logos
+const FFlogoSource ffLogoSources[] = {
+    { // None
+        .names = {"none", "empty", "", NULL},
+        .lines = "",
+        .colors = {"", NULL}
+    },
+    { // Unknown
+        .names = {"unkown", "question mark", NULL},
+        .lines =
+            "       ________        \n"
+            "   _jgN########Ngg_    \n"
+            " _N##N@@\"\"  \"\"9NN##Np_ \n"
+            "d###P            N####p\n"
+            "\"^^\"              T####\n"
+            "                  d###P\n"
+            "               _g###@F \n"
+            "            _gN##@P    \n"
+            "          gN###F\"      \n"
+            "         d###F         \n"
+            "        0###F          \n"
+            "        0###F          \n"
+            "        0###F          \n"
+            "        \"NN@'          \n"
+            "                       \n"
+            "         ___           \n"
+            "        q###r          \n"
+            "         \"\"            ",
+        .colors = {"", NULL}
+    },
+    { // Android
+        .names = {"android", NULL},
+        .lines =
+            "$1         -o          o-         \n"
+            "$1          +hydNNNNdyh+          \n"
+            "$1        +mMMMMMMMMMMMMm+        \n"
+            "$1      `dMM$2m:$1NMMMMMMN$2:m$1MMd`      \n"
+            "$1      hMMMMMMMMMMMMMMMMMMh      \n"
+            "$1  ..  yyyyyyyyyyyyyyyyyyyy  ..  \n"
+            "$1.mMMm`MMMMMMMMMMMMMMMMMMMM`mMMm.\n"
+            "$1:MMMM-MMMMMMMMMMMMMMMMMMMM-MMMM:\n"
+            "$1:MMMM-MMMMMMMMMMMMMMMMMMMM-MMMM:\n"
+            "$1:MMMM-MMMMMMMMMMMMMMMMMMMM-MMMM:\n"
+            "$1:MMMM-MMMMMMMMMMMMMMMMMMMM-MMMM:\n"
+            "$1-MMMM-MMMMMMMMMMMMMMMMMMMM-MMMM-\n"
+            "$1 +yy+ MMMMMMMMMMMMMMMMMMMM +yy+ \n"
+            "$1      mMMMMMMMMMMMMMMMMMMm      \n"
+            "$1      `/++MMMMh++hMMMM++/`      \n"
+            "$1          MMMMo  oMMMM          \n"
+            "$1          MMMMo  oMMMM          \n"
+            "$1          oNMm-  -mMNs          ",
+        .colors = {
+            "32", //green
+            "37", //white
+            NULL
+        }
+    },
+    { // AndroidSmall
+        .names = {"android-small", "android_small", NULL},
+        .lines =
+            "$1  ;,           ,;  \n"
+            "$1   ';,.-----.,;'   \n"
+            "$1  ,'           ',  \n"
+            "$1 /    O     O    \\ \n"
+            "$1|                 |\n"
+            "$1'-----------------'",
+        .colors = {
+            "32", //green
+            NULL
+        }
+    },
+    { // Arch
+        .names = {"arch", "archlinux", "arch-linux", NULL},
+        .lines =
+            "$1                  -`                 \n"
+            "$1                 .o+`                \n"
+            "$1                `ooo/                \n"
+            "$1               `+oooo:               \n"
+            "$1              `+oooooo:              \n"
+            "$1              -+oooooo+:             \n"
+            "$1            `/:-:++oooo+:            \n"
+            "$1           `/++++/+++++++:           \n"
+            "$1          `/++++++++++++++:          \n"
+            "$1         `/+++ooooooooooooo/`        \n"
+            "$1        ./ooosssso++osssssso+`       \n"
+            "$1       .oossssso-````/ossssss+`      \n"
+            "$1      -osssssso.      :ssssssso.     \n"
+            "$1     :osssssss/        osssso+++.    \n"
+            "$1    /ossssssss/        +ssssooo/-    \n"
+            "$1  `/ossssso+/:-        -:/+osssso+-  \n"
+            "$1 `+sso+:-`                 `.-/+oso: \n"
+            "$1`++:.                           `-/+/\n"
+            "$1.`                                 `/",
+        .colors = {
+            "36", //cyan
+            NULL
+        }
+    },
+    { // ArchSmall
+        .names = {"arch_small", "archlinux_small", "arch-linux-small", NULL},
+        .lines =
+            "$1      /\\      \n"
+            "$1     /  \\     \n"
+            "$1    /    \\    \n"
+            "$1   /      \\   \n"
+            "$1  /   ,,   \\  \n"
+            "$1 /   |  |   \\ \n"
+            "$1/_-''    ''-_\\",
+        .colors = {
+            "36", //cyan
+            NULL
+        }
+    },
+    { // ArcoLinux
+        .names = {"Arco", "Arcolinux", "Arco-linux", NULL},
+        .lines =
+            "$1                    /-                       \n"
+            "$1                   ooo:                      \n"
+            "$1                  yoooo/                     \n"
+            "$1                 yooooooo                    \n"
+            "$1                yooooooooo                   \n"
+            "$1               yooooooooooo                  \n"
+            "$1             .yooooooooooooo                 \n"
+            "$1            .oooooooooooooooo                \n"
+            "$1           .oooooooarcoooooooo               \n"
+            "$1          .ooooooooo-oooooooooo              \n"
+            "$1         .ooooooooo-  oooooooooo             \n"
+            "$1        :ooooooooo.    :ooooooooo            \n"
+            "$1       :ooooooooo.      :ooooooooo           \n"
+            "$1      :oooarcooo         .oooarcooo          \n"
+            "$1     :ooooooooy           .ooooooooo         \n"
+            "$1    :ooooooooo  $2 /ooooooooooooooooooo        \n"
+            "$1   :ooooooooo     $2 .-ooooooooooooooooo.      \n"
+            "$1   ooooooooo-           $2 -ooooooooooooo.     \n"
+            "$1  ooooooooo-               $2 .-oooooooooo.    \n"
+            "$1 ooooooooo.                   $2 -ooooooooo    ",
+        .colors = {
+            "34", //blue
+            "32", //green
+            NULL
+        }
+    },
+    { // Artix
+        .names = {"artix", "artixlinux", "artix-linux", NULL},
+        .lines =
+            "$1                   '                  \n"
+            "$1                  'o'                 \n"
+            "$1                 'ooo'                \n"
+            "$1                'ooxoo'               \n"
+            "$1               'ooxxxoo'              \n"
+            "$1              'oookkxxoo'             \n"
+            "$1             'oiioxkkxxoo'            \n"
+            "$1            ':;:iiiioxxxoo'           \n"
+            "$1              `'.;::ioxxoo''          \n"
+            "$1          '-.      `':;jiooo'         \n"
+            "$1        'oooio-..     `'i:io'         \n"
+            "$1       'ooooxxxxoio:,.   `'-;'        \n"
+            "$1      'ooooxxxxxkkxoooIi:-.  `'       \n"
+            "$1     'ooooxxxxxkkkkxoiiiiiji'         \n"
+            "$1    'ooooxxxxxkxxoiiii:'`     .i'     \n"
+            "$1   'ooooxxxxxoi:::'`       .;ioxo'    \n"
+            "$1  'ooooxooi::'`         .:iiixkxxo'   \n"
+            "$1 'ooooi:'`                `'';ioxxo'  \n"
+            "$1'i:'`                          '':io' \n"
+            "$1'`                                  `'",
+        .colors = {
+            "36", //cyan
+            NULL
+        }
+    },
+    { // ArtixSmall
+        .names = {"artix_small", "artixlinux_small", "artix-linux-small", NULL},
+        .lines =
+            "$1      /\\      \n"
+            "$1     /  \\     \n"
+            "$1    /`'.,\\    \n"
+            "$1   /     ',   \n"
+            "$1  /      ,`\\  \n"
+            "$1 /   ,.'`.  \\ \n"
+            "$1/.,'`     `'.\\",
+        .colors = {
+            "36", //cyan
+            NULL
+        }
+    },
+    { // CachyOS
+        .names = {"cachyos", "cachyos-linux", NULL},
+        .lines =
+            "$1           $3.$1-------------------------:                 \n"
+            "$1          .$2+=$1========================.                 \n"
+            "$1         :$2++$1===$2++===$1===============-       :$2++$1-        \n"
+            "$1        :$2*++$1====$2+++++==$1===========-        .==:        \n"
+            "$1       -$2*+++$1=====$2+***++=$1=========:                     \n"
+            "$1      =$2*++++=$1=======------------:                      \n"
+            "$1     =$2*+++++=$1====-                     $3...$1             \n"
+            "$1   .$2+*+++++$1=-===:                    .$2=+++=$1:           \n"
+            "$1  :$2++++$1=====-==:                     -***$2**$1+           \n"
+            "$1 :$2++=$1=======-=.                      .=+**+$3.$1           \n"
+            "$1.$2+$1==========-.                          $3.$1              \n"
+            "$1 :$2+++++++$1====-                                $3.$1--==-$3.$1  \n"
+            "$1  :$2++$1==========.                             $3:$2+++++++$1$3: \n"
+            "$1   .-===========.                            =*****+*+ \n"
+            "$1    .-===========:                           .+*****+: \n"
+            "$1      -=======$2++++$1:::::::::::::::::::::::::-:  $3.$1---:   \n"
+            "$1       :======$2++++$1====$2+++******************=.          \n"
+            "$1        :=====$2+++$1==========$2++++++++++++++*-            \n"
+            "$1         .====$2++$1==============$2++++++++++*-             \n"
+            "$1          .===$2+$1==================$2+++++++:              \n"
+            "$1           .-=======================$2+++:               \n"
+            "$1             $3..........................                ",
+        .colors = {
+            "36", //cyan
+            "32", //green
+            "30", //black
+            NULL
+        }
+    },
+    { // CelOS
+        .names = {"celos", "celos-linux", NULL},
+        .lines =
+            "$1             `-:/++++/:-`            \n"
+            "$1          -/syyyyyyyyyyyyy+-         \n"
+            "$1        :ssssyyyyyyyyyyyyyyyy/       \n"
+            "$1      .osy$2mmmmmmmmmmmmmmmNNNNNmmhy+  \n"
+            "$1     .sssshhhhhhhddddddddddddddds-   \n"
+            "$1    `osssssssyyyyyyyyyyyyyyyyyyhy`   \n"
+            "$1    :ssssssyyyyyyyyyyyyyyyyyyyyhh/   \n"
+            "$2sMMMMMMMMMMMMMMMMMMMMMMMh$1yyyyyyhho   \n"
+            "$1    :sssssssyyyyyyyyyyyyyyyyyyyhh/   \n"
+            "$1    `ssssssssyyyyyyyyyyyyyyyyyyhy.   \n"
+            "$1     -sssssyddddddddddddddddddddy    \n"
+            "$1      -ssss$2hmmmmmmmmmmmmmmmmmmmyssss-\n"
+            "$1       `/ssssyyyyyyyyyyyyyyyy+`      \n"
+            "$1         `:osyyyyyyyyyyyyys/`        \n"
+            "$1            `.:/+ooooo+:-`           ",
+        .colors = {
+            "35", //magenta
+            "30", //black
+            NULL
+        }
+    },
+    { // CentOS
+        .names = {"centos", "centos-linux", NULL},
+        .lines =
+            "$1                 ..                 \n"
+            "$1               .PLTJ.               \n"
+            "$1              <><><><>              \n"
+            "$2     KKSSV' 4KKK $1LJ$4 KKKL.'VSSKK     \n"
+            "$2     KKV' 4KKKKK $1LJ$4 KKKKAL 'VKK     \n"
+            "$2     V' ' 'VKKKK $1LJ$4 KKKKV' ' 'V     \n"
+            "$2     .4MA.' 'VKK $1LJ$4 KKV' '.4Mb.     \n"
+            "$4   . $2KKKKKA.' 'V $1LJ$4 V' '.4KKKKK $3.   \n"
+            "$4 .4D $2KKKKKKKA.'' $1LJ$4 ''.4KKKKKKK $3FA. \n"
+            "$4<QDD ++++++++++++  $3++++++++++++ GFD>\n"
+            "$4 'VD $3KKKKKKKK'.. $2LJ $1..'KKKKKKKK $3FV  \n"
+            "$4   ' $3VKKKKK'. .4 $2LJ $1K. .'KKKKKV $3'   \n"
+            "$3      'VK'. .4KK $2LJ $1KKA. .'KV'      \n"
+            "$3     A. . .4KKKK $2LJ $1KKKKA. . .4     \n"
+            "$3     KKA. 'KKKKK $2LJ $1KKKKK' .4KK     \n"
+            "$3     KKSSA. VKKK $2LJ $1KKKV .4SSKK     \n"
+            "$2              <><><><>              \n"
+            "$1               'MKKM'               \n"
+            "$1                 ''                 ",
+        .colors = {
+            "33", //yellow
+            "32", //green
+            "34", //blue
+            "35", //magenta
+            "37", //white
+            NULL
+        }
+    },
+    { // CentOSSmall
+        .names = {"centos_small", "centos-linux-small", NULL},
+        .lines =
+            "$2 ____$1^$4____ \n"
+            "$2 |\\  $1|$4  /| \n"
+            "$2 | \\ $1|$4 / | \n"
+            "$4<---- $3---->\n"
+            "$3 | / $2|$1 \\ | \n"
+            "$3 |/__$2|$1__\\| \n"
+            "$2     v     ",
+        .colors = {
+            "33", //yellow
+            "32", //green
+            "34", //blue
+            "35", //magenta
+            NULL
+        }
+    },
+    { // Debian
+        .names = {"debian", "debian-linux", NULL},
+        .lines =
+            "$2       _,met$$$$$$$$$$gg.       \n"
+            "$2    ,g$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$P.    \n"
+            "$2  ,g$$$$P\"         \"\"\"Y$$$$.\". \n"
+            "$2 ,$$$$P'               `$$$$$$. \n"
+            "$2',$$$$P       ,ggs.     `$$$$b:\n"
+            "$2`d$$$$'     ,$P\"'   $1.$2    $$$$$$ \n"
+            "$2 $$$$P      d$'     $1,$2    $$$$$$P\n"
+            "$2 $$$$:      $$.   $1-$2    ,d$$$$'  \n"
+            "$2 $$$$;      Y$b._   _,d$P'   \n"
+            "$2 Y$$$$.    $1`.$2`\"Y$$$$$$$$P\"'      \n "
+            "$2 `$$$$b      $1\"-.__          \n"
+            "$2  `Y$$$$                     \n"
+            "$2   `Y$$$$.                   \n"
+            "$2     `$$$$b.                 \n"
+            "$2       `Y$$$$b.              \n"
+            "$2          `\"Y$$b._          \n"
+            "$2             `\"\"\"          ",
+        .colors = {
+            "31", //red
+            "37", //white
+            NULL
+        }
+    },
+    { // DebianSmall
+        .names = {"debian_small", "debian-linux-small", NULL},
+        .lines =
+            "$1  _____  \n"
+            "$1 /  __ \\ \n"
+            "$1|  /    |\n"
+            "$1|  \\___- \n"
+            "$1-_       \n"
+            "$1  --_    ",
+        .colors = {
+            "31", //red
+            NULL
+        }
+    },
+    { // Endeavour
+        .names = {"endeavour", "endeavour-linux", "endeavouros", "endeavouros-linux", NULL},
+        .lines =
+            "$2                     ./$1o$3.               \n"
+            "$2                   ./$1sssso$3-             \n"
+            "$2                 `:$1osssssss+$3-           \n"
+            "$2               `:+$1sssssssssso$3/.         \n"
+            "$2             `-/o$1ssssssssssssso$3/.       \n"
+            "$2           `-/+$1sssssssssssssssso$3+:`     \n"
+            "$2         `-:/+$1sssssssssssssssssso$3+/.    \n"
+            "$2       `.://o$1sssssssssssssssssssso$3++-   \n"
+            "$2      .://+$1ssssssssssssssssssssssso$3++:  \n"
+            "$2    .:///o$1ssssssssssssssssssssssssso$3++: \n"
+            "$2  `:////$1ssssssssssssssssssssssssssso$3+++.\n"
+            "$2`-////+$1ssssssssssssssssssssssssssso$3++++-\n"
+            "$2 `..-+$1oosssssssssssssssssssssssso$3+++++/`\n"
+            "$3./++++++++++++++++++++++++++++++/:.     \n"
+            "$3`:::::::::::::::::::::::::------``      ",
+        .colors = {
+            "35", //magenta
+            "31", //red
+            "34", //blue
+            NULL
+        }
+    },
+    { // Fedora
+        .names = {"fedora", "fedora-linux", NULL},
+        .lines =
+            "$1             .',;::::;,'.             \n"
+            "$1         .';:cccccccccccc:;,.         \n"
+            "$1      .;cccccccccccccccccccccc;.      \n"
+            "$1    .:cccccccccccccccccccccccccc:.    \n"
+            "$1  .;ccccccccccccc;$2.:dddl:.$1;ccccccc;.  \n"
+            "$1 .:ccccccccccccc;$2OWMKOOXMWd$1;ccccccc:. \n"
+            "$1.:ccccccccccccc;$2KMMc$1;cc;$2xMMc$1;ccccccc:.\n"
+            "$1,cccccccccccccc;$2MMM.$1;cc;$2;WW:$1;cccccccc,\n"
+            "$1:cccccccccccccc;$2MMM.$1;cccccccccccccccc:\n"
+            "$1:ccccccc;$2oxOOOo$1;$2MMM000k.$1;cccccccccccc:\n"
+            "$1cccccc;$20MMKxdd:$1;$2MMMkddc.$1;cccccccccccc;\n"
+            "$1ccccc;$2XMO'$1;cccc;$2MMM.$1;cccccccccccccccc'\n"
+            "$1ccccc;$2MMo$1;ccccc;$2MMW.$1;ccccccccccccccc; \n"
+            "$1ccccc;$20MNc.$1ccc$2.xMMd$1;ccccccccccccccc;  \n"
+            "$1cccccc;$2dNMWXXXWM0:$1;cccccccccccccc:,   \n"
+            "$1cccccccc;$2.:odl:.$1;cccccccccccccc:,.    \n"
+            "$1ccccccccccccccccccccccccccccc:'.      \n"
+            "$1:ccccccccccccccccccccccc:;,..         \n"
+            "$1 ':cccccccccccccccc::;,.              ",
+        .colors = {
+            "34", //blue
+            "37", //white
+            NULL
+        }
+    },
+    { // FedoraSmall
+        .names = {"fedora_small", "fedora-linux-small", NULL},
+        .lines =
+            "$1        ,'''''. \n"
+            "$1       |   ,.  |\n"
+            "$1       |  |  '_'\n"
+            "$1  ,....|  |..   \n"
+            "$1.'  ,_;|   ..'  \n"
+            "$1|  |   |  |     \n"
+            "$1|  ',_,'  |     \n"
+            "$1 '.     ,'      \n"
+            "$1   '''''        ",
+        .colors = {
+            "34", //blue
+            NULL
+        }
+    },
+    { // FedoraOld
+        .names = {"fedora_old", "fedora-old", "fedora-linux-old", "fedora-linux_old", NULL},
+        .lines =
+            "$1          /:-------------:\\       \n"
+            "$1       :-------------------::     \n"
+            "$1     :-----------$2/shhOHbmp$1---:\\   \n"
+            "$1   /-----------$2omMMMNNNMMD$1  ---:  \n"
+            "$1  :-----------$2sMMMMNMNMP$1.    ---: \n"
+            "$1 :-----------$2:MMMdP$1-------    ---\\\n"
+            "$1,------------$2:MMMd$1--------    ---:\n"
+            "$1:------------$2:MMMd$1-------    .---:\n"
+            "$1:----    $2oNMMMMMMMMMNho$1     .----:\n"
+            "$1:--     .$2+shhhMMMmhhy++$1   .------/\n"
+            "$1:-    -------$2:MMMd$1--------------: \n"
+            "$1:-   --------$2/MMMd$1-------------;  \n"
+            "$1:-    ------$2/hMMMy$1------------:   \n"
+            "$1:--$2 :dMNdhhdNMMNo$1------------;    \n"
+            "$1:---$2:sdNMMMMNds:$1------------:     \n"
+            "$1:------$2:://:$1-------------::       \n"
+            "$1:---------------------://         ",
+        .colors = {
+            "34", //blue
+            "37", //white
+            NULL
+        }
+    },
+    { // Garuda
+        .names = {"garuda", "garuda-linux", NULL},
+        .lines =
+            "$1                   .%;888:8898898:            \n"
+            "$1                 x;XxXB%89b8:b8%b88:          \n"
+            "$1              .8Xxd                8X:.       \n"
+            "$1            .8Xx;                    8x:.     \n"
+            "$1          .tt8x          .d            x88;   \n"
+            "$1       .@8x8;          .db:              xx@; \n"
+            "$1     ,tSXX°          .bbbbbbbbbbbbbbbbbbbB8x@;\n"
+            "$1   .SXxx            bBBBBBBBBBBBBBBBBBBBbSBX8;\n"
+            "$1 ,888S                                     pd!\n"
+            "$18X88/                                       q \n"
+            "$18X88/                                         \n"
+            "$1GBB.                                          \n"
+            "$1 x%88        d888@8@X@X@X88X@@XX@@X@8@X.      \n"
+            "$1   dxXd    dB8b8b8B8B08bB88b998888b88x.       \n"
+            "$1    dxx8o                      .@@;.          \n"
+            "$1      dx88                   .t@x.            \n"
+            "$1        d:SS@8ba89aa67a853Sxxad.              \n"
+            "$1          .d988999889889899dd.                ",
+        .colors = {
+            "31", //red
+            NULL
+        }
+    },
+    { // Gentoo
+        .names = {"gentoo", "gentoo-linux", NULL},
+        .lines =
+            "$1         -/oyddmdhs+:.             \n"
+            "$1     -o$2dNMMMMMMMMNNmhy+$1-`          \n"
+            "$1   -y$2NMMMMMMMMMMMNNNmmdhy$1+-        \n"
+            "$1 `o$2mMMMMMMMMMMMMNmdmmmmddhhy$1/`     \n"
+            "$1 om$2MMMMMMMMMMMN$1hhyyyo$2hmdddhhhd$1o`   \n"
+            "$1.y$2dMMMMMMMMMMd$1hs++so/s$2mdddhhhhdm$1+` \n"
+            "$1 oy$2hdmNMMMMMMMN$1dyooy$2dmddddhhhhyhN$1d.\n"
+            "$1  :o$2yhhdNNMMMMMMMNNNmmdddhhhhhyym$1Mh\n"
+            "$1    .:$2+sydNMMMMMNNNmmmdddhhhhhhmM$1my\n"
+            "$1       /m$2MMMMMMNNNmmmdddhhhhhmMNh$1s:\n"
+            "$1    `o$2NMMMMMMMNNNmmmddddhhdmMNhs$1+` \n"
+            "$1  `s$2NMMMMMMMMNNNmmmdddddmNMmhs$1/.   \n"
+            "$1 /N$2MMMMMMMMNNNNmmmdddmNMNdso$1:`     \n"
+            "$1+M$2MMMMMMNNNNNmmmmdmNMNdso$1/-        \n"
+            "$1yM$2MNNNNNNNmmmmmNNMmhs+/$1-`          \n"
+            "$1/h$2MMNNNNNNNNMNdhs++/$1-`             \n"
+            "$1`/$2ohdmmddhys+++/:$1.`                \n"
+            "$1  `-//////:--.                     ",
+        .colors = {
+            "35", //magenta
+            "37", //white
+            NULL
+        }
+    },
+    { // GentooSmall
+        .names = {"gentoo_small", "gentoo-linux-small", NULL},
+        .lines =
+            "$1 _-----_    \n"
+            "$1(       \\  \n"
+            "$1\\    0   \\  \n"
+            "$2 \\        ) \n"
+            "$2 /      _/  \n"
+            "$2(     _-    \n"
+            "$2\\____-      ",
+        .colors = {
+            "35", //magenta
+            "37", //white
+            NULL
+        }
+    },
+    { // Manjaro
+        .names = {"manjaro", "manjaro-linux", NULL},
+        .lines =
+            "$1██████████████████  ████████\n"
+            "$1██████████████████  ████████\n"
+            "$1██████████████████  ████████\n"
+            "$1██████████████████  ████████\n"
+            "$1████████            ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████\n"
+            "$1████████  ████████  ████████",
+        .colors = {
+            "32", //green
+            NULL
+        }
+    },
+    { // ManjaroSmall
+        .names = {"manjaro_small", "manjaro-linux-small", NULL},
+        .lines =
+            "$1||||||||| ||||\n"
+            "$1||||||||| ||||\n"
+            "$1||||      ||||\n"
+            "$1|||| |||| ||||\n"
+            "$1|||| |||| ||||\n"
+            "$1|||| |||| ||||\n"
+            "$1|||| |||| ||||",
+        .colors = {
+            "32", //green
+            NULL
+        }
+    },
+    { // Mint
+        .names = {"mint", "linuxmint", "mint-linux", "linux-mint", NULL},
+        .lines =
+            "$2             ...-:::::-...              \n"
+            "$2          .-MMMMMMMMMMMMMMM-.           \n"
+            "$2      .-MMMM$1`..-:::::::-..`$2MMMM-.       \n"
+            "$2    .:MMMM$1.:MMMMMMMMMMMMMMM:.$2MMMM:.     \n"
+            "$2   -MMM$1-M---MMMMMMMMMMMMMMMMMMM.$2MMM-    \n"
+            "$2 `:MMM$1:MM`  :MMMM:....::-...-MMMM:$2MMM:` \n"
+            "$2 :MMM$1:MMM`  :MM:`  ``    ``  `:MMM:$2MMM: \n"
+            "$2.MMM$1.MMMM`  :MM.  -MM.  .MM-  `MMMM.$2MMM.\n"
+            "$2:MMM$1:MMMM`  :MM.  -MM-  .MM:  `MMMM-$2MMM:\n"
+            "$2:MMM$1:MMMM`  :MM.  -MM-  .MM:  `MMMM:$2MMM:\n"
+            "$2:MMM$1:MMMM`  :MM.  -MM-  .MM:  `MMMM-$2MMM:\n"
+            "$2.MMM$1.MMMM`  :MM:--:MM:--:MM:  `MMMM.$2MMM.\n"
+            "$2 :MMM$1:MMM-  `-MMMMMMMMMMMM-`  -MMM-$2MMM: \n"
+            "$2  :MMM$1:MMM:`                `:MMM:$2MMM:  \n"
+            "$2   .MMM$1.MMMM:--------------:MMMM.$2MMM.   \n"
+            "$2     '-MMMM$1.-MMMMMMMMMMMMMMM-.$2MMMM-'    \n"
+            "$2       '.-MMMM$1``--:::::--``$2MMMM-.'      \n"
+            "$2            '-MMMMMMMMMMMMM-'           \n"
+            "$2               ``-:::::-``              ",
+        .colors = {
+            "32", //green
+            "37", //white
+            NULL
+        }
+    },
+    { // MintSmall
+        .names = {"mint_small", "linuxmint_small", "mint-linux-small", NULL},
+        .lines =
+            "$1 __________  \n"
+            "$1|_          \\\n"
+            "$1  | $2| _____ $1|\n"
+            "$1  | $2| | | | $1|\n"
+            "$1  | $2| | | | $1|\n"
+            "$1  | $2\\__$2___/ $1|\n"
+            "$1  \\_________/",
+        .colors = {
+            "32", //green
+            "37", //white
+            NULL
+        }
+    },
+    { // MintOld
+        .names = {"mint_old", "mint-old", "mint-linux_old", "mint-linux-old", "linux-mint_old", "linux-mint-old", NULL},
+        .lines =
+            "$1MMMMMMMMMMMMMMMMMMMMMMMMMmds+.     \n"
+            "$1MMm----::-://////////////oymNMd+`  \n"
+            "$1MMd      $2/++                $1-sNMd: \n"
+            "$1MMNso/`  $2dMM    `.::-. .-::.` $1.hMN:\n"
+            "$1ddddMMh  $2dMM   :hNMNMNhNMNMNh: $1`NMm\n"
+            "$1    NMm  $2dMM  .NMN/-+MMM+-/NMN` $1dMM\n"
+            "$1    NMm  $2dMM  -MMm  `MMM   dMM. $1dMM\n"
+            "$1    NMm  $2dMM  -MMm  `MMM   dMM. $1dMM\n"
+            "$1    NMm  $2dMM  .mmd  `mmm   yMM. $1dMM\n"
+            "$1    NMm  $2dMM`  ..`   ...   ydm. $1dMM\n"
+            "$1    hMM- $2+MMd/-------...-:sdds  $1dMM\n"
+            "$1    -NMm- $2:hNMNNNmdddddddddy/`  $1dMM\n"
+            "$1    -dMNs-$2``-::::-------.``    $1dMM \n"
+            "$1    `/dMNmy+/:-------------:/yMMM  \n"
+            "$1      ./ydNMMMMMMMMMMMMMMMMMMMMM   \n"
+            "$1          .MMMMMMMMMMMMMMMMMMM     ",
+        .colors = {
+            "32", //green
+            "37", //white
+            NULL
+        }
+    },
+    { // Pop
+        .names = {"pop", "popos", "pop_os", "pop-linux", NULL},
+        .lines =
+            "$1             /////////////             \n"
+            "$1         /////////////////////         \n"
+            "$1      ///////$2*767$1////////////////      \n"
+            "$1    //////$27676767676*$1//////////////    \n"
+            "$1   /////$276767$1//$27676767$1//////////////   \n"
+            "$1  /////$2767676$1///$2*76767$1///////////////  \n"
+            "$1 ///////$2767676$1///$276767$1.///$27676*$1/////// \n"
+            "$1/////////$2767676$1//$276767$1///$2767676$1////////\n"
+            "$1//////////$276767676767$1////$276767$1/////////\n"
+            "$1///////////$276767676$1//////$27676$1//////////\n"
+            "$1////////////,$27676$1,///////$2767$1///////////\n"
+            "$1/////////////*$27676$1///////$276$1////////////\n"
+            "$1///////////////$27676$1////////////////////\n"
+            "$1 ///////////////$27676$1///$2767$1//////////// \n"
+            "$1  //////////////////////$2'$1////////////  \n"
+            "$1   //////$2.7676767676767676767,$1//////   \n"
+            "$1    /////$2767676767676767676767$1/////    \n"
+            "$1      ///////////////////////////      \n"
+            "$1         /////////////////////         \n"
+            "$1             /////////////             ",
+        .colors = {
+            "36", //cyan
+            "37", //white
+            NULL
+        }
+    },
+    { // PopSmall
+        .names = {"pop_small", "popos_small", "pop_os_small", "pop-linux-small", NULL},
+        .lines =
+    "$1______           \n"
+    "$1\\   _ \\        __\n"
+    "$1 \\ \\ \\ \\      / /\n"
+    "$1  \\ \\_\\ \\    / / \n"
+    "$1   \\  ___\\  /_/  \n"
+    "$1    \\ \\    _     \n"
+    "$1   __\\_\\__(_)_   \n"
+    "$1  (___________)` ",
+        .colors = {
+            "36", //cyan
+            NULL
+        }
+    },
+    { // Ubuntu
+        .names = {"ubuntu", "ubuntu-linux", NULL},
+        .lines =
+            "$1             .-/+oossssoo+/-.           \n"
+            "$1         `:+ssssssssssssssssss+:`       \n"
+            "$1       -+ssssssssssssssssssyyssss+-     \n"
+            "$1     .ossssssssssssssssssd$2MMMNy$1sssso.   \n"
+            "$1   /sssssssssss$2hdmmNNmmyNMMMMh$1ssssss/   \n"
+            "$1  +sssssssss$2hmydMMMMMMMNddddy$1ssssssss+  \n"
+            "$1 /ssssssss$2hNMMMyhhyyyyhmNMMMNh$1ssssssss/ \n"
+            "$1.ssssssss$2dMMMNh$1ssssssssss$2hNMMMd$1ssssssss.\n"
+            "$1+ssss$2hhhyNMMNy$1ssssssssssss$2yNMMMy$1sssssss+\n"
+            "$1oss$2yNMMMNyMMh$1ssssssssssssss$2hmmmh$1ssssssso\n"
+            "$1oss$2yNMMMNyMMh$1ssssssssssssss$2hmmmh$1ssssssso\n"
+            "$1+ssss$2hhhyNMMNy$1ssssssssssss$2yNMMMy$1sssssss+\n"
+            "$1.ssssssss$2dMMMNh$1ssssssssss$2hNMMMd$1ssssssss.\n"
+            "$1 /ssssssss$2hNMMMyhhyyyyhdNMMMNh$1ssssssss/ \n"
+            "$1  +sssssssss$2dmydMMMMMMMMddddy$1ssssssss+  \n"
+            "$1   /sssssssssss$2hdmNNNNmyNMMMMh$1ssssss/   \n"
+            "$1    .ossssssssssssssssss$2dMMMNy$1sssso.    \n"
+            "$1     -+sssssssssssssssss$2yyy$1ssss+-       \n"
+            "$1       `:+ssssssssssssssssss+:`         \n"
+            "$1           .-/+oossssoo+/-.             ",
+        .colors = {
+            "31", //red
+            "37", //white
+            NULL
+        }
+    },
+    { // UbuntuSmall
+        .names = {"ubuntu_small", "ubuntu-linux-small", NULL},
+        .lines =
+            "$1         _ \n"
+            "$1     ---(_)\n"
+            "$1 _/  ---  \\\n"
+            "$1(_) |   |  \n"
+            "$1  \\  --- _/\n"
+            "$1     ---(_)",
+        .colors = {
+            "31", //red
+            NULL
+        }
+    },
+    { // Void
+        .names = {"void", "void-linux", NULL},
+        .lines =
+            "$1                __.;=====;.__                \n"
+            "$1            _.=+==++=++=+=+===;.             \n"
+            "$1             -=+++=+===+=+=+++++=_           \n"
+            "$1        .     -=:``     `--==+=++==.         \n"
+            "$1       _vi,    `            --+=++++:        \n"
+            "$1      .uvnvi.       _._       -==+==+.       \n"
+            "$1     .vvnvnI`    .;==|==;.     :|=||=|.      \n"
+            "$2+QmQQm$1pvvnv;$2 _yYsyQQWUUQQQm #QmQ#$1:$2QQQWUV$QQm.\n"
+            "$2 -QQWQW$1pvvo$2wZ?.wQQQE$1==<$2QWWQ/QWQW.QQWW$1(:$2 jQWQE\n"
+            "$2  -$QQQQmmU'  jQQQ$1@+=<$2QWQQ)mQQQ.mQQQC$1+;$2jWQQ@'\n"
+            "$2   -$WQ8Y$1nI:$2   QWQQwgQQWV$1`$2mWQQ.jQWQQgyyWW@!  \n"
+            "$1     -1vvnvv.     `~+++`        ++|+++       \n"
+            "$1      +vnvnnv,                 `-|===        \n"
+            "$1       +vnvnvns.           .      :=-        \n"
+            "$1        -Invnvvnsi..___..=sv=.     `         \n"
+            "$1          +Invnvnvnnnnnnnnvvnn;.             \n"
+            "$1            ~|Invnvnvvnvvvnnv}+`             \n"
+            "$1               -~|{*l}*|~                    ",
+        .colors = {
+            "32", //green
+            "30", //black
+            NULL
+        }
+    },
+    { // VoidSmall
+        .names = {"void_small", "void-linux-small", NULL},
+        .lines =
+            "$1    _______  \n"
+            "$1 _ \\______ - \n"
+            "$1| \\  ___  \\ |\n"
+            "$1| | /   \\ | |\n"
+            "$1| | \\___/ | |\n"
+            "$1| \\______ \\_|\n"
+            "$1 -_______\\   ",
+        .colors = {
+            "32", //green
+            NULL
+        }
+    }
+};
+
+const uint32_t ffLogoSourcesLength = sizeof(ffLogoSources) / sizeof(ffLogoSources[0]);
@@ -0,0 +1,21 @@
+#pragma once
+
+#ifndef FASTFETCH_INCLUDED_LOGO_BUILTIN
+#define FASTFETCH_INCLUDED_LOGO_BUILTIN
+
+#include "fastfetch.h"
+
+#define FF_LOGO_SOURCE_MAX_NAMES 8
+
+//Source of a builtin logo. Only used by the logo generator, fastfetch itself uses the compiled table
+typedef struct FFlogoSource
+{
+    const char* names[FF_LOGO_SOURCE_MAX_NAMES]; //Null terminated
+    const char* lines;
+    const char* colors[FASTFETCH_LOGO_MAX_COLORS + 1]; //Null terminated, [0] is used as key color
+} FFlogoSource;
+
+extern const FFlogoSource ffLogoSources[];
+extern const uint32_t ffLogoSourcesLength;
+
+#endif
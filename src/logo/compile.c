@@ -0,0 +1,288 @@
+#include "fastfetch.h"
+
+typedef struct CodepointRange
+{
+    uint32_t first;
+    uint32_t last;
+} CodepointRange;
+
+//Combining marks, variation selectors and other characters that don't advance the cursor
+static const CodepointRange zeroWidthRanges[] = {
+    {0x0300, 0x036F},
+    {0x0483, 0x0489},
+    {0x0591, 0x05BD},
+    {0x0610, 0x061A},
+    {0x064B, 0x065F},
+    {0x0E31, 0x0E31},
+    {0x0E34, 0x0E3A},
+    {0x0E47, 0x0E4E},
+    {0x1AB0, 0x1AFF},
+    {0x1DC0, 0x1DFF},
+    {0x200B, 0x200F},
+    {0x202A, 0x202E},
+    {0x2060, 0x2064},
+    {0x20D0, 0x20FF},
+    {0xFE00, 0xFE0F},
+    {0xFE20, 0xFE2F},
+    {0xFEFF, 0xFEFF},
+    {0xE0100, 0xE01EF}
+};
+
+//East asian wide and fullwidth characters, emojis
+static const CodepointRange doubleWidthRanges[] = {
+    {0x1100, 0x115F},
+    {0x231A, 0x231B},
+    {0x2329, 0x232A},
+    {0x23E9, 0x23EC},
+    {0x23F0, 0x23F0},
+    {0x23F3, 0x23F3},
+    {0x25FD, 0x25FE},
+    {0x2614, 0x2615},
+    {0x2648, 0x2653},
+    {0x267F, 0x267F},
+    {0x2693, 0x2693},
+    {0x26A1, 0x26A1},
+    {0x26AA, 0x26AB},
+    {0x26BD, 0x26BE},
+    {0x26C4, 0x26C5},
+    {0x26CE, 0x26CE},
+    {0x26D4, 0x26D4},
+    {0x26EA, 0x26EA},
+    {0x26F2, 0x26F3},
+    {0x26F5, 0x26F5},
+    {0x26FA, 0x26FA},
+    {0x26FD, 0x26FD},
+    {0x2705, 0x2705},
+    {0x270A, 0x270B},
+    {0x2728, 0x2728},
+    {0x274C, 0x274C},
+    {0x274E, 0x274E},
+    {0x2753, 0x2755},
+    {0x2757, 0x2757},
+    {0x2795, 0x2797},
+    {0x27B0, 0x27B0},
+    {0x27BF, 0x27BF},
+    {0x2B1B, 0x2B1C},
+    {0x2B50, 0x2B50},
+    {0x2B55, 0x2B55},
+    {0x2E80, 0x303E},
+    {0x3041, 0x33FF},
+    {0x3400, 0x4DBF},
+    {0x4E00, 0x9FFF},
+    {0xA000, 0xA4CF},
+    {0xA960, 0xA97F},
+    {0xAC00, 0xD7A3},
+    {0xF900, 0xFAFF},
+    {0xFE10, 0xFE19},
+    {0xFE30, 0xFE6F},
+    {0xFF00, 0xFF60},
+    {0xFFE0, 0xFFE6},
+    {0x16FE0, 0x16FE4},
+    {0x17000, 0x18CFF},
+    {0x1B000, 0x1B2FF},
+    {0x1F004, 0x1F004},
+    {0x1F0CF, 0x1F0CF},
+    {0x1F18E, 0x1F18E},
+    {0x1F191, 0x1F19A},
+    {0x1F200, 0x1F251},
+    {0x1F300, 0x1F64F},
+    {0x1F680, 0x1F6FF},
+    {0x1F7E0, 0x1F7EB},
+    {0x1F90C, 0x1F9FF},
+    {0x1FA70, 0x1FAFF},
+    {0x20000, 0x2FFFD},
+    {0x30000, 0x3FFFD}
+};
+
+static bool isInRanges(uint32_t codepoint, const CodepointRange* ranges, uint32_t numRanges)
+{
+    //Binary search, the ranges are sorted
+    uint32_t low = 0;
+    uint32_t high = numRanges;
+
+    while(low < high)
+    {
+        uint32_t mid = (low + high) / 2;
+
+        if(codepoint < ranges[mid].first)
+            high = mid;
+        else if(codepoint > ranges[mid].last)
+            low = mid + 1;
+        else
+            return true;
+    }
+
+    return false;
+}
+
+uint32_t ffLogoCharWidth(uint32_t codepoint)
+{
+    if(codepoint < 0x20 || (codepoint >= 0x7F && codepoint < 0xA0))
+        return 0;
+
+    if(codepoint < 0x0300)
+        return 1;
+
+    if(isInRanges(codepoint, zeroWidthRanges, sizeof(zeroWidthRanges) / sizeof(zeroWidthRanges[0])))
+        return 0;
+
+    if(isInRanges(codepoint, doubleWidthRanges, sizeof(doubleWidthRanges) / sizeof(doubleWidthRanges[0])))
+        return 2;
+
+    return 1;
+}
+
+uint32_t ffLogoNextChar(const char* text, uint32_t length, uint32_t* width)
+{
+    uint8_t c = (uint8_t) text[0];
+
+    uint32_t charLength;
+    uint32_t codepoint;
+
+    if(c <= 127)
+    {
+        *width = ffLogoCharWidth(c);
+        return 1;
+    }
+    else if((c & 0xE0) == 0xC0)
+    {
+        charLength = 2;
+        codepoint = c & 0x1Fu;
+    }
+    else if((c & 0xF0) == 0xE0)
+    {
+        charLength = 3;
+        codepoint = c & 0x0Fu;
+    }
+    else if((c & 0xF8) == 0xF0)
+    {
+        charLength = 4;
+        codepoint = c & 0x07u;
+    }
+    else
+        charLength = 0;
+
+    //Invalid utf8 is printed byte by byte, assume every byte takes one column
+    if(charLength == 0 || charLength > length)
+    {
+        *width = 1;
+        return 1;
+    }
+
+    for(uint32_t i = 1; i < charLength; ++i)
+    {
+        uint8_t continuation = (uint8_t) text[i];
+        if((continuation & 0xC0) != 0x80)
+        {
+            *width = 1;
+            return 1;
+        }
+        codepoint = (codepoint << 6) | (continuation & 0x3Fu);
+    }
+
+    *width = ffLogoCharWidth(codepoint);
+    return charLength;
+}
+
+static void appendSegment(FFlist* segments, FFlogoLine* line, FFlogoSegmentType type, const char* text, uint32_t value)
+{
+    if(type == FF_LOGO_SEGMENT_TYPE_TEXT && value == 0)
+        return;
+
+    FFlogoSegment* segment = ffListAdd(segments);
+    segment->type = type;
+    segment->value = value;
+    segment->text = text;
+    segment->width = 0;
+
+    if(type != FF_LOGO_SEGMENT_TYPE_TEXT)
+        return;
+
+    for(uint32_t i = 0; i < value;)
+    {
+        uint32_t width;
+        i += ffLogoNextChar(text + i, value - i, &width);
+        segment->width += width;
+    }
+
+    line->width += segment->width;
+}
+
+uint32_t ffLogoCompile(const char* text, uint32_t length, bool parseColors, bool parseEscapes, FFlist* segments, FFlist* lines)
+{
+    uint32_t maxWidth = 0;
+    uint32_t i = 0;
+
+    while(i < length)
+    {
+        FFlogoLine* line = ffListAdd(lines);
+        line->firstSegment = segments->length;
+        line->width = 0;
+
+        //Start of the text that is not yet added as segment
+        uint32_t start = i;
+
+        while(i < length && text[i] != '\n')
+        {
+            //A color sequence directly in the logo
+            if(parseEscapes && text[i] == '\033' && i + 1 < length && text[i + 1] == '[')
+            {
+                uint32_t end = i + 2;
+                while(end < length && text[end] != '\n' && text[end] != 'm')
+                    ++end;
+
+                if(end < length && text[end] == 'm')
+                {
+                    appendSegment(segments, line, FF_LOGO_SEGMENT_TYPE_TEXT, text + start, i - start);
+                    appendSegment(segments, line, FF_LOGO_SEGMENT_TYPE_ESCAPE, text + i, end + 1 - i);
+                    i = end + 1;
+                    start = i;
+                    continue;
+                }
+            }
+
+            //Not a color placeholder, or a dollar sign at the end of the line
+            if(!parseColors || text[i] != '$' || i + 1 >= length || text[i + 1] == '\n')
+            {
+                ++i;
+                continue;
+            }
+
+            char next = text[i + 1];
+
+            //Two dollar signs, keep the first one
+            if(next == '$')
+            {
+                appendSegment(segments, line, FF_LOGO_SEGMENT_TYPE_TEXT, text + start, i + 1 - start);
+                i += 2;
+                start = i;
+                continue;
+            }
+
+            //Map the number to an array index, so that '1' -> 0, '2' -> 1, etc.
+            if(next >= '1' && next < '1' + FASTFETCH_LOGO_MAX_COLORS)
+            {
+                appendSegment(segments, line, FF_LOGO_SEGMENT_TYPE_TEXT, text + start, i - start);
+                appendSegment(segments, line, FF_LOGO_SEGMENT_TYPE_COLOR, NULL, (uint32_t) (next - '1'));
+                i += 2;
+                start = i;
+                continue;
+            }
+
+            //Invalid index, keep the $ and the following char
+            i += 2;
+        }
+
+        appendSegment(segments, line, FF_LOGO_SEGMENT_TYPE_TEXT, text + start, i - start);
+        line->numSegments = segments->length - line->firstSegment;
+
+        if(line->width > maxWidth)
+            maxWidth = line->width;
+
+        //Skip the newline
+        if(i < length)
+            ++i;
+    }
+
+    return maxWidth;
+}
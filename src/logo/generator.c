@@ -0,0 +1,215 @@
+#include "logo/builtin.h"
+
+#include <string.h>
+#include <strings.h>
+
+//Compiles the builtin logos into segment tables and a perfect hash table of their names.
+//Runs at build time, the output is included by common/logo.c
+
+typedef struct NameEntry
+{
+    const char* name;
+    uint32_t logo;
+} NameEntry;
+
+static void writeString(FILE* file, const char* text, uint32_t length)
+{
+    fputc('"', file);
+
+    for(uint32_t i = 0; i < length; ++i)
+    {
+        uint8_t c = (uint8_t) text[i];
+
+        if(c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if(c == '?')
+            fputs("\\?", file); //Avoid trigraphs
+        else if(c < 0x20 || c == 0x7F)
+            fprintf(file, "\\%03o", c);
+        else
+            fputc(c, file);
+    }
+
+    fputc('"', file);
+}
+
+int main(int argc, char** argv)
+{
+    if(argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+        return 1;
+    }
+
+    FFlist segments;
+    ffListInitA(&segments, sizeof(FFlogoSegment), 4096);
+
+    FFlist lines;
+    ffListInitA(&lines, sizeof(FFlogoLine), 1024);
+
+    uint32_t* firstLines = malloc(sizeof(uint32_t) * ffLogoSourcesLength);
+    uint32_t* widths = malloc(sizeof(uint32_t) * ffLogoSourcesLength);
+
+    uint32_t numNames = 0;
+    for(uint32_t i = 0; i < ffLogoSourcesLength; ++i)
+    {
+        firstLines[i] = lines.length;
+        widths[i] = ffLogoCompile(ffLogoSources[i].lines, (uint32_t) strlen(ffLogoSources[i].lines), true, false, &segments, &lines);
+
+        for(const char* const* name = ffLogoSources[i].names; *name != NULL; ++name)
+            ++numNames;
+    }
+
+    NameEntry* names = malloc(sizeof(NameEntry) * numNames);
+    numNames = 0;
+    for(uint32_t i = 0; i < ffLogoSourcesLength; ++i)
+    {
+        for(const char* const* name = ffLogoSources[i].names; *name != NULL; ++name)
+        {
+            for(uint32_t k = 0; k < numNames; ++k)
+            {
+                if(strcasecmp(names[k].name, *name) == 0)
+                {
+                    fprintf(stderr, "Error: logo name \"%s\" is used more than once\n", *name);
+                    return 1;
+                }
+            }
+
+            names[numNames].name = *name;
+            names[numNames].logo = i;
+            ++numNames;
+        }
+    }
+
+    const char** nameStrings = malloc(sizeof(const char*) * numNames);
+    for(uint32_t i = 0; i < numNames; ++i)
+        nameStrings[i] = names[i].name;
+
+    uint32_t tableSize = ffPerfectHashGetTableSize(numNames);
+    uint32_t* displacements = malloc(sizeof(uint32_t) * tableSize);
+    int32_t* slots = malloc(sizeof(int32_t) * tableSize);
+
+    if(!ffPerfectHashBuild(nameStrings, numNames, tableSize, displacements, slots))
+    {
+        fputs("Error: failed to build the logo name table\n", stderr);
+        return 1;
+    }
+
+    FILE* file = fopen(argv[1], "w");
+    if(file == NULL)
+    {
+        fprintf(stderr, "Error: failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    fputs("//Generated by fastfetch-logogen from src/logo/builtin.c, do not edit\n\n", file);
+    fprintf(file, "#define FF_LOGO_BUILTIN_COUNT %u\n", ffLogoSourcesLength);
+    fprintf(file, "#define FF_LOGO_NAME_TABLE_SIZE %u\n\n", tableSize);
+
+    fputs("static const FFlogoSegment builtinLogoSegments[] = {\n", file);
+    for(uint32_t i = 0; i < segments.length; ++i)
+    {
+        const FFlogoSegment* segment = ffListGet(&segments, i);
+        if(segment->type == FF_LOGO_SEGMENT_TYPE_COLOR)
+            fprintf(file, "    {FF_LOGO_SEGMENT_TYPE_COLOR, %u, 0, NULL},\n", segment->value);
+        else
+        {
+            fprintf(file, "    {FF_LOGO_SEGMENT_TYPE_TEXT, %u, %u, ", segment->value, segment->width);
+            writeString(file, segment->text, segment->value);
+            fputs("},\n", file);
+        }
+    }
+    fputs("};\n\n", file);
+
+    fputs("static const FFlogoLine builtinLogoLines[] = {\n", file);
+    for(uint32_t i = 0; i < lines.length; ++i)
+    {
+        const FFlogoLine* line = ffListGet(&lines, i);
+        fprintf(file, "    {%u, %u, %u},\n", line->firstSegment, line->numSegments, line->width);
+    }
+    fputs("};\n\n", file);
+
+    fputs("static const char* builtinLogoNames[] = {\n", file);
+    uint32_t nameIndex = 0;
+    for(uint32_t i = 0; i < ffLogoSourcesLength; ++i)
+    {
+        fputs("    ", file);
+        for(const char* const* name = ffLogoSources[i].names; *name != NULL; ++name)
+        {
+            writeString(file, *name, (uint32_t) strlen(*name));
+            fputs(", ", file);
+        }
+        fputs("NULL,\n", file);
+    }
+    fputs("};\n\n", file);
+
+    fputs("static const char* builtinLogoColors[] = {\n", file);
+    for(uint32_t i = 0; i < ffLogoSourcesLength; ++i)
+    {
+        fputs("    ", file);
+        for(const char* const* color = ffLogoSources[i].colors; *color != NULL; ++color)
+        {
+            writeString(file, *color, (uint32_t) strlen(*color));
+            fputs(", ", file);
+        }
+        fputs("NULL,\n", file);
+    }
+    fputs("};\n\n", file);
+
+    fputs("static const FFlogo builtinLogos[FF_LOGO_BUILTIN_COUNT] = {\n", file);
+    uint32_t colorIndex = 0;
+    for(uint32_t i = 0; i < ffLogoSourcesLength; ++i)
+    {
+        uint32_t numLines = (i + 1 < ffLogoSourcesLength ? firstLines[i + 1] : lines.length) - firstLines[i];
+
+        fprintf(file, "    {builtinLogoNames + %u, builtinLogoSegments, builtinLogoLines + %u, %u, %u, false, builtinLogoColors + %u},\n",
+            nameIndex, firstLines[i], numLines, widths[i], colorIndex
+        );
+
+        for(const char* const* name = ffLogoSources[i].names; *name != NULL; ++name)
+            ++nameIndex;
+        ++nameIndex;
+
+        for(const char* const* color = ffLogoSources[i].colors; *color != NULL; ++color)
+            ++colorIndex;
+        ++colorIndex;
+    }
+    fputs("};\n\n", file);
+
+    fputs("static const uint32_t builtinLogoNameDisplacements[FF_LOGO_NAME_TABLE_SIZE] = {\n", file);
+    for(uint32_t i = 0; i < tableSize; ++i)
+        fprintf(file, "    %u,\n", displacements[i]);
+    fputs("};\n\n", file);
+
+    fputs("static const struct { const char* name; uint32_t logo; } builtinLogoNameTable[FF_LOGO_NAME_TABLE_SIZE] = {\n", file);
+    for(uint32_t i = 0; i < tableSize; ++i)
+    {
+        if(slots[i] == -1)
+        {
+            fputs("    {NULL, 0},\n", file);
+            continue;
+        }
+
+        fputs("    {", file);
+        writeString(file, names[slots[i]].name, (uint32_t) strlen(names[slots[i]].name));
+        fprintf(file, ", %u},\n", names[slots[i]].logo);
+    }
+    fputs("};\n", file);
+
+    if(fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    free(slots);
+    free(displacements);
+    free(nameStrings);
+    free(names);
+    free(widths);
+    free(firstLines);
+    ffListDestroy(&lines);
+    ffListDestroy(&segments);
+
+    return 0;
+}
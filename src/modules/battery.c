@@ -4,7 +4,6 @@
 #include <dirent.h>
 
 #define FF_BATTERY_MODULE_NAME "Battery"
-#define FF_BATTERY_NUM_FORMAT_ARGS 5
 
 typedef struct BatteryResult
 {
@@ -85,9 +84,9 @@ static void parseBattery(FFstrbuf* dir, FFlist* results)
 
 static void printBattery(FFinstance* instance, const BatteryResult* result, uint8_t index)
 {
-    if(instance->config.batteryFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_BATTERY].format))
     {
-        ffPrintLogoAndKey(instance, FF_BATTERY_MODULE_NAME, index, &instance->config.batteryKey);
+        ffPrintLogoAndKey(instance, FF_BATTERY_MODULE_NAME, index, instance->state.modules[FF_MODULE_ID_BATTERY].key);
 
         bool showStatus =
             result->status.length > 0 &&
@@ -95,26 +94,26 @@ static void printBattery(FFinstance* instance, const BatteryResult* result, uint
 
         if(result->capacity.length > 0)
         {
-            ffStrbufWriteTo(&result->capacity, stdout);
-            putchar('%');
+            ffOutputWrite(instance, &result->capacity);
+            ffOutputWriteC(instance, '%');
 
             if(showStatus)
-                fputs(" [", stdout);
+                ffOutputWriteS(instance, " [");
         }
 
         if(showStatus)
         {
-            ffStrbufWriteTo(&result->status, stdout);
+            ffOutputWrite(instance, &result->status);
 
             if(result->capacity.length > 0)
-                putchar(']');
+                ffOutputWriteC(instance, ']');
         }
 
-        putchar('\n');
+        ffOutputWriteC(instance, '\n');
     }
     else
     {
-        ffPrintFormatString(instance, FF_BATTERY_MODULE_NAME, index, &instance->config.batteryKey, &instance->config.batteryFormat, NULL, FF_BATTERY_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_BATTERY_MODULE_NAME, index, instance->state.modules[FF_MODULE_ID_BATTERY].key, instance->state.modules[FF_MODULE_ID_BATTERY].format, NULL, FF_BATTERY_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->manufacturer},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->modelName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->technology},
@@ -144,13 +143,13 @@ void ffPrintBattery(FFinstance* instance)
     DIR* dirp = opendir(baseDir.chars);
     if(dirp == NULL)
     {
-        ffPrintError(instance, FF_BATTERY_MODULE_NAME, 0, &instance->config.batteryKey, &instance->config.batteryFormat, FF_BATTERY_NUM_FORMAT_ARGS, "opendir(\"%s\") == NULL", baseDir.chars);
+        ffPrintError(instance, FF_BATTERY_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_BATTERY].key, instance->state.modules[FF_MODULE_ID_BATTERY].format, FF_BATTERY_NUM_FORMAT_ARGS, "opendir(\"%s\") == NULL", baseDir.chars);
         ffStrbufDestroy(&baseDir);
         return;
     }
 
     FFlist results;
-    ffListInitA(&results, sizeof(BatteryResult), 4);
+    ffListInit(&results, sizeof(BatteryResult));
 
     struct dirent* entry;
     while((entry = readdir(dirp)) != NULL)
@@ -175,7 +174,7 @@ void ffPrintBattery(FFinstance* instance)
     }
 
     if(results.length == 0)
-        ffPrintError(instance, FF_BATTERY_MODULE_NAME, 0, &instance->config.batteryKey, &instance->config.batteryFormat, FF_BATTERY_NUM_FORMAT_ARGS, "%s doesn't contain any battery folder", baseDir.chars);
+        ffPrintError(instance, FF_BATTERY_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_BATTERY].key, instance->state.modules[FF_MODULE_ID_BATTERY].format, FF_BATTERY_NUM_FORMAT_ARGS, "%s doesn't contain any battery folder", baseDir.chars);
 
     ffListDestroy(&results);
     ffStrbufDestroy(&baseDir);
@@ -2,6 +2,9 @@
 
 void ffPrintBreak(FFinstance* instance)
 {
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        return;
+
     ffPrintLogoLine(instance);
-    putchar('\n');
+    ffOutputWriteC(instance, '\n');
 }
@@ -2,17 +2,20 @@
 
 void ffPrintColors(FFinstance* instance)
 {
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        return;
+
     ffPrintLogoLine(instance);
 
     for(uint8_t i = 0; i < 8; i++)
-        printf("\033[4%dm   ", i);
+        ffOutputWriteF(instance, "\033[4%dm   ", i);
 
-    puts("\033[0m");
+    ffOutputPutS(instance, "\033[0m");
 
     ffPrintLogoLine(instance);
 
     for(uint8_t i = 8; i < 16; i++)
-        printf("\033[48;5;%dm   ", i);
+        ffOutputWriteF(instance, "\033[48;5;%dm   ", i);
 
-    puts("\033[0m");
+    ffOutputPutS(instance, "\033[0m");
 }
@@ -3,7 +3,6 @@
 #include <string.h>
 
 #define FF_CPU_MODULE_NAME "CPU"
-#define FF_CPU_NUM_FORMAT_ARGS 14
 
 static double parseHz(FFstrbuf* content)
 {
@@ -34,68 +33,61 @@ static double getGhz(const char* policyFile, const char* cpuFile)
     return herz / 1000.0; //to GHz
 }
 
-void ffPrintCPU(FFinstance* instance)
+//Reads the frequency only if the format string uses it, or if no frequency with a higher priority was found for the default output
+static double getGhzIfNeeded(double* ghz, uint64_t usedArgs, uint64_t* detectedArgs, uint32_t argIndex, const char* policyFile, const char* cpuFile)
 {
-    if(ffPrintFromCache(instance, FF_CPU_MODULE_NAME, &instance->config.cpuKey, &instance->config.cpuFormat, FF_CPU_NUM_FORMAT_ARGS))
-        return;
-
-    FILE* cpuinfo = fopen("/proc/cpuinfo", "r");
-    if(cpuinfo == NULL)
+    if(*ghz > 0 && !(usedArgs & FF_FORMAT_ARG_MASK(argIndex)))
     {
-        ffPrintError(instance, FF_CPU_MODULE_NAME, 0, &instance->config.cpuKey, &instance->config.cpuFormat, FF_CPU_NUM_FORMAT_ARGS, "fopen(\"/proc/cpuinfo\", \"r\") == NULL");
-        return;
+        *detectedArgs &= ~FF_FORMAT_ARG_MASK(argIndex);
+        return 0;
     }
 
-    FFstrbuf name;
-    ffStrbufInitA(&name, 64);
+    double result = getGhz(policyFile, cpuFile);
+    if(*ghz == 0)
+        *ghz = result;
+    return result;
+}
 
-    FFstrbuf vendor;
-    ffStrbufInitA(&vendor, 64);
+void ffPrintCPU(FFinstance* instance)
+{
+    if(ffPrintFromCache(instance, FF_CPU_MODULE_NAME, instance->state.modules[FF_MODULE_ID_CPU].key, instance->state.modules[FF_MODULE_ID_CPU].format, FF_CPU_NUM_FORMAT_ARGS))
+        return;
 
-    FFstrbuf physicalCoresString;
-    ffStrbufInit(&physicalCoresString);
+    FFCPUResult result;
+    ffCPUResultInit(&result);
 
-    FFstrbuf procGhzString;
-    ffStrbufInit(&procGhzString);
+    bool cpuinfoRead = ffDetectCPU(instance, ffCPUIDNative, "/sys/devices/system/cpu", "/proc/cpuinfo", &result);
 
-    char* line = NULL;
-    size_t len = 0;
+    uint64_t usedArgs = ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_CPU].format);
+    uint64_t detectedArgs = UINT64_MAX;
 
-    while(getline(&line, &len, cpuinfo) != -1)
+    //The highest max frequency of all policies, so hybrid CPUs show the one of their fastest cores
+    uint32_t maxFrequency = 0;
+    FF_LIST_FOR_EACH(FFCPUPolicy, policy, &result.policies)
     {
-        //Stop after the first CPU
-        if(name.length > 0 && (*line == '\0' || *line == '\n'))
-            break;
-
-        (void)(
-            ffGetPropValue(line, "model name :", &name) ||
-            ffGetPropValue(line, "vendor_id :", &vendor) ||
-            ffGetPropValue(line, "cpu cores :", &physicalCoresString) ||
-            ffGetPropValue(line, "cpu MHz :", &procGhzString) ||
-            (name.length == 0 && ffGetPropValue(line, "Hardware :", &name)) //For Android devices
-        );
+        if(policy->maxFrequency > maxFrequency)
+            maxFrequency = policy->maxFrequency;
     }
 
-    if(line != NULL)
-        free(line);
-
-    fclose(cpuinfo);
-
-    double procGhz = parseHz(&procGhzString) / 1000.0; //to GHz
-    ffStrbufDestroy(&procGhzString);
-
-    double biosLimit      = getGhz("/sys/devices/system/cpu/cpufreq/policy0/bios_limit",       "/sys/devices/system/cpu/cpu0/cpufreq/bios_limit");
-    double scalingMaxFreq = getGhz("/sys/devices/system/cpu/cpufreq/policy0/scaling_max_freq", "/sys/devices/system/cpu/cpu0/cpufreq/scaling_max_freq");
-    double scalingMinFreq = getGhz("/sys/devices/system/cpu/cpufreq/policy0/scaling_min_freq", "/sys/devices/system/cpu/cpu0/cpufreq/scaling_min_freq");
-    double infoMaxFreq    = getGhz("/sys/devices/system/cpu/cpufreq/policy0/cpuinfo_max_freq", "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq");
-    double infoMinFreq    = getGhz("/sys/devices/system/cpu/cpufreq/policy0/cpuinfo_min_freq", "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_min_freq");
+    //The order is the priority for the displayed frequency
+    double ghz = maxFrequency / 1000.0 / 1000.0;
+    double biosLimit      = getGhzIfNeeded(&ghz, usedArgs, &detectedArgs, 8,  "/sys/devices/system/cpu/cpufreq/policy0/bios_limit",       "/sys/devices/system/cpu/cpu0/cpufreq/bios_limit");
+    double scalingMaxFreq = getGhzIfNeeded(&ghz, usedArgs, &detectedArgs, 9,  "/sys/devices/system/cpu/cpufreq/policy0/scaling_max_freq", "/sys/devices/system/cpu/cpu0/cpufreq/scaling_max_freq");
+    double infoMaxFreq    = getGhzIfNeeded(&ghz, usedArgs, &detectedArgs, 11, "/sys/devices/system/cpu/cpufreq/policy0/cpuinfo_max_freq", "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq");
+    if(!cpuinfoRead && (ghz == 0 || (usedArgs & FF_FORMAT_ARG_MASK(13))))
+        cpuinfoRead = ffDetectCPUInfo("/proc/cpuinfo", &result);
+    if(!cpuinfoRead)
+        detectedArgs &= ~FF_FORMAT_ARG_MASK(13);
+    double procGhz = result.procGhz;
+    if(ghz == 0)
+        ghz = procGhz;
+    double scalingMinFreq = getGhzIfNeeded(&ghz, usedArgs, &detectedArgs, 10, "/sys/devices/system/cpu/cpufreq/policy0/scaling_min_freq", "/sys/devices/system/cpu/cpu0/cpufreq/scaling_min_freq");
+    double infoMinFreq    = getGhzIfNeeded(&ghz, usedArgs, &detectedArgs, 12, "/sys/devices/system/cpu/cpufreq/policy0/cpuinfo_min_freq", "/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_min_freq");
 
     int numProcsOnline = get_nprocs();
     int numProcsAvailable = get_nprocs_conf();
 
-    int physicalCores = 1;
-    sscanf(physicalCoresString.chars, "%i", &physicalCores);
-    ffStrbufDestroy(&physicalCoresString);
+    int physicalCores = result.physicalCores > 0 ? (int) result.physicalCores : 1;
 
     //The current get_nprocs* returns 1 on failure. It also makes no sense to have a (1) as count
     int numProcs = numProcsOnline;
@@ -104,33 +96,20 @@ void ffPrintCPU(FFinstance* instance)
     if(numProcs <= 1)
         numProcs = physicalCores;
 
-    double ghz = biosLimit;
-    if(ghz == 0)
-        ghz = scalingMaxFreq;
-    if(ghz == 0)
-        ghz = infoMaxFreq;
-    if(ghz == 0)
-        ghz = procGhz;
-    if(ghz == 0)
-        ghz = scalingMinFreq;
-    if(ghz == 0)
-        ghz = infoMinFreq;
-
     if(
-        name.length == 0 &&
-        vendor.length == 0 &&
+        result.name.length == 0 &&
+        result.vendor.length == 0 &&
         numProcs <= 1 &&
         ghz <= 0
     ) {
-        ffStrbufDestroy(&name);
-        ffStrbufDestroy(&vendor);
-        ffPrintError(instance, FF_CPU_MODULE_NAME, 0, &instance->config.cpuKey, &instance->config.cpuFormat, FF_CPU_NUM_FORMAT_ARGS, "No CPU info found in /proc/cpuinfo");
+        ffCPUResultDestroy(&result);
+        ffPrintError(instance, FF_CPU_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CPU].key, instance->state.modules[FF_MODULE_ID_CPU].format, FF_CPU_NUM_FORMAT_ARGS, "No CPU info found");
         return;
     }
 
     FFstrbuf namePretty;
     ffStrbufInitA(&namePretty, 64);
-    ffStrbufAppend(&namePretty, &name);
+    ffStrbufAppend(&namePretty, &result.name);
 
     const char* removeStrings[] = {
         "(R)", "(r)", "(TM)", "(tm)",
@@ -148,26 +127,43 @@ void ffPrintCPU(FFinstance* instance)
 
     if(namePretty.length > 0)
         ffStrbufAppend(&cpu, &namePretty);
-    else if(name.length > 0)
-        ffStrbufAppend(&cpu, &name);
-    else if(vendor.length > 0)
+    else if(result.name.length > 0)
+        ffStrbufAppend(&cpu, &result.name);
+    else if(result.vendor.length > 0)
     {
-        ffStrbufAppend(&cpu, &vendor);
+        ffStrbufAppend(&cpu, &result.vendor);
         ffStrbufAppendS(&cpu, " CPU");
     }
     else
         ffStrbufAppendS(&cpu, "CPU");
 
     if(numProcs > 1)
-        ffStrbufAppendF(&cpu, " (%i)", numProcs);
+    {
+        ffStrbufAppendS(&cpu, " (");
+        ffStrbufAppendInt(&cpu, numProcs);
+        ffStrbufAppendC(&cpu, ')');
+    }
 
     if(ghz > 0)
-        ffStrbufAppendF(&cpu, " @ %.9gGHz", ghz);
+    {
+        ffStrbufAppendS(&cpu, " @ ");
+        ffStrbufAppendDoubleG(&cpu, ghz, 9);
+        ffStrbufAppendS(&cpu, "GHz");
+    }
+
+    FFlist policyGhz;
+    ffListInitA(&policyGhz, sizeof(double), result.policies.length);
+    FF_LIST_FOR_EACH(FFCPUPolicy, policy, &result.policies)
+        *FF_LIST_ADD(double, &policyGhz) = policy->maxFrequency / 1000.0 / 1000.0;
 
-    ffPrintAndSaveToCache(instance, FF_CPU_MODULE_NAME, &instance->config.cpuKey, &cpu, &instance->config.cpuFormat, FF_CPU_NUM_FORMAT_ARGS, (FFformatarg[]){
-        {FF_FORMAT_ARG_TYPE_STRBUF, &name},
+    FFcache cache;
+    ffCacheOpenWrite(instance, FF_CPU_MODULE_NAME, &cache);
+    cache.args = detectedArgs;
+
+    ffPrintAndAppendToCache(instance, FF_CPU_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CPU].key, &cache, &cpu, instance->state.modules[FF_MODULE_ID_CPU].format, FF_CPU_NUM_FORMAT_ARGS, (FFformatarg[]){
+        {FF_FORMAT_ARG_TYPE_STRBUF, &result.name},
         {FF_FORMAT_ARG_TYPE_STRBUF, &namePretty},
-        {FF_FORMAT_ARG_TYPE_STRBUF, &vendor},
+        {FF_FORMAT_ARG_TYPE_STRBUF, &result.vendor},
         {FF_FORMAT_ARG_TYPE_INT, &numProcsOnline},
         {FF_FORMAT_ARG_TYPE_INT, &numProcsAvailable},
         {FF_FORMAT_ARG_TYPE_INT, &physicalCores},
@@ -178,11 +174,24 @@ void ffPrintCPU(FFinstance* instance)
         {FF_FORMAT_ARG_TYPE_DOUBLE, &infoMaxFreq},
         {FF_FORMAT_ARG_TYPE_DOUBLE, &infoMinFreq},
         {FF_FORMAT_ARG_TYPE_DOUBLE, &procGhz},
-        {FF_FORMAT_ARG_TYPE_DOUBLE, &ghz}
+        {FF_FORMAT_ARG_TYPE_DOUBLE, &ghz},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.family},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.model},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.stepping},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.packages},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.clusters},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.cacheL1d},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.cacheL1i},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.cacheL2},
+        {FF_FORMAT_ARG_TYPE_UINT, &result.cacheL3},
+        {FF_FORMAT_ARG_TYPE_DOUBLE_LIST, &policyGhz}
     });
 
+    ffCacheClose(&cache);
+
+    ffListDestroy(&policyGhz);
+
     ffStrbufDestroy(&cpu);
     ffStrbufDestroy(&namePretty);
-    ffStrbufDestroy(&name);
-    ffStrbufDestroy(&vendor);
+    ffCPUResultDestroy(&result);
 }
@@ -1,49 +1,72 @@
 #include "fastfetch.h"
 
-#include <stdio.h>
-#include <unistd.h>
-
 #define FF_CPU_USAGE_MODULE_NAME "CPU Usage"
-#define FF_CPU_USAGE_NUM_FORMAT_ARGS 1
+
+//values are triples of id, work and total jiffies. Returns the usage in percent of the triple at index
+static double getUsage(const FFsample* first, const FFsample* second, uint32_t index)
+{
+    uint64_t id = *FF_LIST_GET(uint64_t, &second->values, index);
+
+    //Cpus can go offline in between, so match them by id instead of by position
+    for(uint32_t i = 0; i + 2 < first->values.length; i += 3)
+    {
+        if(*FF_LIST_GET(uint64_t, &first->values, i) != id)
+            continue;
+
+        double work = ffSamplingGetRate(first, second, i + 1);
+        double total = ffSamplingGetRate(first, second, i + 2);
+        return total > 0 ? work / total * 100 : 0;
+    }
+
+    return 0;
+}
 
 void ffPrintCPUUsage(FFinstance* instance)
 {
-    long user, nice, system, idle, iowait, irq, softirq;
-    FILE* procStat = fopen("/proc/stat", "r");
-    if(procStat == NULL)
+    const FFsample* first;
+    const FFsample* second;
+    if(!ffSamplingMeasure(instance, FF_SAMPLE_TYPE_CPU, &first, &second))
     {
-        ffPrintError(instance, FF_CPU_USAGE_MODULE_NAME, 0, &instance->config.cpuUsageKey, &instance->config.cpuUsageFormat, FF_CPU_USAGE_NUM_FORMAT_ARGS, "fopen(\"/proc/stat\", \"r\") == NULL");
+        ffPrintError(instance, FF_CPU_USAGE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CPU_USAGE].key, instance->state.modules[FF_MODULE_ID_CPU_USAGE].format, FF_CPU_USAGE_NUM_FORMAT_ARGS, "Couldn't sample \"/proc/stat\"");
         return;
     }
-    if (fscanf(procStat, "cpu%ld%ld%ld%ld%ld%ld%ld", &user, &nice, &system, &idle, &iowait, &irq, &softirq) < 0) goto exit;
-    long workJiffies1 = user + nice + system;
-    long totalJiffies1 = workJiffies1 + idle + iowait + irq + softirq;
 
-    sleep(1);
+    double cpuPercent = 0;
+
+    FFlist coreUsages;
+    ffListInitA(&coreUsages, sizeof(double), second->values.length / 3);
 
-    rewind(procStat);
-    if (fscanf(procStat, "cpu%ld%ld%ld%ld%ld%ld%ld", &user, &nice, &system, &idle, &iowait, &irq, &softirq) < 0) goto exit;
-    long workJiffies2 = user + nice + system;
-    long totalJiffies2 = workJiffies2 + idle + iowait + irq + softirq;
+    for(uint32_t i = 0; i + 2 < second->values.length; i += 3)
+    {
+        double usage = getUsage(first, second, i);
+
+        if(*FF_LIST_GET(uint64_t, &second->values, i) == UINT64_MAX)
+        {
+            cpuPercent = usage;
+            continue;
+        }
 
-    // https://stackoverflow.com/questions/3017162/how-to-get-total-cpu-usage-in-linux-using-c#answer-3017438
-    long workOverPeriod = workJiffies2 - workJiffies1;
-    long totalOverPeriod = totalJiffies2 - totalJiffies1;
-    double cpuPercent = (double)workOverPeriod / (double)totalOverPeriod * 100;
+        *FF_LIST_ADD(double, &coreUsages) = usage;
+    }
 
-    if(instance->config.cpuUsageFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_CPU_USAGE].format))
     {
-        ffPrintLogoAndKey(instance, FF_CPU_USAGE_MODULE_NAME, 0, &instance->config.cpuUsageKey);
+        ffPrintLogoAndKey(instance, FF_CPU_USAGE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CPU_USAGE].key);
 
-        printf("%.2lf%%\n", cpuPercent);
+        FFstrbuf usage;
+        ffStrbufInitA(&usage, 16);
+        ffStrbufAppendDoubleF(&usage, cpuPercent, 2);
+        ffStrbufAppendC(&usage, '%');
+        ffOutputPut(instance, &usage);
+        ffStrbufDestroy(&usage);
     }
     else
     {
-        ffPrintFormatString(instance, FF_CPU_USAGE_MODULE_NAME, 0, &instance->config.cpuUsageKey, &instance->config.cpuUsageFormat, NULL, FF_CPU_USAGE_NUM_FORMAT_ARGS, (FFformatarg[]){
-            {FF_FORMAT_ARG_TYPE_DOUBLE, &cpuPercent}
+        ffPrintFormatString(instance, FF_CPU_USAGE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CPU_USAGE].key, instance->state.modules[FF_MODULE_ID_CPU_USAGE].format, NULL, FF_CPU_USAGE_NUM_FORMAT_ARGS, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_DOUBLE, &cpuPercent},
+            {FF_FORMAT_ARG_TYPE_DOUBLE_LIST, &coreUsages}
         });
     }
 
-exit:
-    fclose(procStat);
+    ffListDestroy(&coreUsages);
 }
@@ -1,7 +1,6 @@
 #include "fastfetch.h"
 
 #define FF_CURSOR_MODULE_NAME "Cursor"
-#define FF_CURSOR_NUM_FORMAT_ARGS 2
 
 static void printCursor(FFinstance* instance, FFstrbuf* cursorTheme, const FFstrbuf* cursorSize)
 {
@@ -12,23 +11,23 @@ static void printCursor(FFinstance* instance, FFstrbuf* cursorTheme, const FFstr
     if(cursorTheme->length == 0)
         ffStrbufAppendS(cursorTheme, "default");
 
-    if(instance->config.cursorFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_CURSOR].format))
     {
-        ffPrintLogoAndKey(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey);
-        ffStrbufWriteTo(cursorTheme, stdout);
+        ffPrintLogoAndKey(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key);
+        ffOutputWrite(instance, cursorTheme);
 
         if(cursorSize != NULL && cursorSize->length > 0)
         {
-            fputs(" (", stdout);
-            ffStrbufWriteTo(cursorSize, stdout);
-            fputs("px)", stdout);
+            ffOutputWriteS(instance, " (");
+            ffOutputWrite(instance, cursorSize);
+            ffOutputWriteS(instance, "px)");
         }
 
-        putchar('\n');
+        ffOutputWriteC(instance, '\n');
     }
     else
     {
-        ffPrintFormatString(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey, &instance->config.cursorFormat, NULL, FF_CURSOR_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key, instance->state.modules[FF_MODULE_ID_CURSOR].format, NULL, FF_CURSOR_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, cursorTheme},
             {FF_FORMAT_ARG_TYPE_STRBUF, cursorSize}
         });
@@ -47,7 +46,7 @@ static void printCursorGTK(FFinstance* instance)
 
     if(gtk->cursor.length == 0)
     {
-        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey, &instance->config.cursorFormat, FF_CURSOR_NUM_FORMAT_ARGS, "Couldn't detect GTK Cursor");
+        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key, instance->state.modules[FF_MODULE_ID_CURSOR].format, FF_CURSOR_NUM_FORMAT_ARGS, "Couldn't detect GTK Cursor");
         return;
     }
 
@@ -69,7 +68,7 @@ static void printCursorXFCE(FFinstance* instance)
 
     if(cursorTheme.length == 0)
     {
-        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey, &instance->config.cursorFormat, FF_CURSOR_NUM_FORMAT_ARGS, "Couldn't find xfce cursor in xfconf (xsettings::/Gtk/CursorThemeName)");
+        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key, instance->state.modules[FF_MODULE_ID_CURSOR].format, FF_CURSOR_NUM_FORMAT_ARGS, "Couldn't find xfce cursor in xfconf (xsettings::/Gtk/CursorThemeName)");
         return;
     }
 
@@ -105,7 +104,7 @@ static void printCursorFromConfigFile(FFinstance* instance, const char* relative
     }
 
     if(cursorTheme.length == 0)
-        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey, &instance->config.cursorFormat, FF_CURSOR_NUM_FORMAT_ARGS, "Couldn't find cursor in %s", relativeFilePath);
+        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key, instance->state.modules[FF_MODULE_ID_CURSOR].format, FF_CURSOR_NUM_FORMAT_ARGS, "Couldn't find cursor in %s", relativeFilePath);
     else
         printCursor(instance, &cursorTheme, &cursorSize);
 
@@ -185,7 +184,7 @@ static bool printCursorFromEnv(FFinstance* instance)
 void ffPrintCursor(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey, &instance->config.cursorFormat, FF_CURSOR_NUM_FORMAT_ARGS, "Cursor detection is not supported on Android");
+        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key, instance->state.modules[FF_MODULE_ID_CURSOR].format, FF_CURSOR_NUM_FORMAT_ARGS, "Cursor detection is not supported on Android");
         return;
     #endif
 
@@ -193,7 +192,7 @@ void ffPrintCursor(FFinstance* instance)
 
     if(ffStrbufIgnCaseCompS(&wmde->wmProtocolName, "TTY") == 0)
     {
-        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, &instance->config.cursorKey, &instance->config.cursorFormat, FF_CURSOR_NUM_FORMAT_ARGS, "Cursor isn't supported in TTY");
+        ffPrintError(instance, FF_CURSOR_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_CURSOR].key, instance->state.modules[FF_MODULE_ID_CURSOR].format, FF_CURSOR_NUM_FORMAT_ARGS, "Cursor isn't supported in TTY");
         return;
     }
 
@@ -2,6 +2,14 @@
 
 void ffPrintCustom(FFinstance* instance, const char* key, const char* value)
 {
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+    {
+        ffPrintJsonResult(instance, key, 0, 1, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_STRING, value}
+        });
+        return;
+    }
+
     ffPrintLogoAndKey(instance, key, 0, NULL);
-    puts(value);
+    ffOutputPutS(instance, value);
 }
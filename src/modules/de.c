@@ -3,12 +3,11 @@
 #include <string.h>
 
 #define FF_DE_MODULE_NAME "DE"
-#define FF_DE_NUM_FORMAT_ARGS 3
 
 void ffPrintDesktopEnvironment(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_DE_MODULE_NAME, 0, &instance->config.deKey, &instance->config.deFormat, FF_DE_NUM_FORMAT_ARGS, "DE detection is not supported on Android");
+        ffPrintError(instance, FF_DE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DE].key, instance->state.modules[FF_MODULE_ID_DE].format, FF_DE_NUM_FORMAT_ARGS, "DE detection is not supported on Android");
         return;
     #endif
 
@@ -16,27 +15,27 @@ void ffPrintDesktopEnvironment(FFinstance* instance)
 
     if(result->dePrettyName.length == 0)
     {
-        ffPrintError(instance, FF_DE_MODULE_NAME, 0, &instance->config.deKey, &instance->config.deFormat, FF_DE_NUM_FORMAT_ARGS, "No DE found");
+        ffPrintError(instance, FF_DE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DE].key, instance->state.modules[FF_MODULE_ID_DE].format, FF_DE_NUM_FORMAT_ARGS, "No DE found");
         return;
     }
 
-    if(instance->config.deFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_DE].format))
     {
-        ffPrintLogoAndKey(instance, FF_DE_MODULE_NAME, 0, &instance->config.deKey);
+        ffPrintLogoAndKey(instance, FF_DE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DE].key);
 
-        ffStrbufWriteTo(&result->dePrettyName, stdout);
+        ffOutputWrite(instance, &result->dePrettyName);
 
         if(result->deVersion.length > 0)
         {
-            putchar(' ');
-            ffStrbufWriteTo(&result->deVersion, stdout);
+            ffOutputWriteC(instance, ' ');
+            ffOutputWrite(instance, &result->deVersion);
         }
 
-        putchar('\n');
+        ffOutputWriteC(instance, '\n');
     }
     else
     {
-        ffPrintFormatString(instance, FF_DE_MODULE_NAME, 0, &instance->config.deKey, &instance->config.deFormat, NULL, FF_DE_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_DE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DE].key, instance->state.modules[FF_MODULE_ID_DE].format, NULL, FF_DE_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->deProcessName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->dePrettyName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->deVersion}
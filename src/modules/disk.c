@@ -1,13 +1,71 @@
 #include "fastfetch.h"
 
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <limits.h>
 #include <sys/statvfs.h>
 
 #define FF_DISK_MODULE_NAME "Disk"
-#define FF_DISK_NUM_FORMAT_ARGS 4
+
+//Used if --disk-timeout isn't set. A local disk answers instantly, a stale network mount never
+#define FF_DISK_DEFAULT_TIMEOUT 1000
+
+typedef struct FFdiskStat
+{
+    bool answered; //false if statvfs didn't return before the deadline
+    int error; //errno of statvfs, 0 on success
+    struct statvfs fs;
+    char realPath[PATH_MAX]; //Resolved by realpath to look up the mount, empty if it failed
+} FFdiskStat;
+
+static void statPath(void* data, uint32_t index, void* result)
+{
+    const char* path = ((char**) data)[index];
+    FFdiskStat* stat = result;
+
+    stat->answered = true;
+    stat->error = statvfs(path, &stat->fs) == 0 ? 0 : errno;
+
+    //Resolving may hang on a stale mount too, so it is done here as well
+    if(stat->error == 0 && realpath(path, stat->realPath) == NULL)
+        stat->realPath[0] = '\0';
+}
+
+//Calls statvfs on every path at once, so one hanging mount doesn't delay the others or fastfetch
+static void statPaths(FFinstance* instance, uint32_t numPaths, const char* const* paths, FFdiskStat* stats)
+{
+    //Copies in one block, the threads may outlive the strings of the caller
+    size_t size = sizeof(char*) * numPaths;
+    for(uint32_t i = 0; i < numPaths; i++)
+        size += strlen(paths[i]) + 1;
+
+    char** copies = malloc(size);
+    char* chars = (char*) (copies + numPaths);
+    for(uint32_t i = 0; i < numPaths; i++)
+    {
+        copies[i] = chars;
+        chars = stpcpy(chars, paths[i]) + 1;
+    }
+
+    uint32_t timeout = instance->config.modules[FF_MODULE_ID_DISK].timeout;
+    uint32_t* timeouts = malloc(sizeof(uint32_t) * numPaths);
+    for(uint32_t i = 0; i < numPaths; i++)
+        timeouts[i] = timeout > 0 ? timeout : FF_DISK_DEFAULT_TIMEOUT;
+
+    //Paths which didn't answer in time keep answered false
+    memset(stats, 0, sizeof(FFdiskStat) * numPaths);
+    ffRunDeadlineTasks(numPaths, timeouts, statPath, copies, free, sizeof(FFdiskStat), stats, NULL);
+
+    free(timeouts);
+}
 
 static void getKey(FFinstance* instance, FFstrbuf* key, const char* folderPath, bool showFolderPath)
 {
-    if(instance->config.diskKey.length == 0)
+    //JSON output has no keys, the key is its type there. The folder path is a result instead
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        ffStrbufSetS(key, FF_DISK_MODULE_NAME);
+    else if(instance->state.modules[FF_MODULE_ID_DISK].key == NULL)
     {
         if(showFolderPath)
             ffStrbufAppendF(key, FF_DISK_MODULE_NAME" (%s)", folderPath);
@@ -16,113 +74,225 @@ static void getKey(FFinstance* instance, FFstrbuf* key, const char* folderPath,
     }
     else
     {
-        ffParseFormatString(key, &instance->config.diskKey, NULL, 1, (FFformatarg[]){
+        ffFormatRender(key, instance->state.modules[FF_MODULE_ID_DISK].key, NULL, 1, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRING, folderPath}
         });
     }
 }
 
-static void printStatvfs(FFinstance* instance, FFstrbuf* key, struct statvfs* fs)
+//Bytes with two decimals in the largest binary unit it reaches, e.g. "1.82 TiB"
+static void appendSize(FFstrbuf* buffer, uint64_t bytes)
+{
+    static const char* units[] = {"B", "KiB", "MiB", "GiB", "TiB", "PiB", "EiB"};
+
+    double value = (double) bytes;
+    uint32_t unit = 0;
+    while(value >= 1024 && unit < sizeof(units) / sizeof(units[0]) - 1)
+    {
+        value /= 1024;
+        ++unit;
+    }
+
+    ffStrbufAppendDoubleF(buffer, value, 2);
+    ffStrbufAppendC(buffer, ' ');
+    ffStrbufAppendS(buffer, units[unit]);
+}
+
+static void printStatvfs(FFinstance* instance, FFstrbuf* key, const char* folderPath, struct statvfs* fs, const FFstrbuf* fsType)
 {
-    const uint32_t GB = 1024 * 1024 * 1024;
+    const uint64_t GB = 1024 * 1024 * 1024;
 
-    uint32_t total     = (uint32_t) ((fs->f_blocks * fs->f_frsize) / GB);
-    uint32_t available = (uint32_t) ((fs->f_bfree  * fs->f_frsize) / GB);
-    uint32_t used      = total - available;
-    uint8_t percentage = (uint8_t) ((used / (double) total) * 100.0);
+    uint64_t totalBytes = (uint64_t) fs->f_blocks * fs->f_frsize;
+    uint64_t usedBytes  = totalBytes - (uint64_t) fs->f_bfree * fs->f_frsize;
+    uint64_t total      = totalBytes / GB;
+    uint64_t used       = usedBytes / GB;
+    uint8_t percentage  = totalBytes == 0 ? 0 : (uint8_t) (((double) usedBytes / (double) totalBytes) * 100.0);
 
-    uint32_t files = (uint32_t) (fs->f_files - fs->f_ffree);
+    uint64_t files = (uint64_t) (fs->f_files - fs->f_ffree);
 
-    if(instance->config.diskFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_DISK].format))
     {
         ffPrintLogoAndKey(instance, key->chars, 0, NULL);
-        printf("%uGB / %uGB (%u%%)\n", used, total, percentage);
+
+        FFstrbuf disk;
+        ffStrbufInitA(&disk, 32);
+        appendSize(&disk, usedBytes);
+        ffStrbufAppendS(&disk, " / ");
+        appendSize(&disk, totalBytes);
+        ffStrbufAppendS(&disk, " (");
+        ffStrbufAppendUInt(&disk, percentage);
+        ffStrbufAppendS(&disk, "%)");
+        ffOutputPut(instance, &disk);
+        ffStrbufDestroy(&disk);
     }
     else
     {
-        ffPrintFormatString(instance, key->chars, 0, NULL, &instance->config.diskFormat, NULL, FF_DISK_NUM_FORMAT_ARGS, (FFformatarg[]){
-            {FF_FORMAT_ARG_TYPE_UINT, &used},
-            {FF_FORMAT_ARG_TYPE_UINT, &total},
-            {FF_FORMAT_ARG_TYPE_UINT, &files},
-            {FF_FORMAT_ARG_TYPE_UINT8, &percentage}
+        ffPrintFormatString(instance, key->chars, 0, NULL, instance->state.modules[FF_MODULE_ID_DISK].format, NULL, FF_DISK_NUM_FORMAT_ARGS, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_UINT64, &used},
+            {FF_FORMAT_ARG_TYPE_UINT64, &total},
+            {FF_FORMAT_ARG_TYPE_UINT64, &files},
+            {FF_FORMAT_ARG_TYPE_UINT8, &percentage},
+            {FF_FORMAT_ARG_TYPE_UINT64, &usedBytes},
+            {FF_FORMAT_ARG_TYPE_UINT64, &totalBytes},
+            {FF_FORMAT_ARG_TYPE_STRBUF, fsType},
+            {FF_FORMAT_ARG_TYPE_STRING, folderPath}
         });
     }
 }
 
-static void printStatvfsCreateKey(FFinstance* instance, const char* folderPath, struct statvfs* fs)
+//fsType may be NULL if it isn't known
+static void printStat(FFinstance* instance, const char* folderPath, FFdiskStat* stat, const FFstrbuf* fsType)
 {
     FF_STRBUF_CREATE(key);
     getKey(instance, &key, folderPath, true);
-    printStatvfs(instance, &key, fs);
+
+    if(!stat->answered)
+    {
+        uint32_t timeout = instance->config.modules[FF_MODULE_ID_DISK].timeout;
+        timeout = timeout > 0 ? timeout : FF_DISK_DEFAULT_TIMEOUT;
+
+        //A hanging mount is a result, not an error. Only custom formats have no place for it
+        if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_DISK].format))
+        {
+            ffPrintLogoAndKey(instance, key.chars, 0, NULL);
+            ffOutputWriteS(instance, "unresponsive\n");
+        }
+        else
+            ffPrintError(instance, key.chars, 0, NULL, instance->state.modules[FF_MODULE_ID_DISK].format, FF_DISK_NUM_FORMAT_ARGS, "unresponsive, statvfs(\"%s\") didn't return within %ums", folderPath, timeout);
+    }
+    else if(stat->error != 0)
+        ffPrintError(instance, key.chars, 0, NULL, instance->state.modules[FF_MODULE_ID_DISK].format, FF_DISK_NUM_FORMAT_ARGS, "statvfs(\"%s\", &fs) failed: %s", folderPath, strerror(stat->error));
+    else
+    {
+        FF_STRBUF_CREATE(emptyType);
+        printStatvfs(instance, &key, folderPath, &stat->fs, fsType == NULL ? &emptyType : fsType);
+        ffStrbufDestroy(&emptyType);
+    }
+
     ffStrbufDestroy(&key);
 }
 
-static void printFolder(FFinstance* instance, const char* folderPath)
+static void printError(FFinstance* instance, const char* message)
 {
     FF_STRBUF_CREATE(key);
-    getKey(instance, &key, folderPath, true);
+    getKey(instance, &key, "", false);
+    ffPrintError(instance, key.chars, 0, NULL, instance->state.modules[FF_MODULE_ID_DISK].format, FF_DISK_NUM_FORMAT_ARGS, "%s", message);
+    ffStrbufDestroy(&key);
+}
 
-    struct statvfs fs;
-    int ret = statvfs(folderPath, &fs);
-    if(ret != 0 && instance->config.diskFormat.length == 0)
+//NULL if the path couldn't be resolved or isn't on any mount
+static const FFstrbuf* getFsType(const FFlist* mounts, const FFdiskStat* stat)
+{
+    if(!stat->answered || stat->realPath[0] == '\0')
+        return NULL;
+
+    const FFDiskMount* mount = ffDiskMountsFind(mounts, stat->realPath);
+    return mount == NULL ? NULL : &mount->fsType;
+}
+
+static void printDefaultFolders(FFinstance* instance)
+{
+    const char* paths[] = {"/", "/home"};
+    FFdiskStat stats[2];
+    statPaths(instance, 2, paths, stats);
+
+    //Unresponsive ones are still printed, as such
+    bool rootFailed = stats[0].answered && stats[0].error != 0;
+    bool homeFailed = stats[1].answered && stats[1].error != 0;
+
+    if(rootFailed && homeFailed)
     {
-        ffPrintError(instance, key.chars, 0, NULL, &instance->config.diskFormat, FF_DISK_NUM_FORMAT_ARGS, "statvfs(\"%s\", &fs) != 0 (%i)", folderPath, ret);
-        ffStrbufDestroy(&key);
+        printError(instance, "statvfs failed for both / and /home");
         return;
     }
 
-    printStatvfs(instance, &key, &fs);
-    ffStrbufDestroy(&key);
+    //Every mount, the folders may be on pseudo filesystems or bind mounts too
+    FFlist mounts;
+    ffDetectDiskMounts("/proc/self/mountinfo", true, &mounts);
+
+    if(!rootFailed)
+        printStat(instance, paths[0], &stats[0], getFsType(&mounts, &stats[0]));
+
+    //Don't print /home again if it isn't a filesystem on its own
+    bool sameFilesystem = stats[0].answered && stats[1].answered && !rootFailed && stats[0].fs.f_fsid == stats[1].fs.f_fsid;
+    if(!homeFailed && !sameFilesystem)
+        printStat(instance, paths[1], &stats[1], getFsType(&mounts, &stats[1]));
+
+    ffDiskMountsDestroy(&mounts);
 }
 
-void ffPrintDisk(FFinstance* instance)
+static void printCustomFolders(FFinstance* instance)
 {
+    ffStrbufTrim(&instance->config.diskFolders, ':');
+
     if(instance->config.diskFolders.length == 0)
     {
+        printError(instance, "Custom disk folders string doesn't contain any folders");
+        return;
+    }
 
-        struct statvfs fsRoot;
-        int rootRet = statvfs("/", &fsRoot);
-
-        struct statvfs fsHome;
-        int homeRet = statvfs("/home", &fsHome);
+    FFlist paths;
+    ffListInit(&paths, sizeof(const char*));
 
-        if(rootRet != 0 && homeRet != 0)
-        {
-            FF_STRBUF_CREATE(key);
-            getKey(instance, &key, "", false);
-            ffPrintError(instance, key.chars, 0, NULL, &instance->config.diskFormat, FF_DISK_NUM_FORMAT_ARGS, "statvfs failed for both / and /home");
-            ffStrbufDestroy(&key);
-            return;
-        }
+    uint32_t startIndex = 0;
+    while (startIndex < instance->config.diskFolders.length)
+    {
+        uint32_t colonIndex = ffStrbufNextIndexC(&instance->config.diskFolders, startIndex, ':');
+        instance->config.diskFolders.chars[colonIndex] = '\0';
 
-        if(rootRet == 0)
-            printStatvfsCreateKey(instance, "/", &fsRoot);
+        *FF_LIST_ADD(const char*, &paths) = instance->config.diskFolders.chars + startIndex;
 
-        if(homeRet == 0 && (rootRet != 0 || fsRoot.f_fsid != fsHome.f_fsid))
-            printStatvfsCreateKey(instance, "/home", &fsHome);
+        startIndex = colonIndex + 1;
     }
-    else
-    {
-        ffStrbufTrim(&instance->config.diskFolders, ':');
 
-        if(instance->config.diskFolders.length == 0)
-        {
-            FF_STRBUF_CREATE(key);
-            getKey(instance, &key, "", false);
-            ffPrintError(instance, key.chars, 0, NULL, &instance->config.diskFormat, FF_DISK_NUM_FORMAT_ARGS, "Custom disk folders string doesn't contain any folders");
-            ffStrbufDestroy(&key);
-            return;
-        }
+    FFdiskStat* stats = malloc(sizeof(FFdiskStat) * paths.length);
+    statPaths(instance, paths.length, ffListData(&paths), stats);
 
-        uint32_t startIndex = 0;
-        while (startIndex < instance->config.diskFolders.length)
-        {
-            uint32_t colonIndex = ffStrbufNextIndexC(&instance->config.diskFolders, startIndex, ':');
-            instance->config.diskFolders.chars[colonIndex] = '\0';
+    FFlist mounts;
+    ffDetectDiskMounts("/proc/self/mountinfo", true, &mounts);
 
-            printFolder(instance, instance->config.diskFolders.chars + startIndex);
+    for(uint32_t i = 0; i < paths.length; i++)
+        printStat(instance, *FF_LIST_GET(const char*, &paths, i), &stats[i], getFsType(&mounts, &stats[i]));
 
-            startIndex = colonIndex + 1;
-        }
+    ffDiskMountsDestroy(&mounts);
+    free(stats);
+    ffListDestroy(&paths);
+}
+
+static void printAllMounts(FFinstance* instance)
+{
+    FFlist mounts;
+    if(!ffDetectDiskMounts("/proc/self/mountinfo", false, &mounts) || mounts.length == 0)
+    {
+        printError(instance, "No filesystems found in /proc/self/mountinfo");
+        ffDiskMountsDestroy(&mounts);
+        return;
+    }
+
+    const char** paths = malloc(sizeof(const char*) * mounts.length);
+    for(uint32_t i = 0; i < mounts.length; i++)
+        paths[i] = FF_LIST_GET(FFDiskMount, &mounts, i)->mountPoint.chars;
+
+    FFdiskStat* stats = malloc(sizeof(FFdiskStat) * mounts.length);
+    statPaths(instance, mounts.length, paths, stats);
+
+    for(uint32_t i = 0; i < mounts.length; i++)
+    {
+        const FFDiskMount* mount = FF_LIST_GET(FFDiskMount, &mounts, i);
+        printStat(instance, paths[i], &stats[i], &mount->fsType);
     }
+
+    free(stats);
+    free(paths);
+    ffDiskMountsDestroy(&mounts);
+}
+
+void ffPrintDisk(FFinstance* instance)
+{
+    if(instance->config.diskShowAll)
+        printAllMounts(instance);
+    else if(instance->config.diskFolders.length == 0)
+        printDefaultFolders(instance);
+    else
+        printCustomFolders(instance);
 }
@@ -0,0 +1,44 @@
+#include "fastfetch.h"
+
+#define FF_DISK_IO_MODULE_NAME "Disk IO"
+
+static void appendMiBs(FFstrbuf* buffer, double value)
+{
+    ffStrbufAppendDoubleF(buffer, value, 2);
+    ffStrbufAppendS(buffer, " MiB/s");
+}
+
+void ffPrintDiskIO(FFinstance* instance)
+{
+    const FFsample* first;
+    const FFsample* second;
+    if(!ffSamplingMeasure(instance, FF_SAMPLE_TYPE_DISK, &first, &second))
+    {
+        ffPrintError(instance, FF_DISK_IO_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DISK_IO].key, instance->state.modules[FF_MODULE_ID_DISK_IO].format, FF_DISK_IO_NUM_FORMAT_ARGS, "Couldn't sample \"/proc/diskstats\"");
+        return;
+    }
+
+    double read = ffSamplingGetRate(first, second, 0) / 1024.0 / 1024.0;
+    double written = ffSamplingGetRate(first, second, 1) / 1024.0 / 1024.0;
+
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_DISK_IO].format))
+    {
+        ffPrintLogoAndKey(instance, FF_DISK_IO_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DISK_IO].key);
+
+        FFstrbuf io;
+        ffStrbufInitA(&io, 48);
+        appendMiBs(&io, read);
+        ffStrbufAppendS(&io, " (read), ");
+        appendMiBs(&io, written);
+        ffStrbufAppendS(&io, " (write)");
+        ffOutputPut(instance, &io);
+        ffStrbufDestroy(&io);
+    }
+    else
+    {
+        ffPrintFormatString(instance, FF_DISK_IO_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_DISK_IO].key, instance->state.modules[FF_MODULE_ID_DISK_IO].format, NULL, FF_DISK_IO_NUM_FORMAT_ARGS, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_DOUBLE, &read},
+            {FF_FORMAT_ARG_TYPE_DOUBLE, &written}
+        });
+    }
+}
@@ -1,12 +1,11 @@
 #include "fastfetch.h"
 
 #define FF_FONT_MODULE_NAME "Font"
-#define FF_FONT_NUM_FORMAT_ARGS 21
 
 void ffPrintFont(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_FONT_MODULE_NAME, 0, &instance->config.fontKey, &instance->config.fontFormat, FF_FONT_NUM_FORMAT_ARGS, "Font detection is not supported on Android");
+        ffPrintError(instance, FF_FONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key, instance->state.modules[FF_MODULE_ID_FONT].format, FF_FONT_NUM_FORMAT_ARGS, "Font detection is not supported on Android");
         return;
     #endif
 
@@ -14,19 +13,35 @@ void ffPrintFont(FFinstance* instance)
 
     if(ffStrbufIgnCaseCompS(&wmde->wmProtocolName, "TTY") == 0)
     {
-        ffPrintError(instance, FF_FONT_MODULE_NAME, 0, &instance->config.fontKey, &instance->config.fontFormat, FF_FONT_NUM_FORMAT_ARGS, "Font isn't supported in TTY");
+        ffPrintError(instance, FF_FONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key, instance->state.modules[FF_MODULE_ID_FONT].format, FF_FONT_NUM_FORMAT_ARGS, "Font isn't supported in TTY");
         return;
     }
 
-    const FFstrbuf* plasmaRaw = &ffDetectPlasma(instance)->font;
-    const FFstrbuf* gtk2Raw = &ffDetectGTK2(instance)->font;
-    const FFstrbuf* gtk3Raw = &ffDetectGTK3(instance)->font;
-    const FFstrbuf* gtk4Raw = &ffDetectGTK4(instance)->font;
+    //Only detect the fonts the format string uses. The default output uses all of them
+    uint64_t usedArgs = instance->state.modules[FF_MODULE_ID_FONT].format == NULL ? UINT64_MAX : ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_FONT].format);
+    uint64_t gtkPrettyArg = FF_FORMAT_ARG_MASK(21);
 
-    if(plasmaRaw->length == 0 && gtk2Raw->length == 0 && gtk3Raw->length == 0 && gtk4Raw->length == 0)
+    FFstrbuf empty;
+    ffStrbufInitA(&empty, 0); //Doesn't allocate, so it doesn't need to be destroyed
+    const FFstrbuf* plasmaRaw = (usedArgs & 0x1FULL) ? &ffDetectPlasma(instance)->font : &empty;
+    const FFstrbuf* gtk2Raw = (usedArgs & ((0x1FULL << 5) | gtkPrettyArg)) ? &ffDetectGTK2(instance)->font : &empty;
+    const FFstrbuf* gtk3Raw = (usedArgs & ((0x1FULL << 10) | gtkPrettyArg)) ? &ffDetectGTK3(instance)->font : &empty;
+    const FFstrbuf* gtk4Raw = (usedArgs & ((0x1FULL << 15) | gtkPrettyArg)) ? &ffDetectGTK4(instance)->font : &empty;
+
+    //Whether there are no fonts at all depends on the skipped ones too, so detect them before printing the error.
+    //A format without any argument doesn't care, it is printed as it is
+    if(usedArgs != 0 && plasmaRaw->length == 0 && gtk2Raw->length == 0 && gtk3Raw->length == 0 && gtk4Raw->length == 0)
     {
-        ffPrintError(instance, FF_FONT_MODULE_NAME, 0, &instance->config.fontKey, &instance->config.fontFormat, FF_FONT_NUM_FORMAT_ARGS, "No fonts found");
-        return;
+        plasmaRaw = &ffDetectPlasma(instance)->font;
+        gtk2Raw = &ffDetectGTK2(instance)->font;
+        gtk3Raw = &ffDetectGTK3(instance)->font;
+        gtk4Raw = &ffDetectGTK4(instance)->font;
+
+        if(plasmaRaw->length == 0 && gtk2Raw->length == 0 && gtk3Raw->length == 0 && gtk4Raw->length == 0)
+        {
+            ffPrintError(instance, FF_FONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key, instance->state.modules[FF_MODULE_ID_FONT].format, FF_FONT_NUM_FORMAT_ARGS, "No fonts found");
+            return;
+        }
     }
 
     FFfont plasma;
@@ -45,22 +60,22 @@ void ffPrintFont(FFinstance* instance)
     ffStrbufInitA(&gtk, 64);
     ffGetGtkPretty(&gtk, &gtk2.pretty, &gtk3.pretty, &gtk4.pretty);
 
-    if(instance->config.fontFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_FONT].format))
     {
-        ffPrintLogoAndKey(instance, FF_FONT_MODULE_NAME, 0, &instance->config.fontKey);
+        ffPrintLogoAndKey(instance, FF_FONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key);
         if(plasma.pretty.length > 0)
         {
-            ffStrbufWriteTo(&plasma.pretty, stdout);
-            fputs(" [Plasma]", stdout);
+            ffOutputWrite(instance, &plasma.pretty);
+            ffOutputWriteS(instance, " [Plasma]");
 
             if(gtk.length > 0)
-                fputs(", ", stdout);
+                ffOutputWriteS(instance, ", ");
         }
-        ffStrbufPutTo(&gtk, stdout);
+        ffOutputPut(instance, &gtk);
     }
     else
     {
-        ffPrintFormatString(instance, FF_FONT_MODULE_NAME, 0, &instance->config.fontKey, &instance->config.fontFormat, NULL, FF_FONT_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_FONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key, instance->state.modules[FF_MODULE_ID_FONT].format, NULL, FF_FONT_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, plasmaRaw},
             {FF_FORMAT_ARG_TYPE_STRBUF, &plasma.name},
             {FF_FORMAT_ARG_TYPE_STRBUF, &plasma.size},
@@ -0,0 +1,77 @@
+#include "modules/list.h"
+#include "util/FFperfecthash.h"
+
+#include <stdlib.h>
+#include <strings.h>
+
+//Builds the perfect hash table of the module names and aliases in modules/list.h.
+//Runs at build time, the output is included by common/modules.c
+
+#define FF_MODULE(id, name, alias, option, print, detectors, cache, numFormatArgs) { name, alias },
+static const struct { const char* name; const char* alias; } modules[] = { FF_MODULE_LIST };
+#undef FF_MODULE
+
+#define FF_MODULES_LENGTH ((uint32_t) (sizeof(modules) / sizeof(modules[0])))
+
+int main(int argc, char** argv)
+{
+    if(argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+        return 1;
+    }
+
+    //Every module has its name and at most one alias
+    const char* names[FF_MODULES_LENGTH * 2];
+    uint32_t indices[FF_MODULES_LENGTH * 2];
+    uint32_t numNames = 0;
+
+    for(uint32_t i = 0; i < FF_MODULES_LENGTH; ++i)
+    {
+        names[numNames] = modules[i].name;
+        indices[numNames++] = i;
+
+        if(modules[i].alias != NULL)
+        {
+            names[numNames] = modules[i].alias;
+            indices[numNames++] = i;
+        }
+    }
+
+    for(uint32_t i = 0; i < numNames; ++i)
+    {
+        for(uint32_t k = 0; k < i; ++k)
+        {
+            if(strcasecmp(names[i], names[k]) == 0)
+            {
+                fprintf(stderr, "Error: module name \"%s\" is used more than once\n", names[i]);
+                return 1;
+            }
+        }
+    }
+
+    FILE* file = fopen(argv[1], "w");
+    if(file == NULL)
+    {
+        fprintf(stderr, "Error: failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    fputs("//Generated by fastfetch-modulegen from src/modules/list.h, do not edit\n\n", file);
+
+    if(!ffPerfectHashWrite(file, "FF_MODULE", "module", names, indices, numNames))
+    {
+        fputs("Error: failed to build the module name table\n", stderr);
+        fclose(file);
+        remove(argv[1]);
+        return 1;
+    }
+
+    if(fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    return 0;
+}
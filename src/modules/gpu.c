@@ -3,7 +3,6 @@
 #include <string.h>
 
 #define FF_GPU_MODULE_NAME "GPU"
-#define FF_GPU_NUM_FORMAT_ARGS 5
 
 typedef struct GPUResult
 {
@@ -12,6 +11,38 @@ typedef struct GPUResult
     FFstrbuf driver;
 } GPUResult;
 
+//Reads the display controllers from sysfs and names them with the cached pci.ids index. Needs neither libpci nor a bus scan
+static bool sysfsFillGPUs(FFinstance* instance, FFlist* results)
+{
+    FFlist devices;
+    if(!ffDetectPCIDisplayDevices("/sys/bus/pci/devices", &devices) || devices.length == 0)
+    {
+        ffPCIDevicesDestroy(&devices);
+        return false;
+    }
+
+    FFPCIIds ids;
+    ffPCIIdsOpenCached(instance, &ids);
+
+    FF_LIST_FOR_EACH(FFPCIDevice, device, &devices)
+    {
+        GPUResult* result = ffListAdd(results);
+        ffStrbufInit(&result->vendor);
+        ffStrbufInit(&result->name);
+        ffStrbufInitCopy(&result->driver, &device->driver);
+
+        //Without pci.ids, print the ids like lspci does
+        if(!ffPCIIdsLookup(&ids, device->vendorId, device->deviceId, &result->vendor, &result->name))
+            ffStrbufAppendF(&result->vendor, "Vendor %04x", device->vendorId);
+        if(result->name.length == 0)
+            ffStrbufAppendF(&result->name, "Device %04x", device->deviceId);
+    }
+
+    ffPCIIdsClose(&ids);
+    ffPCIDevicesDestroy(&devices);
+    return true;
+}
+
 #ifdef FF_HAVE_VULKAN
 #include <vulkan/vulkan.h>
 
@@ -168,7 +199,7 @@ static void pciFillGPUs(FFinstance* instance, FFlist* results)
             ffStrbufRecalculateLength(&result->name);
 
             ffStrbufInit(&result->driver);
-            if(instance->config.gpuFormat.length > 0) //We only need it for the format string, so don't detect it if it isn't needed
+            if(ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_GPU].format) & FF_FORMAT_ARG_MASK(5)) //We only need it for the format string, so don't detect it if it isn't needed
                 pciGetDriver(dev, &result->driver, ffpci_get_param);
         };
     }
@@ -207,7 +238,7 @@ static void printGPUResult(FFinstance* instance, uint8_t index, FFcache* cache,
 
     ffStrbufAppend(&gpu, &namePretty);
 
-    ffPrintAndAppendToCache(instance, FF_GPU_MODULE_NAME, index, &instance->config.gpuKey, cache, &gpu, &instance->config.gpuFormat, FF_GPU_NUM_FORMAT_ARGS, (FFformatarg[]){
+    ffPrintAndAppendToCache(instance, FF_GPU_MODULE_NAME, index, instance->state.modules[FF_MODULE_ID_GPU].key, cache, &gpu, instance->state.modules[FF_MODULE_ID_GPU].format, FF_GPU_NUM_FORMAT_ARGS, (FFformatarg[]){
         {FF_FORMAT_ARG_TYPE_STRBUF, &result->vendor},
         {FF_FORMAT_ARG_TYPE_STRING, vendorPretty},
         {FF_FORMAT_ARG_TYPE_STRBUF, &result->name},
@@ -224,18 +255,26 @@ static void printGPUResult(FFinstance* instance, uint8_t index, FFcache* cache,
 
 void ffPrintGPU(FFinstance* instance)
 {
-    if(ffPrintFromCache(instance, FF_GPU_MODULE_NAME, &instance->config.gpuKey, &instance->config.gpuFormat, FF_GPU_NUM_FORMAT_ARGS))
+    if(ffPrintFromCache(instance, FF_GPU_MODULE_NAME, instance->state.modules[FF_MODULE_ID_GPU].key, instance->state.modules[FF_MODULE_ID_GPU].format, FF_GPU_NUM_FORMAT_ARGS))
         return;
 
     FFlist gpus;
-    ffListInitA(&gpus, sizeof(GPUResult), 4);
+    ffListInit(&gpus, sizeof(GPUResult));
 
     FFcache cache;
     ffCacheOpenWrite(instance, FF_GPU_MODULE_NAME, &cache);
 
-    #ifdef FF_HAVE_LIBPCI
-        pciFillGPUs(instance, &gpus);
-    #endif
+    //libpci and vulkan are only needed where sysfs isn't available
+    if(!sysfsFillGPUs(instance, &gpus))
+    {
+        #ifdef FF_HAVE_LIBPCI
+            //The driver is only detected if the format uses it
+            if(!(ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_GPU].format) & FF_FORMAT_ARG_MASK(5)))
+                cache.args &= ~FF_FORMAT_ARG_MASK(5);
+
+            pciFillGPUs(instance, &gpus);
+        #endif
+    }
 
     #ifdef FF_HAVE_VULKAN
         if(gpus.length == 0)
@@ -246,7 +285,7 @@ void ffPrintGPU(FFinstance* instance)
         printGPUResult(instance, gpus.length == 1 ? 0 : (uint8_t) (i + 1), &cache, ffListGet(&gpus, i));
 
     if(gpus.length == 0)
-        ffPrintError(instance, FF_GPU_MODULE_NAME, 0, &instance->config.gpuKey, &instance->config.gpuFormat, FF_GPU_NUM_FORMAT_ARGS, "No GPUs found.");
+        ffPrintError(instance, FF_GPU_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_GPU].key, instance->state.modules[FF_MODULE_ID_GPU].format, FF_GPU_NUM_FORMAT_ARGS, "No GPUs found.");
 
     ffCacheClose(&cache);
     ffListDestroy(&gpus);
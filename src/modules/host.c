@@ -3,7 +3,6 @@
 #include <ctype.h>
 
 #define FF_HOST_MODULE_NAME "Host"
-#define FF_HOST_NUM_FORMAT_ARGS 3
 
 static bool hostValueSet(FFstrbuf* value)
 {
@@ -44,7 +43,7 @@ static void getHostValue(const char* devicesPath, const char* classPath, FFstrbu
 
 void ffPrintHost(FFinstance* instance)
 {
-    if(ffPrintFromCache(instance, FF_HOST_MODULE_NAME, &instance->config.hostKey, &instance->config.hostFormat, FF_HOST_NUM_FORMAT_ARGS))
+    if(ffPrintFromCache(instance, FF_HOST_MODULE_NAME, instance->state.modules[FF_MODULE_ID_HOST].key, instance->state.modules[FF_MODULE_ID_HOST].format, FF_HOST_NUM_FORMAT_ARGS))
         return;
 
     FFstrbuf family;
@@ -101,7 +100,7 @@ void ffPrintHost(FFinstance* instance)
         ffStrbufDestroy(&family);
         ffStrbufDestroy(&name);
         ffStrbufDestroy(&version);
-        ffPrintError(instance, FF_HOST_MODULE_NAME, 0, &instance->config.hostKey, &instance->config.hostFormat, FF_HOST_NUM_FORMAT_ARGS, "neither family nor name is set by O.E.M.");
+        ffPrintError(instance, FF_HOST_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_HOST].key, instance->state.modules[FF_MODULE_ID_HOST].format, FF_HOST_NUM_FORMAT_ARGS, "neither family nor name is set by O.E.M.");
         return;
     }
 
@@ -119,7 +118,7 @@ void ffPrintHost(FFinstance* instance)
         ffStrbufAppend(&host, &version);
     }
 
-    ffPrintAndSaveToCache(instance, FF_HOST_MODULE_NAME, &instance->config.hostKey, &host, &instance->config.hostFormat, FF_HOST_NUM_FORMAT_ARGS, (FFformatarg[]) {
+    ffPrintAndSaveToCache(instance, FF_HOST_MODULE_NAME, instance->state.modules[FF_MODULE_ID_HOST].key, &host, instance->state.modules[FF_MODULE_ID_HOST].format, FF_HOST_NUM_FORMAT_ARGS, (FFformatarg[]) {
         {FF_FORMAT_ARG_TYPE_STRBUF, &family},
         {FF_FORMAT_ARG_TYPE_STRBUF, &name},
         {FF_FORMAT_ARG_TYPE_STRBUF, &version}
@@ -1,12 +1,11 @@
 #include "fastfetch.h"
 
 #define FF_ICONS_MODULE_NAME "Icons"
-#define FF_ICONS_NUM_FORMAT_ARGS 5
 
 void ffPrintIcons(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_ICONS_MODULE_NAME, 0, &instance->config.iconsKey, &instance->config.iconsFormat, FF_ICONS_NUM_FORMAT_ARGS, "Icons detection is not supported on Android");
+        ffPrintError(instance, FF_ICONS_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_ICONS].key, instance->state.modules[FF_MODULE_ID_ICONS].format, FF_ICONS_NUM_FORMAT_ARGS, "Icons detection is not supported on Android");
         return;
     #endif
 
@@ -14,42 +13,58 @@ void ffPrintIcons(FFinstance* instance)
 
     if(ffStrbufIgnCaseCompS(&wmde->wmProtocolName, "TTY") == 0)
     {
-        ffPrintError(instance, FF_ICONS_MODULE_NAME, 0, &instance->config.fontKey, &instance->config.fontFormat, FF_ICONS_NUM_FORMAT_ARGS, "Icons aren't supported in TTY");
+        ffPrintError(instance, FF_ICONS_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key, instance->state.modules[FF_MODULE_ID_FONT].format, FF_ICONS_NUM_FORMAT_ARGS, "Icons aren't supported in TTY");
         return;
     }
 
-    const FFstrbuf* plasma = &ffDetectPlasma(instance)->icons;
-    const FFstrbuf* gtk2 = &ffDetectGTK2(instance)->icons;
-    const FFstrbuf* gtk3 = &ffDetectGTK3(instance)->icons;
-    const FFstrbuf* gtk4 = &ffDetectGTK4(instance)->icons;
+    //Only detect the icons the format string uses. The default output uses all of them
+    uint64_t usedArgs = instance->state.modules[FF_MODULE_ID_ICONS].format == NULL ? UINT64_MAX : ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_ICONS].format);
+    uint64_t gtkPrettyArg = FF_FORMAT_ARG_MASK(5);
 
-    if(plasma->length == 0 && gtk2->length == 0 && gtk3->length == 0 && gtk4->length == 0)
+    FFstrbuf empty;
+    ffStrbufInitA(&empty, 0); //Doesn't allocate, so it doesn't need to be destroyed
+    const FFstrbuf* plasma = (usedArgs & FF_FORMAT_ARG_MASK(1)) ? &ffDetectPlasma(instance)->icons : &empty;
+    const FFstrbuf* gtk2 = (usedArgs & (FF_FORMAT_ARG_MASK(2) | gtkPrettyArg)) ? &ffDetectGTK2(instance)->icons : &empty;
+    const FFstrbuf* gtk3 = (usedArgs & (FF_FORMAT_ARG_MASK(3) | gtkPrettyArg)) ? &ffDetectGTK3(instance)->icons : &empty;
+    const FFstrbuf* gtk4 = (usedArgs & (FF_FORMAT_ARG_MASK(4) | gtkPrettyArg)) ? &ffDetectGTK4(instance)->icons : &empty;
+
+    //Whether there are no icons at all depends on the skipped ones too, so detect them before printing the error.
+    //A format without any argument doesn't care, it is printed as it is
+    if(usedArgs != 0 && plasma->length == 0 && gtk2->length == 0 && gtk3->length == 0 && gtk4->length == 0)
     {
-        ffPrintError(instance, FF_ICONS_MODULE_NAME, 0, &instance->config.iconsKey, &instance->config.iconsFormat, FF_ICONS_NUM_FORMAT_ARGS, "No icons could be found");
-        return;
+        plasma = &ffDetectPlasma(instance)->icons;
+        gtk2 = &ffDetectGTK2(instance)->icons;
+        gtk3 = &ffDetectGTK3(instance)->icons;
+        gtk4 = &ffDetectGTK4(instance)->icons;
+
+        if(plasma->length == 0 && gtk2->length == 0 && gtk3->length == 0 && gtk4->length == 0)
+        {
+            ffPrintError(instance, FF_ICONS_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_ICONS].key, instance->state.modules[FF_MODULE_ID_ICONS].format, FF_ICONS_NUM_FORMAT_ARGS, "No icons could be found");
+            return;
+        }
     }
 
     FF_STRBUF_CREATE(gtkPretty);
     ffGetGtkPretty(&gtkPretty, gtk2, gtk3, gtk4);
 
-    if(instance->config.iconsFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_ICONS].format))
     {
-        ffPrintLogoAndKey(instance, FF_ICONS_MODULE_NAME, 0, &instance->config.iconsKey);
+        ffPrintLogoAndKey(instance, FF_ICONS_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_ICONS].key);
 
         if(plasma->length > 0)
         {
-            ffStrbufWriteTo(plasma, stdout);
-            fputs(" [Plasma]", stdout);
+            ffOutputWrite(instance, plasma);
+            ffOutputWriteS(instance, " [Plasma]");
 
             if(gtkPretty.length > 0)
-                fputs(", ", stdout);
+                ffOutputWriteS(instance, ", ");
         }
 
-        ffStrbufPutTo(&gtkPretty, stdout);
+        ffOutputPut(instance, &gtkPretty);
     }
     else
     {
-        ffPrintFormatString(instance, FF_ICONS_MODULE_NAME, 0, &instance->config.iconsKey, &instance->config.iconsFormat, NULL, FF_ICONS_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_ICONS_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_ICONS].key, instance->state.modules[FF_MODULE_ID_ICONS].format, NULL, FF_ICONS_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, plasma},
             {FF_FORMAT_ARG_TYPE_STRBUF, gtk2},
             {FF_FORMAT_ARG_TYPE_STRBUF, gtk3},
@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef FASTFETCH_INCLUDED_MODULES_LIST
+#define FASTFETCH_INCLUDED_MODULES_LIST
+
+//Number of format args of every module that supports a format string
+#define FF_OS_NUM_FORMAT_ARGS 12
+#define FF_HOST_NUM_FORMAT_ARGS 3
+#define FF_KERNEL_NUM_FORMAT_ARGS 3
+#define FF_UPTIME_NUM_FORMAT_ARGS 4
+#define FF_PROCESSES_NUM_FORMAT_ARGS 1
+#define FF_PACKAGES_NUM_FORMAT_ARGS 11
+#define FF_SHELL_NUM_FORMAT_ARGS 7
+#define FF_RESOLUTION_NUM_FORMAT_ARGS 3
+#define FF_DE_NUM_FORMAT_ARGS 3
+#define FF_WM_NUM_FORMAT_ARGS 3
+#define FF_THEME_NUM_FORMAT_ARGS 7
+#define FF_WMTHEME_NUM_FORMAT_ARGS 1
+#define FF_ICONS_NUM_FORMAT_ARGS 5
+#define FF_FONT_NUM_FORMAT_ARGS 21
+#define FF_CURSOR_NUM_FORMAT_ARGS 2
+#define FF_TERMINAL_NUM_FORMAT_ARGS 3
+#define FF_TERMFONT_NUM_FORMAT_ARGS 5
+#define FF_CPU_NUM_FORMAT_ARGS 24
+#define FF_CPU_USAGE_NUM_FORMAT_ARGS 2
+#define FF_GPU_NUM_FORMAT_ARGS 5
+#define FF_MEMORY_NUM_FORMAT_ARGS 13
+#define FF_DISK_NUM_FORMAT_ARGS 8
+#define FF_DISK_IO_NUM_FORMAT_ARGS 2
+#define FF_BATTERY_NUM_FORMAT_ARGS 5
+#define FF_LOCALE_NUM_FORMAT_ARGS 1
+#define FF_LOCALIP_NUM_FORMAT_ARGS 2
+#define FF_NET_IO_NUM_FORMAT_ARGS 2
+#define FF_PUBLICIP_NUM_FORMAT_ARGS 1
+#define FF_PLAYER_NUM_FORMAT_ARGS 1
+#define FF_SONG_NUM_FORMAT_ARGS 3
+
+#define FF_DETECTORS_THEME (FF_DETECTOR_DISPLAY_SERVER | FF_DETECTOR_GTK2 | FF_DETECTOR_GTK3 | FF_DETECTOR_GTK4 | FF_DETECTOR_PLASMA)
+#define FF_DETECTORS_GTK (FF_DETECTOR_DISPLAY_SERVER | FF_DETECTOR_GTK2 | FF_DETECTOR_GTK3 | FF_DETECTOR_GTK4)
+
+//Every module that can be used in the structure.
+//FF_MODULE(id, name, alias, option prefix, print function, detectors, cache policy, number of format args)
+//The id is the index of the module in ffModules and instance->config.modules (FF_MODULE_ID_*).
+//The option prefix names the --<prefix>-format and --<prefix>-key options, NULL if the module has none.
+//Detectors are the background detections the module waits for (FF_DETECTOR_*).
+//The module generator builds a perfect hash table of the names and aliases at build time, common/modules.c the descriptors.
+
+#define FF_MODULE_LIST \
+    FF_MODULE(BREAK, "break", NULL, NULL, ffPrintBreak, FF_DETECTOR_NONE, NONE, 0) \
+    FF_MODULE(TITLE, "title", NULL, NULL, ffPrintTitle, FF_DETECTOR_NONE, NONE, 0) \
+    FF_MODULE(SEPARATOR, "separator", NULL, NULL, ffPrintSeparator, FF_DETECTOR_NONE, NONE, 0) \
+    FF_MODULE(OS, "os", NULL, "os", ffPrintOS, FF_DETECTOR_NONE, SAVED, FF_OS_NUM_FORMAT_ARGS) \
+    FF_MODULE(HOST, "host", NULL, "host", ffPrintHost, FF_DETECTOR_NONE, SAVED, FF_HOST_NUM_FORMAT_ARGS) \
+    FF_MODULE(KERNEL, "kernel", NULL, "kernel", ffPrintKernel, FF_DETECTOR_NONE, NONE, FF_KERNEL_NUM_FORMAT_ARGS) \
+    FF_MODULE(UPTIME, "uptime", NULL, "uptime", ffPrintUptime, FF_DETECTOR_NONE, NONE, FF_UPTIME_NUM_FORMAT_ARGS) \
+    FF_MODULE(PROCESSES, "processes", NULL, "processes", ffPrintProcesses, FF_DETECTOR_NONE, NONE, FF_PROCESSES_NUM_FORMAT_ARGS) \
+    FF_MODULE(PACKAGES, "packages", NULL, "packages", ffPrintPackages, FF_DETECTOR_NONE, NONE, FF_PACKAGES_NUM_FORMAT_ARGS) \
+    FF_MODULE(SHELL, "shell", NULL, "shell", ffPrintShell, FF_DETECTOR_NONE, NONE, FF_SHELL_NUM_FORMAT_ARGS) \
+    FF_MODULE(RESOLUTION, "resolution", NULL, "resolution", ffPrintResolution, FF_DETECTOR_DISPLAY_SERVER, NONE, FF_RESOLUTION_NUM_FORMAT_ARGS) \
+    FF_MODULE(DE, "desktopenvironment", "de", "de", ffPrintDesktopEnvironment, FF_DETECTOR_DISPLAY_SERVER, NONE, FF_DE_NUM_FORMAT_ARGS) \
+    FF_MODULE(WM, "windowmanager", "wm", "wm", ffPrintWM, FF_DETECTOR_DISPLAY_SERVER, NONE, FF_WM_NUM_FORMAT_ARGS) \
+    FF_MODULE(THEME, "theme", NULL, "theme", ffPrintTheme, FF_DETECTORS_THEME, NONE, FF_THEME_NUM_FORMAT_ARGS) \
+    FF_MODULE(WMTHEME, "wmtheme", NULL, "wm-theme", ffPrintWMTheme, FF_DETECTORS_GTK, NONE, FF_WMTHEME_NUM_FORMAT_ARGS) \
+    FF_MODULE(ICONS, "icons", NULL, "icons", ffPrintIcons, FF_DETECTORS_THEME, NONE, FF_ICONS_NUM_FORMAT_ARGS) \
+    FF_MODULE(FONT, "font", NULL, "font", ffPrintFont, FF_DETECTORS_THEME, NONE, FF_FONT_NUM_FORMAT_ARGS) \
+    FF_MODULE(CURSOR, "cursor", NULL, "cursor", ffPrintCursor, FF_DETECTORS_GTK, NONE, FF_CURSOR_NUM_FORMAT_ARGS) \
+    FF_MODULE(TERMINAL, "terminal", NULL, "terminal", ffPrintTerminal, FF_DETECTOR_NONE, NONE, FF_TERMINAL_NUM_FORMAT_ARGS) \
+    FF_MODULE(TERMFONT, "terminalfont", NULL, "terminal-font", ffPrintTerminalFont, FF_DETECTOR_DISPLAY_SERVER, NONE, FF_TERMFONT_NUM_FORMAT_ARGS) \
+    FF_MODULE(CPU, "cpu", NULL, "cpu", ffPrintCPU, FF_DETECTOR_NONE, SAVED, FF_CPU_NUM_FORMAT_ARGS) \
+    FF_MODULE(CPU_USAGE, "cpuusage", NULL, "cpu-usage", ffPrintCPUUsage, FF_DETECTOR_SAMPLE_CPU, NONE, FF_CPU_USAGE_NUM_FORMAT_ARGS) \
+    FF_MODULE(GPU, "gpu", NULL, "gpu", ffPrintGPU, FF_DETECTOR_NONE, SAVED, FF_GPU_NUM_FORMAT_ARGS) \
+    FF_MODULE(MEMORY, "memory", NULL, "memory", ffPrintMemory, FF_DETECTOR_NONE, NONE, FF_MEMORY_NUM_FORMAT_ARGS) \
+    FF_MODULE(DISK, "disk", NULL, "disk", ffPrintDisk, FF_DETECTOR_NONE, NONE, FF_DISK_NUM_FORMAT_ARGS) \
+    FF_MODULE(DISK_IO, "diskio", NULL, "disk-io", ffPrintDiskIO, FF_DETECTOR_SAMPLE_DISK, NONE, FF_DISK_IO_NUM_FORMAT_ARGS) \
+    FF_MODULE(BATTERY, "battery", NULL, "battery", ffPrintBattery, FF_DETECTOR_NONE, NONE, FF_BATTERY_NUM_FORMAT_ARGS) \
+    FF_MODULE(LOCALE, "locale", NULL, "locale", ffPrintLocale, FF_DETECTOR_NONE, SAVED, FF_LOCALE_NUM_FORMAT_ARGS) \
+    FF_MODULE(LOCALIP, "localip", NULL, "local-ip", ffPrintLocalIp, FF_DETECTOR_NONE, NONE, FF_LOCALIP_NUM_FORMAT_ARGS) \
+    FF_MODULE(NET_IO, "netio", NULL, "net-io", ffPrintNetIO, FF_DETECTOR_SAMPLE_NETWORK, NONE, FF_NET_IO_NUM_FORMAT_ARGS) \
+    FF_MODULE(PUBLICIP, "publicip", NULL, "public-ip", ffPrintPublicIp, FF_DETECTOR_NONE, NONE, FF_PUBLICIP_NUM_FORMAT_ARGS) \
+    FF_MODULE(PLAYER, "player", NULL, "player", ffPrintPlayer, FF_DETECTOR_NONE, NONE, FF_PLAYER_NUM_FORMAT_ARGS) \
+    FF_MODULE(SONG, "song", NULL, "song", ffPrintSong, FF_DETECTOR_NONE, NONE, FF_SONG_NUM_FORMAT_ARGS) \
+    FF_MODULE(COLORS, "colors", NULL, NULL, ffPrintColors, FF_DETECTOR_NONE, NONE, 0)
+
+#endif
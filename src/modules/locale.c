@@ -1,7 +1,6 @@
 #include "fastfetch.h"
 
 #define FF_LOCALE_MODULE_NAME "Locale"
-#define FF_LOCALE_NUM_FORMAT_ARGS 1
 
 static void getLocaleFromEnv(FFstrbuf* locale)
 {
@@ -22,7 +21,7 @@ static void getLocaleFromEnv(FFstrbuf* locale)
 
 void ffPrintLocale(FFinstance* instance)
 {
-	if(ffPrintFromCache(instance, FF_LOCALE_MODULE_NAME, &instance->config.localeKey, &instance->config.localeFormat, FF_LOCALE_NUM_FORMAT_ARGS))
+	if(ffPrintFromCache(instance, FF_LOCALE_MODULE_NAME, instance->state.modules[FF_MODULE_ID_LOCALE].key, instance->state.modules[FF_MODULE_ID_LOCALE].format, FF_LOCALE_NUM_FORMAT_ARGS))
         return;
 
 	FFstrbuf locale;
@@ -35,11 +34,11 @@ void ffPrintLocale(FFinstance* instance)
 
     if(locale.length == 0)
     {
-        ffPrintError(instance, FF_LOCALE_MODULE_NAME, 0, &instance->config.localeKey, &instance->config.localeFormat, FF_LOCALE_NUM_FORMAT_ARGS, "No locale found");
+        ffPrintError(instance, FF_LOCALE_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_LOCALE].key, instance->state.modules[FF_MODULE_ID_LOCALE].format, FF_LOCALE_NUM_FORMAT_ARGS, "No locale found");
         return;
     }
 
-    ffPrintAndSaveToCache(instance, FF_LOCALE_MODULE_NAME, &instance->config.localeKey, &locale, &instance->config.localeFormat, FF_LOCALE_NUM_FORMAT_ARGS, (FFformatarg[]){
+    ffPrintAndSaveToCache(instance, FF_LOCALE_MODULE_NAME, instance->state.modules[FF_MODULE_ID_LOCALE].key, &locale, instance->state.modules[FF_MODULE_ID_LOCALE].format, FF_LOCALE_NUM_FORMAT_ARGS, (FFformatarg[]){
         {FF_FORMAT_ARG_TYPE_STRBUF, &locale}
     });
 
@@ -1,7 +1,6 @@
 #include "fastfetch.h"
 
 #define FF_LOCALIP_MODULE_NAME "Local IP"
-#define FF_LOCALIP_NUM_FORMAT_ARGS 1
 
 #include <sys/types.h>
 #include <ifaddrs.h>
@@ -13,20 +12,24 @@ static void printValue(FFinstance* instance, const char* ifaName, const char* ad
 {
     FF_STRBUF_CREATE(key);
 
-    if (instance->config.localIpKey.length == 0) {
+    //JSON output has no keys, the key is its type there. The interface is a result instead
+    if (instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON) {
+        ffStrbufSetS(&key, FF_LOCALIP_MODULE_NAME);
+    } else if (instance->state.modules[FF_MODULE_ID_LOCALIP].key == NULL) {
         ffStrbufAppendF(&key, FF_LOCALIP_MODULE_NAME " (%s)", ifaName);
     } else {
-        ffParseFormatString(&key, &instance->config.localIpKey, NULL, 1, (FFformatarg[]){
+        ffFormatRender(&key, instance->state.modules[FF_MODULE_ID_LOCALIP].key, NULL, 1, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRING, ifaName}
         });
     }
 
-    if (instance->config.localIpFormat.length == 0) {
-        ffPrintLogoAndKey(instance, FF_LOCALIP_MODULE_NAME, 0, &key);
-        puts(addressBuffer);
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_LOCALIP].format)) {
+        ffPrintLogoAndKey(instance, key.chars, 0, NULL);
+        ffOutputPutS(instance, addressBuffer);
     } else {
-        ffPrintFormatString(instance, FF_LOCALIP_MODULE_NAME, 0, &key, &instance->config.localIpFormat, NULL, FF_LOCALIP_NUM_FORMAT_ARGS, (FFformatarg[]){
-            {FF_FORMAT_ARG_TYPE_STRING, addressBuffer}
+        ffPrintFormatString(instance, key.chars, 0, NULL, instance->state.modules[FF_MODULE_ID_LOCALIP].format, NULL, FF_LOCALIP_NUM_FORMAT_ARGS, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_STRING, addressBuffer},
+            {FF_FORMAT_ARG_TYPE_STRING, ifaName}
         });
     }
 
@@ -38,7 +41,7 @@ void ffPrintLocalIp(FFinstance* instance)
     struct ifaddrs* ifAddrStruct = NULL;
     int ret = getifaddrs(&ifAddrStruct);
     if (ret < 0) {
-        ffPrintError(instance, FF_LOCALIP_MODULE_NAME, 0, &instance->config.localIpKey, &instance->config.localIpFormat, FF_LOCALIP_NUM_FORMAT_ARGS, "getifaddrs(&ifAddrStruct) < 0 (%i)", ret);
+        ffPrintError(instance, FF_LOCALIP_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_LOCALIP].key, instance->state.modules[FF_MODULE_ID_LOCALIP].format, FF_LOCALIP_NUM_FORMAT_ARGS, "getifaddrs(&ifAddrStruct) < 0 (%i)", ret);
         return;
     }
 
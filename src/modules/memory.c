@@ -1,62 +1,71 @@
 #include "fastfetch.h"
 
 #define FF_MEMORY_MODULE_NAME "Memory"
-#define FF_MEMORY_NUM_FORMAT_ARGS 3
+
+static uint8_t getPercentage(uint64_t used, uint64_t total)
+{
+    if(total == 0)
+        return 0;
+    return (uint8_t) (((double) used / (double) total) * 100);
+}
 
 // Impl inspired by: https://github.com/sam-barr/paleofetch/blob/b7c58a52c0de39b53c9b5f417889a5886d324bfa/paleofetch.c#L544
 void ffPrintMemory(FFinstance* instance)
 {
-    FILE* meminfo = fopen("/proc/meminfo", "r");
-    if(meminfo == NULL) {
-        ffPrintError(instance, FF_MEMORY_MODULE_NAME, 0, &instance->config.memoryKey, &instance->config.memoryFormat, FF_MEMORY_NUM_FORMAT_ARGS, "fopen(\"/proc/meminfo\", \"r\") == NULL");
+    FFMemoryResult result;
+    if(!ffDetectMemInfo("/proc/meminfo", &result))
+    {
+        ffPrintError(instance, FF_MEMORY_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_MEMORY].key, instance->state.modules[FF_MODULE_ID_MEMORY].format, FF_MEMORY_NUM_FORMAT_ARGS, "/proc/meminfo could't be parsed");
         return;
     }
 
-    char* line = NULL;
-    size_t len = 0;
-
-    uint32_t total = 0,
-             shared = 0,
-             memfree = 0,
-             buffers = 0,
-             cached = 0,
-             reclaimable = 0;
-
-    while (getline(&line, &len, meminfo) != -1) {
-        sscanf(line, "MemTotal: %u", &total);
-        sscanf(line, "Shmem: %u", &shared);
-        sscanf(line, "MemFree: %u", &memfree);
-        sscanf(line, "Buffers: %u", &buffers);
-        sscanf(line, "Cached: %u", &cached);
-        sscanf(line, "SReclaimable: %u", &reclaimable);
-    }
+    uint64_t usedArgs = ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_MEMORY].format);
+    if(usedArgs & FF_FORMAT_ARG_MASK(13))
+        ffDetectZFSArc("/proc/spl/kstat/zfs/arcstats", &result);
 
-    if(line != NULL)
-        free(line);
+    uint64_t used_mem = (result.total + result.shared - result.free - result.buffers - result.cached - result.sReclaimable) / 1024;
+    uint64_t total_mem = result.total / 1024;
+    uint8_t percentage = getPercentage(used_mem, total_mem);
 
-    fclose(meminfo);
+    uint64_t available_mem = result.available / 1024;
+    uint64_t swap_total = result.swapTotal / 1024;
+    uint64_t swap_used = (result.swapTotal - result.swapFree) / 1024;
+    uint8_t swap_percentage = getPercentage(swap_used, swap_total);
+    uint64_t zswap = result.zswap / 1024;
+    uint64_t zswapped = result.zswapped / 1024;
+    uint64_t arc = result.arcSize / 1024 / 1024;
 
-    uint32_t used_mem = (total + shared - memfree - buffers - cached - reclaimable) / 1024;
-    uint32_t total_mem = total / 1024;
-    uint8_t percentage = (uint8_t) ((used_mem / (double) total_mem) * 100);
-
-    if(used_mem == 0 && total_mem == 0 && percentage == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_MEMORY].format))
     {
-        ffPrintError(instance, FF_MEMORY_MODULE_NAME, 0, &instance->config.memoryKey, &instance->config.memoryFormat, FF_MEMORY_NUM_FORMAT_ARGS, "/proc/meminfo could't be parsed");
-        return;
-    }
+        ffPrintLogoAndKey(instance, FF_MEMORY_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_MEMORY].key);
 
-    if(instance->config.memoryFormat.length == 0)
-    {
-        ffPrintLogoAndKey(instance, FF_MEMORY_MODULE_NAME, 0, &instance->config.memoryKey);
-        printf("%uMiB / %uMiB (%u%%)\n", used_mem, total_mem, percentage);
+        FFstrbuf memory;
+        ffStrbufInitA(&memory, 32);
+        ffStrbufAppendUInt(&memory, used_mem);
+        ffStrbufAppendS(&memory, "MiB / ");
+        ffStrbufAppendUInt(&memory, total_mem);
+        ffStrbufAppendS(&memory, "MiB (");
+        ffStrbufAppendUInt(&memory, percentage);
+        ffStrbufAppendS(&memory, "%)");
+        ffOutputPut(instance, &memory);
+        ffStrbufDestroy(&memory);
     }
     else
     {
-        ffPrintFormatString(instance, FF_MEMORY_MODULE_NAME, 0, &instance->config.memoryKey, &instance->config.memoryFormat, NULL, FF_MEMORY_NUM_FORMAT_ARGS, (FFformatarg[]){
-            {FF_FORMAT_ARG_TYPE_UINT, &used_mem},
-            {FF_FORMAT_ARG_TYPE_UINT, &total_mem},
-            {FF_FORMAT_ARG_TYPE_UINT8, &percentage}
+        ffPrintFormatString(instance, FF_MEMORY_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_MEMORY].key, instance->state.modules[FF_MODULE_ID_MEMORY].format, NULL, FF_MEMORY_NUM_FORMAT_ARGS, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_UINT64, &used_mem},
+            {FF_FORMAT_ARG_TYPE_UINT64, &total_mem},
+            {FF_FORMAT_ARG_TYPE_UINT8, &percentage},
+            {FF_FORMAT_ARG_TYPE_UINT64, &available_mem},
+            {FF_FORMAT_ARG_TYPE_UINT64, &swap_used},
+            {FF_FORMAT_ARG_TYPE_UINT64, &swap_total},
+            {FF_FORMAT_ARG_TYPE_UINT8, &swap_percentage},
+            {FF_FORMAT_ARG_TYPE_UINT64, &result.hugePagesTotal},
+            {FF_FORMAT_ARG_TYPE_UINT64, &result.hugePagesFree},
+            {FF_FORMAT_ARG_TYPE_UINT64, &result.hugePageSize},
+            {FF_FORMAT_ARG_TYPE_UINT64, &zswap},
+            {FF_FORMAT_ARG_TYPE_UINT64, &zswapped},
+            {FF_FORMAT_ARG_TYPE_UINT64, &arc}
         });
     }
 }
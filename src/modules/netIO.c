@@ -0,0 +1,44 @@
+#include "fastfetch.h"
+
+#define FF_NET_IO_MODULE_NAME "Net IO"
+
+static void appendMiBs(FFstrbuf* buffer, double value)
+{
+    ffStrbufAppendDoubleF(buffer, value, 2);
+    ffStrbufAppendS(buffer, " MiB/s");
+}
+
+void ffPrintNetIO(FFinstance* instance)
+{
+    const FFsample* first;
+    const FFsample* second;
+    if(!ffSamplingMeasure(instance, FF_SAMPLE_TYPE_NETWORK, &first, &second))
+    {
+        ffPrintError(instance, FF_NET_IO_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_NET_IO].key, instance->state.modules[FF_MODULE_ID_NET_IO].format, FF_NET_IO_NUM_FORMAT_ARGS, "Couldn't sample \"/proc/net/dev\"");
+        return;
+    }
+
+    double received = ffSamplingGetRate(first, second, 0) / 1024.0 / 1024.0;
+    double sent = ffSamplingGetRate(first, second, 1) / 1024.0 / 1024.0;
+
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_NET_IO].format))
+    {
+        ffPrintLogoAndKey(instance, FF_NET_IO_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_NET_IO].key);
+
+        FFstrbuf io;
+        ffStrbufInitA(&io, 48);
+        appendMiBs(&io, received);
+        ffStrbufAppendS(&io, " (received), ");
+        appendMiBs(&io, sent);
+        ffStrbufAppendS(&io, " (sent)");
+        ffOutputPut(instance, &io);
+        ffStrbufDestroy(&io);
+    }
+    else
+    {
+        ffPrintFormatString(instance, FF_NET_IO_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_NET_IO].key, instance->state.modules[FF_MODULE_ID_NET_IO].format, NULL, FF_NET_IO_NUM_FORMAT_ARGS, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_DOUBLE, &received},
+            {FF_FORMAT_ARG_TYPE_DOUBLE, &sent}
+        });
+    }
+}
@@ -1,18 +1,17 @@
 #include "fastfetch.h"
 
 #define FF_OS_MODULE_NAME "OS"
-#define FF_OS_NUM_FORMAT_ARGS 12
 
 void ffPrintOS(FFinstance* instance)
 {
-    if(ffPrintFromCache(instance, FF_OS_MODULE_NAME, &instance->config.osKey, &instance->config.osFormat, FF_OS_NUM_FORMAT_ARGS))
+    if(ffPrintFromCache(instance, FF_OS_MODULE_NAME, instance->state.modules[FF_MODULE_ID_OS].key, instance->state.modules[FF_MODULE_ID_OS].format, FF_OS_NUM_FORMAT_ARGS))
         return;
 
     const FFOSResult* result = ffDetectOS(instance);
 
     if(result->name.length == 0 && result->prettyName.length == 0)
     {
-        ffPrintError(instance, FF_OS_MODULE_NAME, 0, &instance->config.osKey, &instance->config.osFormat, FF_OS_NUM_FORMAT_ARGS, "Could not detect OS");
+        ffPrintError(instance, FF_OS_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_OS].key, instance->state.modules[FF_MODULE_ID_OS].format, FF_OS_NUM_FORMAT_ARGS, "Could not detect OS");
         return;
     }
 
@@ -69,7 +68,7 @@ void ffPrintOS(FFinstance* instance)
         ffStrbufAppendC(&os, ']');
     }
 
-    ffPrintAndSaveToCache(instance, FF_OS_MODULE_NAME, &instance->config.osKey, &os, &instance->config.osFormat, FF_OS_NUM_FORMAT_ARGS, (FFformatarg[]){
+    ffPrintAndSaveToCache(instance, FF_OS_MODULE_NAME, instance->state.modules[FF_MODULE_ID_OS].key, &os, instance->state.modules[FF_MODULE_ID_OS].format, FF_OS_NUM_FORMAT_ARGS, (FFformatarg[]){
         {FF_FORMAT_ARG_TYPE_STRBUF, &result->systemName},
         {FF_FORMAT_ARG_TYPE_STRBUF, &result->name},
         {FF_FORMAT_ARG_TYPE_STRBUF, &result->prettyName},
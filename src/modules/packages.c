@@ -4,7 +4,6 @@
 #include <dirent.h>
 
 #define FF_PACKAGES_MODULE_NAME "Packages"
-#define FF_PACKAGES_NUM_FORMAT_ARGS 9
 
 #ifdef FF_HAVE_RPM
 #include <rpm/rpmlib.h>
@@ -44,28 +43,6 @@ exit:
 
 #endif
 
-static uint32_t getNumElements(const char* dirname, unsigned char type)
-{
-    DIR* dirp = opendir(dirname);
-    if(dirp == NULL)
-        return 0;
-
-    uint32_t num_elements = 0;
-
-    struct dirent *entry;
-    while((entry = readdir(dirp)) != NULL) {
-        if(entry->d_type == type)
-            ++num_elements;
-    }
-
-    if(type == DT_DIR)
-        num_elements -= 2; // accounting for . and ..
-
-    closedir(dirp);
-
-    return num_elements;
-}
-
 static uint32_t getNumStrings(const char* filename, const char* needle)
 {
     FILE* file = fopen(filename, "r");
@@ -136,35 +113,173 @@ static uint32_t countFilesIn(const char* dirname, const char* filename)
     return result;
 }
 
-void ffPrintPackages(FFinstance* instance)
+static uint32_t countPacman(FFinstance* instance)
 {
-    uint32_t pacman = getNumElements("/var/lib/pacman/local", DT_DIR);
-    uint32_t dpkg = getNumStrings("/var/lib/dpkg/status", "Status: ");
+    FF_UNUSED(instance)
+    return ffPackagesCountDirEntries("/var/lib/pacman/local", DT_DIR);
+}
+
+static uint32_t countDpkg(FFinstance* instance)
+{
+    FF_UNUSED(instance)
+    uint32_t count = getNumStrings("/var/lib/dpkg/status", "Status: ");
 
     #if __ANDROID__
-        dpkg += getNumStrings("/data/data/com.termux/files/usr/var/lib/dpkg/status", "Status: ");
+        count += getNumStrings("/data/data/com.termux/files/usr/var/lib/dpkg/status", "Status: ");
     #endif
 
+    return count;
+}
+
+static uint32_t countRpm(FFinstance* instance)
+{
+    //Modern rpm stores its database in sqlite. Reading it directly skips librpm parsing all of its macro files.
+    //librpm is still needed for the BerkeleyDB and NDB backends
+    uint32_t count = ffPackagesCountSQLite3(instance, "/var/lib/rpm/rpmdb.sqlite", "SELECT count(*) FROM Packages", 0, NULL);
+    if(count == 0)
+        count = ffPackagesCountSQLite3(instance, "/usr/lib/sysimage/rpm/rpmdb.sqlite", "SELECT count(*) FROM Packages", 0, NULL);
+
     #ifdef FF_HAVE_RPM
-        uint32_t rpm = getRpmPackageCount(instance);
-    #else
-        uint32_t rpm = 0;
+        if(count == 0)
+            count = getRpmPackageCount(instance);
     #endif
 
-    uint32_t emerge = countFilesIn("/var/db/pkg", "SIZE");
-    uint32_t xbps = getNumElements("/var/db/xbps", DT_REG);
-    uint32_t flatpak = getNumElements("/var/lib/flatpak/app", DT_DIR);
-    uint32_t snap = getNumElements("/snap", DT_DIR);
+    return count;
+}
+
+static uint32_t countEmerge(FFinstance* instance)
+{
+    FF_UNUSED(instance)
+    return countFilesIn("/var/db/pkg", "SIZE");
+}
+
+static uint32_t countXbps(FFinstance* instance)
+{
+    FF_UNUSED(instance)
+    return ffPackagesCountDirEntries("/var/db/xbps", DT_REG);
+}
+
+//Apps and runtimes of the system and the user installation
+static uint32_t countFlatpak(FFinstance* instance)
+{
+    FFstrbuf userInstallation;
+    ffStrbufInitA(&userInstallation, 64);
+    ffStrbufAppendS(&userInstallation, instance->state.passwd->pw_dir);
+    ffStrbufAppendS(&userInstallation, "/.local/share/flatpak");
+
+    uint32_t count = ffDetectPackagesFlatpak("/var/lib/flatpak") + ffDetectPackagesFlatpak(userInstallation.chars);
+
+    ffStrbufDestroy(&userInstallation);
+    return count;
+}
+
+static uint32_t countSnap(FFinstance* instance)
+{
+    FF_UNUSED(instance)
+    uint32_t count = ffPackagesCountDirEntries("/snap", DT_DIR);
 
     //Accounting for the /snap/bin folder
-    if(snap > 0)
-        --snap;
+    return count > 0 ? count - 1 : 0;
+}
+
+static uint32_t countApk(FFinstance* instance)
+{
+    FF_UNUSED(instance)
+    return ffDetectPackagesApk("/lib/apk/db/installed");
+}
+
+//Packages of the system, default and user profile
+static uint32_t countNix(FFinstance* instance)
+{
+    FFstrbuf userProfile;
+    ffStrbufInitA(&userProfile, 64);
+    ffStrbufAppendS(&userProfile, instance->state.passwd->pw_dir);
+    ffStrbufAppendS(&userProfile, "/.nix-profile");
+
+    const char* profiles[] = { "/run/current-system/sw", "/nix/var/nix/profiles/default", userProfile.chars };
+    uint32_t count = ffDetectPackagesNix(instance, "/nix/var/nix/db/db.sqlite", 3, profiles);
+
+    ffStrbufDestroy(&userProfile);
+    return count;
+}
+
+typedef enum FFpackageManager
+{
+    FF_PACKAGE_MANAGER_PACMAN,
+    FF_PACKAGE_MANAGER_DPKG,
+    FF_PACKAGE_MANAGER_RPM,
+    FF_PACKAGE_MANAGER_EMERGE,
+    FF_PACKAGE_MANAGER_XBPS,
+    FF_PACKAGE_MANAGER_FLATPAK,
+    FF_PACKAGE_MANAGER_SNAP,
+    FF_PACKAGE_MANAGER_APK,
+    FF_PACKAGE_MANAGER_NIX,
+    FF_PACKAGE_MANAGER_COUNT
+} FFpackageManager;
+
+//Same order as FFpackageManager. The timeout is used if --packages-timeout isn't set.
+//Counting a directory is instant, librpm and walking the portage tree are the slow ones.
+//None of them may start a process.
+static const struct {
+    const char* name;
+    uint32_t (*count)(FFinstance* instance);
+    uint32_t timeout; //ms
+} packageManagers[FF_PACKAGE_MANAGER_COUNT] = {
+    {"pacman", countPacman, 250},
+    {"dpkg", countDpkg, 500},
+    {"rpm", countRpm, 1000},
+    {"emerge", countEmerge, 1000},
+    {"xbps", countXbps, 250},
+    {"flatpak", countFlatpak, 250},
+    {"snap", countSnap, 250},
+    {"apk", countApk, 250},
+    {"nix", countNix, 500}
+};
+
+static void countPackageManager(void* instance, uint32_t manager, void* count)
+{
+    *(uint32_t*) count = packageManagers[manager].count(instance);
+}
+
+//Counts the packages of every manager at once, each in its own thread, even with --multithreading false.
+//known is false for the managers which missed their deadline
+static void countPackages(FFinstance* instance, uint32_t counts[FF_PACKAGE_MANAGER_COUNT], bool known[FF_PACKAGE_MANAGER_COUNT])
+{
+    uint32_t timeout = instance->config.modules[FF_MODULE_ID_PACKAGES].timeout;
 
-    uint32_t all = pacman + dpkg + rpm + emerge + xbps + flatpak + snap;
+    uint32_t timeouts[FF_PACKAGE_MANAGER_COUNT];
+    for(uint32_t i = 0; i < FF_PACKAGE_MANAGER_COUNT; ++i)
+    {
+        timeouts[i] = timeout > 0 ? timeout : packageManagers[i].timeout;
+        counts[i] = 0;
+    }
+
+    ffRunDeadlineTasks(FF_PACKAGE_MANAGER_COUNT, timeouts, countPackageManager, instance, NULL, sizeof(uint32_t), counts, known);
+}
+
+//A manager which missed its deadline is unknown. It is empty in custom formats and null in JSON, not 0
+static FFformatarg getCountArg(const uint32_t counts[FF_PACKAGE_MANAGER_COUNT], const bool known[FF_PACKAGE_MANAGER_COUNT], FFpackageManager manager)
+{
+    return (FFformatarg) {known[manager] ? FF_FORMAT_ARG_TYPE_UINT : FF_FORMAT_ARG_TYPE_NULL, &counts[manager]};
+}
+
+void ffPrintPackages(FFinstance* instance)
+{
+    uint32_t counts[FF_PACKAGE_MANAGER_COUNT];
+    bool known[FF_PACKAGE_MANAGER_COUNT];
+    countPackages(instance, counts, known);
 
-    if(all == 0)
+    uint32_t all = 0;
+    bool anyUnknown = false;
+    for(uint32_t i = 0; i < FF_PACKAGE_MANAGER_COUNT; ++i)
     {
-        ffPrintError(instance, FF_PACKAGES_MODULE_NAME, 0, &instance->config.packagesKey, &instance->config.packagesFormat, FF_PACKAGES_NUM_FORMAT_ARGS, "No packages from known package managers found");
+        all += counts[i];
+        anyUnknown |= !known[i];
+    }
+
+    if(all == 0 && !anyUnknown)
+    {
+        ffPrintError(instance, FF_PACKAGES_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PACKAGES].key, instance->state.modules[FF_MODULE_ID_PACKAGES].format, FF_PACKAGES_NUM_FORMAT_ARGS, "No packages from known package managers found");
         return;
     }
 
@@ -173,53 +288,46 @@ void ffPrintPackages(FFinstance* instance)
     if(ffParsePropFile("/etc/pacman-mirrors.conf", "Branch =", &manjaroBranch) && manjaroBranch.length == 0)
         ffStrbufSetS(&manjaroBranch, "stable");
 
-    if(instance->config.packagesFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_PACKAGES].format))
     {
-        ffPrintLogoAndKey(instance, FF_PACKAGES_MODULE_NAME, 0, &instance->config.batteryKey);
-
-        #define FF_PRINT_PACKAGE(name) \
-        if(name > 0) \
-        { \
-            printf("%u ("#name")", name); \
-            if((all = all - name) > 0) \
-                printf(", "); \
-        };
+        ffPrintLogoAndKey(instance, FF_PACKAGES_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PACKAGES].key);
 
-        if(pacman > 0)
+        bool first = true;
+        for(uint32_t i = 0; i < FF_PACKAGE_MANAGER_COUNT; ++i)
         {
-            printf("%u (pacman)", pacman);
-            if(manjaroBranch.length > 0)
-                printf("[%s]", manjaroBranch.chars);
-            if((all = all - pacman) > 0)
-                printf(", ");
-        };
-
-        FF_PRINT_PACKAGE(dpkg)
-        FF_PRINT_PACKAGE(rpm)
-        FF_PRINT_PACKAGE(emerge)
-        FF_PRINT_PACKAGE(xbps)
-        FF_PRINT_PACKAGE(flatpak)
-        FF_PRINT_PACKAGE(snap)
-
-        //Fix linter warning of unused value of all
-        (void) all;
-
-        #undef FF_PRINT_PACKAGE
-
-        putchar('\n');
+            if(known[i] && counts[i] == 0)
+                continue;
+
+            if(!first)
+                ffOutputWriteS(instance, ", ");
+            first = false;
+
+            //A manager which missed its deadline is printed as unknown
+            if(known[i])
+                ffOutputWriteF(instance, "%u (%s)", counts[i], packageManagers[i].name);
+            else
+                ffOutputWriteF(instance, "? (%s)", packageManagers[i].name);
+
+            if(i == FF_PACKAGE_MANAGER_PACMAN && manjaroBranch.length > 0)
+                ffOutputWriteF(instance, "[%s]", manjaroBranch.chars);
+        }
+
+        ffOutputWriteC(instance, '\n');
     }
     else
     {
-        ffPrintFormatString(instance, FF_PACKAGES_MODULE_NAME, 0, &instance->config.packagesKey, &instance->config.packagesFormat, NULL, FF_PACKAGES_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_PACKAGES_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PACKAGES].key, instance->state.modules[FF_MODULE_ID_PACKAGES].format, NULL, FF_PACKAGES_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_UINT, &all},
-            {FF_FORMAT_ARG_TYPE_UINT, &pacman},
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_PACMAN),
             {FF_FORMAT_ARG_TYPE_STRBUF, &manjaroBranch},
-            {FF_FORMAT_ARG_TYPE_UINT, &dpkg},
-            {FF_FORMAT_ARG_TYPE_UINT, &rpm},
-            {FF_FORMAT_ARG_TYPE_UINT, &emerge},
-            {FF_FORMAT_ARG_TYPE_UINT, &xbps},
-            {FF_FORMAT_ARG_TYPE_UINT, &flatpak},
-            {FF_FORMAT_ARG_TYPE_UINT, &snap}
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_DPKG),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_RPM),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_EMERGE),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_XBPS),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_FLATPAK),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_SNAP),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_APK),
+            getCountArg(counts, known, FF_PACKAGE_MANAGER_NIX)
         });
     }
 
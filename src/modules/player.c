@@ -1,7 +1,6 @@
 #include "fastfetch.h"
 
 #define FF_PLAYER_MODULE_NAME "Media Player"
-#define FF_PLAYER_NUM_FORMAT_ARGS 1
 
 void ffPrintPlayer(FFinstance* instance)
 {
@@ -9,18 +8,18 @@ void ffPrintPlayer(FFinstance* instance)
 
     if(media->player.length == 0)
     {
-        ffPrintError(instance, FF_PLAYER_MODULE_NAME, 0, &instance->config.playerKey, &instance->config.playerFormat, FF_PLAYER_NUM_FORMAT_ARGS, "No media player found");
+        ffPrintError(instance, FF_PLAYER_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PLAYER].key, instance->state.modules[FF_MODULE_ID_PLAYER].format, FF_PLAYER_NUM_FORMAT_ARGS, "No media player found");
         return;
     }
 
-    if(instance->config.playerFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_PLAYER].format))
     {
-        ffPrintLogoAndKey(instance, FF_PLAYER_MODULE_NAME, 0, &instance->config.playerKey);
-        ffStrbufPutTo(&media->player, stdout);
+        ffPrintLogoAndKey(instance, FF_PLAYER_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PLAYER].key);
+        ffOutputPut(instance, &media->player);
     }
     else
     {
-        ffPrintFormatString(instance, FF_PLAYER_MODULE_NAME, 0, &instance->config.playerKey, &instance->config.playerFormat, NULL, FF_PLAYER_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_PLAYER_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PLAYER].key, instance->state.modules[FF_MODULE_ID_PLAYER].format, NULL, FF_PLAYER_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &media->player}
         });
     }
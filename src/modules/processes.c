@@ -1,19 +1,18 @@
 #include "fastfetch.h"
 
 #define FF_PROCESSES_MODULE_NAME "Processes"
-#define FF_PROCESSES_NUM_FORMAT_ARGS 1
 
 void ffPrintProcesses(FFinstance* instance)
 {
-    if(instance->config.processesFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_PROCESSES].format))
     {
-        ffPrintLogoAndKey(instance, FF_PROCESSES_MODULE_NAME, 0, &instance->config.processesKey);
+        ffPrintLogoAndKey(instance, FF_PROCESSES_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PROCESSES].key);
 
-        printf("%hu\n", instance->state.sysinfo.procs);
+        ffOutputWriteF(instance, "%hu\n", instance->state.sysinfo.procs);
     }
     else
     {
-        ffPrintFormatString(instance, FF_PROCESSES_MODULE_NAME, 0, &instance->config.processesKey, &instance->config.processesFormat, NULL, FF_PROCESSES_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_PROCESSES_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PROCESSES].key, instance->state.modules[FF_MODULE_ID_PROCESSES].format, NULL, FF_PROCESSES_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_UINT16, &instance->state.sysinfo.procs}
         });
     }
@@ -1,30 +1,60 @@
 #include "fastfetch.h"
 
+#include <string.h>
+
 #define FF_PUBLICIP_MODULE_NAME "Public IP"
-#define FF_PUBLICIP_NUM_FORMAT_ARGS 1
+#define FF_PUBLICIP_MAX_URLS 16
+
+static const char* defaultUrls[] = {
+    "ipinfo.io/ip",
+    "api.ipify.org/",
+    "icanhazip.com/"
+};
 
 void ffPrintPublicIp(FFinstance* instance)
 {
     FFstrbuf result;
-    ffStrbufInitA(&result, 4096);
-    ffNetworkingGetHttp("ipinfo.io", "/ip", instance->config.publicIpTimeout, &result);
-    ffStrbufSubstrAfterFirstS(&result, "\r\n\r\n");
+    ffStrbufInitA(&result, 64);
+
+    if(instance->config.publicIpUrls.length == 0)
+        ffNetworkingGetHttpFirst(sizeof(defaultUrls) / sizeof(defaultUrls[0]), defaultUrls, instance->config.modules[FF_MODULE_ID_PUBLICIP].timeout, &result);
+    else
+    {
+        FFstrbuf urls;
+        ffStrbufInitCopy(&urls, &instance->config.publicIpUrls);
+
+        const char* urlList[FF_PUBLICIP_MAX_URLS];
+        uint32_t numUrls = 0;
+
+        char* saveptr;
+        for(char* url = strtok_r(urls.chars, " ", &saveptr); url != NULL && numUrls < FF_PUBLICIP_MAX_URLS; url = strtok_r(NULL, " ", &saveptr))
+            urlList[numUrls++] = url;
+
+        ffNetworkingGetHttpFirst(numUrls, urlList, instance->config.modules[FF_MODULE_ID_PUBLICIP].timeout, &result);
+        ffStrbufDestroy(&urls);
+    }
+
+    ffStrbufTrimRight(&result, '\n');
+    ffStrbufTrim(&result, ' ');
 
     if(result.length == 0)
     {
-        ffPrintError(instance, FF_PUBLICIP_MODULE_NAME, 0, &instance->config.publicIpKey, &instance->config.publicIpFormat, FF_PUBLICIP_NUM_FORMAT_ARGS, "Failed to connect to an IP detection server");
+        ffPrintError(instance, FF_PUBLICIP_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PUBLICIP].key, instance->state.modules[FF_MODULE_ID_PUBLICIP].format, FF_PUBLICIP_NUM_FORMAT_ARGS, "Failed to connect to an IP detection server");
+        ffStrbufDestroy(&result);
         return;
     }
 
-    if(instance->config.publicIpFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_PUBLICIP].format))
     {
-        ffPrintLogoAndKey(instance, FF_PUBLICIP_MODULE_NAME, 0, &instance->config.publicIpKey);
-        ffStrbufPutTo(&result, stdout);
+        ffPrintLogoAndKey(instance, FF_PUBLICIP_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PUBLICIP].key);
+        ffOutputPut(instance, &result);
     }
     else
     {
-        ffPrintFormatString(instance, FF_PUBLICIP_MODULE_NAME, 0, &instance->config.publicIpKey, &instance->config.publicIpFormat, NULL, FF_PUBLICIP_NUM_FORMAT_ARGS, (FFformatarg[]) {
+        ffPrintFormatString(instance, FF_PUBLICIP_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_PUBLICIP].key, instance->state.modules[FF_MODULE_ID_PUBLICIP].format, NULL, FF_PUBLICIP_NUM_FORMAT_ARGS, (FFformatarg[]) {
             {FF_FORMAT_ARG_TYPE_STRBUF, &result}
         });
     }
+
+    ffStrbufDestroy(&result);
 }
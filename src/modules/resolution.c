@@ -1,12 +1,11 @@
 #include "fastfetch.h"
 
 #define FF_RESOLUTION_MODULE_NAME "Resolution"
-#define FF_RESOLUTION_NUM_FORMAT_ARGS 3
 
 void ffPrintResolution(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_RESOLUTION_MODULE_NAME, 0, &instance->config.resolutionKey, &instance->config.resolutionFormat, FF_RESOLUTION_NUM_FORMAT_ARGS, "Resolution detection is not supported on Android");
+        ffPrintError(instance, FF_RESOLUTION_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_RESOLUTION].key, instance->state.modules[FF_MODULE_ID_RESOLUTION].format, FF_RESOLUTION_NUM_FORMAT_ARGS, "Resolution detection is not supported on Android");
         return;
     #endif
 
@@ -17,19 +16,19 @@ void ffPrintResolution(FFinstance* instance)
         FFResolutionResult* result = ffListGet(&dsResult->resolutions, i);
         uint8_t moduleIndex = dsResult->resolutions.length == 1 ? 0 : (uint8_t) (i + 1);
 
-        if(instance->config.resolutionFormat.length == 0)
+        if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_RESOLUTION].format))
         {
-            ffPrintLogoAndKey(instance, FF_RESOLUTION_MODULE_NAME, moduleIndex, &instance->config.resolutionKey);
-            printf("%ix%i", result->width, result->height);
+            ffPrintLogoAndKey(instance, FF_RESOLUTION_MODULE_NAME, moduleIndex, instance->state.modules[FF_MODULE_ID_RESOLUTION].key);
+            ffOutputWriteF(instance, "%ix%i", result->width, result->height);
 
             if(result->refreshRate > 0)
-                printf(" @ %iHz", result->refreshRate);
+                ffOutputWriteF(instance, " @ %iHz", result->refreshRate);
 
-            putchar('\n');
+            ffOutputWriteC(instance, '\n');
         }
         else
         {
-            ffPrintFormatString(instance, FF_RESOLUTION_MODULE_NAME, moduleIndex, &instance->config.resolutionKey, &instance->config.resolutionFormat, NULL, FF_RESOLUTION_NUM_FORMAT_ARGS, (FFformatarg[]) {
+            ffPrintFormatString(instance, FF_RESOLUTION_MODULE_NAME, moduleIndex, instance->state.modules[FF_MODULE_ID_RESOLUTION].key, instance->state.modules[FF_MODULE_ID_RESOLUTION].format, NULL, FF_RESOLUTION_NUM_FORMAT_ARGS, (FFformatarg[]) {
                 {FF_FORMAT_ARG_TYPE_INT, &result->width},
                 {FF_FORMAT_ARG_TYPE_INT, &result->height},
                 {FF_FORMAT_ARG_TYPE_INT, &result->refreshRate}
@@ -38,5 +37,5 @@ void ffPrintResolution(FFinstance* instance)
     }
 
     if(dsResult->resolutions.length == 0)
-        ffPrintError(instance, FF_RESOLUTION_MODULE_NAME, 0, &instance->config.resolutionKey, &instance->config.resolutionFormat, FF_RESOLUTION_NUM_FORMAT_ARGS, "Couldn't detect resolution");
+        ffPrintError(instance, FF_RESOLUTION_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_RESOLUTION].key, instance->state.modules[FF_MODULE_ID_RESOLUTION].format, FF_RESOLUTION_NUM_FORMAT_ARGS, "Couldn't detect resolution");
 }
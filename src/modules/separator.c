@@ -2,6 +2,9 @@
 
 void ffPrintSeparator(FFinstance* instance)
 {
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+        return;
+
     const FFTitleResult* result = ffDetectTitle(instance);
     uint32_t titleLength = result->userName.length + 1 + result->hostname.length;
 
@@ -10,17 +13,17 @@ void ffPrintSeparator(FFinstance* instance)
     if(instance->config.separatorString.length == 0)
     {
         for(uint32_t i = 0; i < titleLength; i++)
-            putchar('-');
+            ffOutputWriteC(instance, '-');
     }
     else
     {
         //Write the whole separator as often as it fits fully into titleLength
         for(uint32_t i = 0; i < titleLength / instance->config.separatorString.length; i++)
-            ffStrbufWriteTo(&instance->config.separatorString, stdout);
+            ffOutputWrite(instance, &instance->config.separatorString);
 
         //Write as much of the separator as needed to fill titleLength
         for(uint32_t i = 0; i < titleLength % instance->config.separatorString.length; i++)
-            putchar(instance->config.separatorString.chars[i]);
+            ffOutputWriteC(instance, instance->config.separatorString.chars[i]);
     }
-    putchar('\n');
+    ffOutputWriteC(instance, '\n');
 }
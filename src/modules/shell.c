@@ -4,7 +4,6 @@
 #include <ctype.h>
 
 #define FF_SHELL_MODULE_NAME "Shell"
-#define FF_SHELL_NUM_FORMAT_ARGS 7
 
 void ffPrintShell(FFinstance* instance)
 {
@@ -12,26 +11,26 @@ void ffPrintShell(FFinstance* instance)
 
     if(result->shellProcessName.length == 0)
     {
-        ffPrintError(instance, FF_SHELL_MODULE_NAME, 0, &instance->config.shellKey, &instance->config.shellFormat, FF_SHELL_NUM_FORMAT_ARGS, "Couldn't detect shell");
+        ffPrintError(instance, FF_SHELL_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_SHELL].key, instance->state.modules[FF_MODULE_ID_SHELL].format, FF_SHELL_NUM_FORMAT_ARGS, "Couldn't detect shell");
         return;
     }
 
-    if(instance->config.shellFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_SHELL].format))
     {
-        ffPrintLogoAndKey(instance, FF_SHELL_MODULE_NAME, 0, &instance->config.shellKey);
-        fputs(result->shellExeName, stdout);
+        ffPrintLogoAndKey(instance, FF_SHELL_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_SHELL].key);
+        ffOutputWriteS(instance, result->shellExeName);
 
         if(result->shellVersion.length > 0)
         {
-            putchar(' ');
-            ffStrbufWriteTo(&result->shellVersion, stdout);
+            ffOutputWriteC(instance, ' ');
+            ffOutputWrite(instance, &result->shellVersion);
         }
 
-        putchar('\n');
+        ffOutputWriteC(instance, '\n');
     }
     else
     {
-        ffPrintFormatString(instance, FF_SHELL_MODULE_NAME, 0, &instance->config.shellKey, &instance->config.shellFormat, NULL, FF_SHELL_NUM_FORMAT_ARGS, (FFformatarg[]) {
+        ffPrintFormatString(instance, FF_SHELL_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_SHELL].key, instance->state.modules[FF_MODULE_ID_SHELL].format, NULL, FF_SHELL_NUM_FORMAT_ARGS, (FFformatarg[]) {
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->shellProcessName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->shellExe},
             {FF_FORMAT_ARG_TYPE_STRING, result->shellExeName},
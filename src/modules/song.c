@@ -1,7 +1,6 @@
 #include "fastfetch.h"
 
 #define FF_SONG_MODULE_NAME "Song"
-#define FF_SONG_NUM_FORMAT_ARGS 3
 
 void ffPrintSong(FFinstance* instance)
 {
@@ -9,31 +8,31 @@ void ffPrintSong(FFinstance* instance)
 
     if(media->song.length == 0)
     {
-        ffPrintError(instance, FF_SONG_MODULE_NAME, 0, &instance->config.songKey, &instance->config.songFormat, FF_SONG_NUM_FORMAT_ARGS, "No song detected");
+        ffPrintError(instance, FF_SONG_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_SONG].key, instance->state.modules[FF_MODULE_ID_SONG].format, FF_SONG_NUM_FORMAT_ARGS, "No song detected");
         return;
     }
 
-    if(instance->config.songFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_SONG].format))
     {
-        ffPrintLogoAndKey(instance, FF_SONG_MODULE_NAME, 0, &instance->config.songKey);
+        ffPrintLogoAndKey(instance, FF_SONG_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_SONG].key);
 
         if(media->artist.length > 0)
         {
-            ffStrbufWriteTo(&media->artist, stdout);
-            fputs(" - ", stdout);
+            ffOutputWrite(instance, &media->artist);
+            ffOutputWriteS(instance, " - ");
         }
 
         if(media->album.length > 0)
         {
-            ffStrbufWriteTo(&media->album, stdout);
-            fputs(" - ", stdout);
+            ffOutputWrite(instance, &media->album);
+            ffOutputWriteS(instance, " - ");
         }
 
-        ffStrbufPutTo(&media->song, stdout);
+        ffOutputPut(instance, &media->song);
     }
     else
     {
-        ffPrintFormatString(instance, FF_SONG_MODULE_NAME, 0, &instance->config.songKey, &instance->config.songFormat, NULL, FF_SONG_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_SONG_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_SONG].key, instance->state.modules[FF_MODULE_ID_SONG].format, NULL, FF_SONG_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &media->song},
             {FF_FORMAT_ARG_TYPE_STRBUF, &media->artist},
             {FF_FORMAT_ARG_TYPE_STRBUF, &media->album}
@@ -5,7 +5,6 @@
 #include <pthread.h>
 
 #define FF_TERMINAL_MODULE_NAME "Terminal"
-#define FF_TERMINAL_NUM_FORMAT_ARGS 3
 
 void ffPrintTerminal(FFinstance* instance)
 {
@@ -13,22 +12,22 @@ void ffPrintTerminal(FFinstance* instance)
 
     if(result->terminalProcessName.length == 0)
     {
-        ffPrintError(instance, FF_TERMINAL_MODULE_NAME, 0, &instance->config.terminalKey, &instance->config.terminalFormat, FF_TERMINAL_NUM_FORMAT_ARGS, "Couldn't detect terminal");
+        ffPrintError(instance, FF_TERMINAL_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMINAL].key, instance->state.modules[FF_MODULE_ID_TERMINAL].format, FF_TERMINAL_NUM_FORMAT_ARGS, "Couldn't detect terminal");
         return;
     }
 
-    if(instance->config.terminalFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_TERMINAL].format))
     {
-        ffPrintLogoAndKey(instance, FF_TERMINAL_MODULE_NAME, 0, &instance->config.terminalKey);
+        ffPrintLogoAndKey(instance, FF_TERMINAL_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMINAL].key);
 
         if(strncmp(result->terminalExeName, result->terminalProcessName.chars, result->terminalProcessName.length) == 0) // if exeName starts with processName, print it. Otherwise print processName
-            puts(result->terminalExeName);
+            ffOutputPutS(instance, result->terminalExeName);
         else
-            ffStrbufPutTo(&result->terminalProcessName, stdout);
+            ffOutputPut(instance, &result->terminalProcessName);
     }
     else
     {
-        ffPrintFormatString(instance, FF_TERMINAL_MODULE_NAME, 0, &instance->config.terminalKey, &instance->config.terminalFormat, NULL, FF_TERMINAL_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_TERMINAL_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMINAL].key, instance->state.modules[FF_MODULE_ID_TERMINAL].format, NULL, FF_TERMINAL_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->terminalProcessName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->terminalExe},
             {FF_FORMAT_ARG_TYPE_STRING, result->terminalExeName}
@@ -1,24 +1,23 @@
 #include "fastfetch.h"
 
 #define FF_TERMFONT_MODULE_NAME "Terminal Font"
-#define FF_TERMFONT_NUM_FORMAT_ARGS 5
 
 static void printTerminalFont(FFinstance* instance, const char* raw, FFfont* font)
 {
     if(font->pretty.length == 0)
     {
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Terminal font is an empty value");
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Terminal font is an empty value");
         return;
     }
 
-    if(instance->config.termFontFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_TERMFONT].format))
     {
-        ffPrintLogoAndKey(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey);
-        ffStrbufPutTo(&font->pretty, stdout);
+        ffPrintLogoAndKey(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key);
+        ffOutputPut(instance, &font->pretty);
     }
     else
     {
-        ffPrintFormatString(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, NULL, FF_TERMFONT_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, NULL, FF_TERMFONT_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRING, raw},
             {FF_FORMAT_ARG_TYPE_STRBUF, &font->name},
             {FF_FORMAT_ARG_TYPE_STRBUF, &font->size},
@@ -55,7 +54,7 @@ static void printTerminalFontFromConfigFile(FFinstance* instance, const char* co
     ffParsePropFileConfig(instance, configFile, start, &fontName);
 
     if(fontName.length == 0)
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find terminal font in \"$XDG_CONFIG_HOME/%s\"", configFile);
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find terminal font in \"$XDG_CONFIG_HOME/%s\"", configFile);
     else
     {
         FFfont font;
@@ -72,7 +71,7 @@ static void printTerminalFontFromGSettings(FFinstance* instance, char* profilePa
     const char* defaultProfile = ffSettingsGetGSettings(instance, profileList, NULL, "default", FF_VARIANT_TYPE_STRING).strValue;
     if(defaultProfile == NULL)
     {
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't get \"default\" profile from gsettings");
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't get \"default\" profile from gsettings");
         return;
     }
 
@@ -88,13 +87,13 @@ static void printTerminalFontFromGSettings(FFinstance* instance, char* profilePa
     {
         fontName = ffSettingsGetGSettings(instance, profile, path.chars, "font", FF_VARIANT_TYPE_STRING).strValue;
         if(fontName == NULL)
-            ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't get terminal font from GSettings (%s::%s::font)", profile, path.chars);
+            ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't get terminal font from GSettings (%s::%s::font)", profile, path.chars);
     }
     else // system font
     {
         fontName = getSystemMonospaceFont(instance);
         if(fontName == NULL)
-            ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Could't get system monospace font name from GSettings / DConf");
+            ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Could't get system monospace font name from GSettings / DConf");
     }
 
     ffStrbufDestroy(&path);
@@ -116,7 +115,7 @@ static void printKonsole(FFinstance* instance)
 
     if(profile.length == 0)
     {
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find \"DefaultProfile=%[^\\n]\" in \".config/konsolerc\"");
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find \"DefaultProfile=%[^\\n]\" in \".config/konsolerc\"");
         ffStrbufDestroy(&profile);
         return;
     }
@@ -131,7 +130,7 @@ static void printKonsole(FFinstance* instance)
     ffParsePropFileHome(instance, profilePath.chars, "Font =", &fontName);
 
     if(fontName.length == 0)
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find \"Font=%%[^\\n]\" in \"%s\"", profilePath.chars);
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find \"Font=%%[^\\n]\" in \"%s\"", profilePath.chars);
     else
     {
         FFfont font;
@@ -152,7 +151,7 @@ static void printXCFETerminal(FFinstance* instance)
 
     if(!ffParsePropFileConfig(instance, "xfce4/terminal/terminalrc", "FontUseSystem =", &useSysFont))
     {
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't open \"$XDG_CONFIG_HOME/xfce4/terminal/terminalrc\"");
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't open \"$XDG_CONFIG_HOME/xfce4/terminal/terminalrc\"");
         ffStrbufDestroy(&useSysFont);
         return;
     }
@@ -169,7 +168,7 @@ static void printXCFETerminal(FFinstance* instance)
     const char* fontName = ffSettingsGetXFConf(instance, "xsettings", "/Gtk/MonospaceFontName", FF_VARIANT_TYPE_STRING).strValue;
 
     if(fontName == NULL)
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find \"xsettings::/Gtk/MonospaceFontName\" in XFConf");
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Couldn't find \"xsettings::/Gtk/MonospaceFontName\" in XFConf");
     else
     {
         FFfont font;
@@ -211,7 +210,7 @@ void ffPrintTerminalFont(FFinstance* instance)
 
     if(result->terminalProcessName.length == 0)
     {
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Terminal font needs successfull terminal detection");
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Terminal font needs successfull terminal detection");
         return;
     }
 
@@ -228,5 +227,5 @@ void ffPrintTerminalFont(FFinstance* instance)
     else if(ffStrbufStartsWithIgnCaseS(&result->terminalExe, "/dev/tty"))
         printTTY(instance);
     else
-        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, &instance->config.termFontKey, &instance->config.termFontFormat, FF_TERMFONT_NUM_FORMAT_ARGS, "Unknown terminal: %s", result->terminalProcessName.chars);
+        ffPrintError(instance, FF_TERMFONT_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_TERMFONT].key, instance->state.modules[FF_MODULE_ID_TERMFONT].format, FF_TERMFONT_NUM_FORMAT_ARGS, "Unknown terminal: %s", result->terminalProcessName.chars);
 }
@@ -1,12 +1,11 @@
 #include "fastfetch.h"
 
 #define FF_THEME_MODULE_NAME "Theme"
-#define FF_THEME_NUM_FORMAT_ARGS 7
 
 void ffPrintTheme(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_THEME_MODULE_NAME, 0, &instance->config.themeKey, &instance->config.themeFormat, FF_THEME_NUM_FORMAT_ARGS, "Theme detection is not supported on Android");
+        ffPrintError(instance, FF_THEME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_THEME].key, instance->state.modules[FF_MODULE_ID_THEME].format, FF_THEME_NUM_FORMAT_ARGS, "Theme detection is not supported on Android");
         return;
     #endif
 
@@ -14,19 +13,37 @@ void ffPrintTheme(FFinstance* instance)
 
     if(ffStrbufIgnCaseCompS(&wmde->wmProtocolName, "TTY") == 0)
     {
-        ffPrintError(instance, FF_THEME_MODULE_NAME, 0, &instance->config.fontKey, &instance->config.fontFormat, FF_THEME_NUM_FORMAT_ARGS, "Theme isn't supported in TTY");
+        ffPrintError(instance, FF_THEME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_FONT].key, instance->state.modules[FF_MODULE_ID_FONT].format, FF_THEME_NUM_FORMAT_ARGS, "Theme isn't supported in TTY");
         return;
     }
 
-    const FFPlasmaResult* plasma = ffDetectPlasma(instance);
-    const FFstrbuf* gtk2 = &ffDetectGTK2(instance)->theme;
-    const FFstrbuf* gtk3 = &ffDetectGTK3(instance)->theme;
-    const FFstrbuf* gtk4 = &ffDetectGTK4(instance)->theme;
+    //Only detect the themes the format string uses. The default output uses all of them
+    uint64_t usedArgs = instance->state.modules[FF_MODULE_ID_THEME].format == NULL ? UINT64_MAX : ffOutputGetUsedArgs(instance, instance->state.modules[FF_MODULE_ID_THEME].format);
+    uint64_t gtkPrettyArg = FF_FORMAT_ARG_MASK(7);
 
-    if(plasma->widgetStyle.length == 0 && plasma->colorScheme.length == 0 && gtk2->length == 0 && gtk3->length == 0 && gtk4->length == 0)
+    FFstrbuf empty;
+    ffStrbufInitA(&empty, 0); //Doesn't allocate, so it doesn't need to be destroyed
+    FFPlasmaResult noPlasma = { .widgetStyle = empty, .colorScheme = empty, .icons = empty, .font = empty };
+
+    const FFPlasmaResult* plasma = (usedArgs & 0x7ULL) ? ffDetectPlasma(instance) : &noPlasma;
+    const FFstrbuf* gtk2 = (usedArgs & (FF_FORMAT_ARG_MASK(4) | gtkPrettyArg)) ? &ffDetectGTK2(instance)->theme : &empty;
+    const FFstrbuf* gtk3 = (usedArgs & (FF_FORMAT_ARG_MASK(5) | gtkPrettyArg)) ? &ffDetectGTK3(instance)->theme : &empty;
+    const FFstrbuf* gtk4 = (usedArgs & (FF_FORMAT_ARG_MASK(6) | gtkPrettyArg)) ? &ffDetectGTK4(instance)->theme : &empty;
+
+    //Whether there are no themes at all depends on the skipped ones too, so detect them before printing the error.
+    //A format without any argument doesn't care, it is printed as it is
+    if(usedArgs != 0 && plasma->widgetStyle.length == 0 && plasma->colorScheme.length == 0 && gtk2->length == 0 && gtk3->length == 0 && gtk4->length == 0)
     {
-        ffPrintError(instance, FF_THEME_MODULE_NAME, 0, &instance->config.themeKey, &instance->config.themeFormat, FF_THEME_NUM_FORMAT_ARGS, "No themes found");
-        return;
+        plasma = ffDetectPlasma(instance);
+        gtk2 = &ffDetectGTK2(instance)->theme;
+        gtk3 = &ffDetectGTK3(instance)->theme;
+        gtk4 = &ffDetectGTK4(instance)->theme;
+
+        if(plasma->widgetStyle.length == 0 && plasma->colorScheme.length == 0 && gtk2->length == 0 && gtk3->length == 0 && gtk4->length == 0)
+        {
+            ffPrintError(instance, FF_THEME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_THEME].key, instance->state.modules[FF_MODULE_ID_THEME].format, FF_THEME_NUM_FORMAT_ARGS, "No themes found");
+            return;
+        }
     }
 
     FF_STRBUF_CREATE(plasmaColorPretty);
@@ -40,47 +57,47 @@ void ffPrintTheme(FFinstance* instance)
     FF_STRBUF_CREATE(gtkPretty);
     ffGetGtkPretty(&gtkPretty, gtk2, gtk3, gtk4);
 
-    if(instance->config.themeFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_THEME].format))
     {
-        ffPrintLogoAndKey(instance, FF_THEME_MODULE_NAME, 0, &instance->config.themeKey);
+        ffPrintLogoAndKey(instance, FF_THEME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_THEME].key);
 
         if(plasma->widgetStyle.length > 0)
         {
-            ffStrbufWriteTo(&plasma->widgetStyle, stdout);
+            ffOutputWrite(instance, &plasma->widgetStyle);
 
             if(plasma->colorScheme.length > 0)
             {
-                fputs(" (", stdout);
+                ffOutputWriteS(instance, " (");
 
                 if(plasmaColorPretty.length > 0)
-                    ffStrbufWriteTo(&plasmaColorPretty, stdout);
+                    ffOutputWrite(instance, &plasmaColorPretty);
                 else
-                    ffStrbufWriteTo(&plasma->colorScheme, stdout);
+                    ffOutputWrite(instance, &plasma->colorScheme);
 
-                putchar(')');
+                ffOutputWriteC(instance, ')');
             }
         }
         else if(plasma->colorScheme.length > 0)
         {
             if(plasmaColorPretty.length > 0)
-                ffStrbufWriteTo(&plasmaColorPretty, stdout);
+                ffOutputWrite(instance, &plasmaColorPretty);
             else
-                ffStrbufWriteTo(&plasma->colorScheme, stdout);
+                ffOutputWrite(instance, &plasma->colorScheme);
         }
 
         if(plasma->widgetStyle.length > 0 || plasma->colorScheme.length > 0)
         {
-            fputs(" [Plasma]", stdout);
+            ffOutputWriteS(instance, " [Plasma]");
 
             if(gtkPretty.length > 0)
-                fputs(", ", stdout);
+                ffOutputWriteS(instance, ", ");
         }
 
-        ffStrbufPutTo(&gtkPretty, stdout);
+        ffOutputPut(instance, &gtkPretty);
     }
     else
     {
-        ffPrintFormatString(instance, FF_THEME_MODULE_NAME, 0, &instance->config.themeKey, &instance->config.themeFormat, NULL, FF_THEME_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_THEME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_THEME].key, instance->state.modules[FF_MODULE_ID_THEME].format, NULL, FF_THEME_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &plasma->widgetStyle},
             {FF_FORMAT_ARG_TYPE_STRBUF, &plasma->colorScheme},
             {FF_FORMAT_ARG_TYPE_STRBUF, &plasmaColorPretty},
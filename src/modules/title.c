@@ -30,20 +30,29 @@ const FFTitleResult* ffDetectTitle(FFinstance* instance)
 
 static inline void printTitlePart(FFinstance* instance, const FFstrbuf* content)
 {
-    fputs(FASTFETCH_TEXT_MODIFIER_BOLT, stdout);
-    ffPrintColor(&instance->config.color);
-    ffStrbufWriteTo(content, stdout);
-    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stdout);
+    ffOutputWriteS(instance, FASTFETCH_TEXT_MODIFIER_BOLT);
+    ffPrintColor(instance, &instance->config.color);
+    ffOutputWrite(instance, content);
+    ffOutputWriteS(instance, FASTFETCH_TEXT_MODIFIER_RESET);
 }
 
 void ffPrintTitle(FFinstance* instance)
 {
     const FFTitleResult* result = ffDetectTitle(instance);
 
+    if(instance->config.outputFormat == FF_OUTPUT_FORMAT_JSON)
+    {
+        ffPrintJsonResult(instance, "Title", 0, 2, (FFformatarg[]){
+            {FF_FORMAT_ARG_TYPE_STRBUF, &result->userName},
+            {FF_FORMAT_ARG_TYPE_STRBUF, &result->hostname}
+        });
+        return;
+    }
+
     ffPrintLogoLine(instance);
 
     printTitlePart(instance, &result->userName);
-    putchar('@');
+    ffOutputWriteC(instance, '@');
     printTitlePart(instance, &result->hostname);
-    putchar('\n');
+    ffOutputWriteC(instance, '\n');
 }
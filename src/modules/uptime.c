@@ -1,7 +1,6 @@
 #include "fastfetch.h"
 
 #define FF_UPTIME_MODULE_NAME "Uptime"
-#define FF_UPTIME_NUM_FORMAT_ARGS 4
 
 void ffPrintUptime(FFinstance* instance)
 {
@@ -10,28 +9,43 @@ void ffPrintUptime(FFinstance* instance)
     uint32_t minutes = (uint32_t) (instance->state.sysinfo.uptime - (days * 86400) - (hours * 3600)) / 60;
     uint32_t seconds = (uint32_t)  instance->state.sysinfo.uptime - (days * 86400) - (hours * 3600) - (minutes * 60);
 
-    if(instance->config.uptimeFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_UPTIME].format))
     {
-        ffPrintLogoAndKey(instance, FF_UPTIME_MODULE_NAME, 0, &instance->config.uptimeKey);
+        ffPrintLogoAndKey(instance, FF_UPTIME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_UPTIME].key);
+
+        FFstrbuf uptime;
+        ffStrbufInitA(&uptime, 64);
 
         if(days == 0 && hours == 0 && minutes == 0)
         {
-            printf("%u seconds\n", seconds);
+            ffStrbufAppendUInt(&uptime, seconds);
+            ffStrbufAppendS(&uptime, " seconds");
         }
         else
         {
             if(days > 0)
-                printf("%u day%s, ", days, days <= 1 ? "" : "s");
+            {
+                ffStrbufAppendUInt(&uptime, days);
+                ffStrbufAppendS(&uptime, days <= 1 ? " day, " : " days, ");
+            }
             if(hours > 0)
-                printf("%u hour%s, ", hours, hours <= 1 ? "" : "s");
+            {
+                ffStrbufAppendUInt(&uptime, hours);
+                ffStrbufAppendS(&uptime, hours <= 1 ? " hour, " : " hours, ");
+            }
             if(minutes > 0)
-                printf("%u min%s", minutes, minutes <= 1 ? "" : "s");
-            putchar('\n');
+            {
+                ffStrbufAppendUInt(&uptime, minutes);
+                ffStrbufAppendS(&uptime, minutes <= 1 ? " min" : " mins");
+            }
         }
+
+        ffOutputPut(instance, &uptime);
+        ffStrbufDestroy(&uptime);
     }
     else
     {
-        ffPrintFormatString(instance, FF_UPTIME_MODULE_NAME, 0, &instance->config.uptimeKey, &instance->config.uptimeFormat, NULL, FF_UPTIME_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_UPTIME_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_UPTIME].key, instance->state.modules[FF_MODULE_ID_UPTIME].format, NULL, FF_UPTIME_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_UINT, &days},
             {FF_FORMAT_ARG_TYPE_UINT, &hours},
             {FF_FORMAT_ARG_TYPE_UINT, &minutes},
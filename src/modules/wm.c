@@ -1,12 +1,11 @@
 #include "fastfetch.h"
 
 #define FF_WM_MODULE_NAME "WM"
-#define FF_WM_NUM_FORMAT_ARGS 3
 
 void ffPrintWM(FFinstance* instance)
 {
     #ifdef __ANDROID__
-        ffPrintError(instance, FF_WM_MODULE_NAME, 0, &instance->config.wmKey, &instance->config.wmFormat, FF_WM_NUM_FORMAT_ARGS, "WM detection is not supported on Android");
+        ffPrintError(instance, FF_WM_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_WM].key, instance->state.modules[FF_MODULE_ID_WM].format, FF_WM_NUM_FORMAT_ARGS, "WM detection is not supported on Android");
         return;
     #endif
 
@@ -14,28 +13,28 @@ void ffPrintWM(FFinstance* instance)
 
     if(result->wmPrettyName.length == 0)
     {
-        ffPrintError(instance, FF_WM_MODULE_NAME, 0, &instance->config.wmKey, &instance->config.wmFormat, FF_WM_NUM_FORMAT_ARGS, "No WM found");
+        ffPrintError(instance, FF_WM_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_WM].key, instance->state.modules[FF_MODULE_ID_WM].format, FF_WM_NUM_FORMAT_ARGS, "No WM found");
         return;
     }
 
-    if(instance->config.wmFormat.length == 0)
+    if(ffOutputIsDefault(instance, instance->state.modules[FF_MODULE_ID_WM].format))
     {
-        ffPrintLogoAndKey(instance, FF_WM_MODULE_NAME, 0, &instance->config.wmKey);
+        ffPrintLogoAndKey(instance, FF_WM_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_WM].key);
 
-        ffStrbufWriteTo(&result->wmPrettyName, stdout);
+        ffOutputWrite(instance, &result->wmPrettyName);
 
         if(result->wmProtocolName.length > 0)
         {
-            fputs(" (", stdout);
-            ffStrbufWriteTo(&result->wmProtocolName, stdout);
-            putchar(')');
+            ffOutputWriteS(instance, " (");
+            ffOutputWrite(instance, &result->wmProtocolName);
+            ffOutputWriteC(instance, ')');
         }
 
-        putchar('\n');
+        ffOutputWriteC(instance, '\n');
     }
     else
     {
-        ffPrintFormatString(instance, FF_WM_MODULE_NAME, 0, &instance->config.wmKey, &instance->config.wmFormat, NULL, FF_WM_NUM_FORMAT_ARGS, (FFformatarg[]){
+        ffPrintFormatString(instance, FF_WM_MODULE_NAME, 0, instance->state.modules[FF_MODULE_ID_WM].key, instance->state.modules[FF_MODULE_ID_WM].format, NULL, FF_WM_NUM_FORMAT_ARGS, (FFformatarg[]){
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->wmProcessName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->wmPrettyName},
             {FF_FORMAT_ARG_TYPE_STRBUF, &result->wmProtocolName}
@@ -0,0 +1,105 @@
+#include "options/list.h"
+#include "modules/list.h"
+#include "util/FFperfecthash.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+//Builds the perfect hash table of the option names in options/list.h and the module options of modules/list.h.
+//Runs at build time, the output is included by fastfetch.c
+
+#define FF_OPTION(name, type, target, field) name,
+static const char* optionNames[] = { FF_OPTION_LIST };
+#undef FF_OPTION
+
+#define FF_MODULE(id, name, alias, option, print, detectors, cache, numFormatArgs) option,
+static const char* moduleOptions[] = { FF_MODULE_LIST };
+#undef FF_MODULE
+
+#define FF_OPTION_NAMES_LENGTH ((uint32_t) (sizeof(optionNames) / sizeof(optionNames[0])))
+#define FF_MODULE_OPTIONS_LENGTH ((uint32_t) (sizeof(moduleOptions) / sizeof(moduleOptions[0])))
+
+//Every module has a format and a key option
+#define FF_OPTION_COUNT (FF_OPTION_NAMES_LENGTH + FF_MODULE_OPTIONS_LENGTH * 2)
+
+static char* createModuleOption(const char* prefix, const char* suffix)
+{
+    size_t size = strlen(prefix) + strlen(suffix) + 4;
+    char* name = malloc(size);
+    snprintf(name, size, "--%s-%s", prefix, suffix);
+    return name;
+}
+
+int main(int argc, char** argv)
+{
+    if(argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+        return 1;
+    }
+
+    //Option i is at index i in the options table of fastfetch.c, the ones of module i at FF_OPTION_NAMES_LENGTH + i * 2 and the one after it
+    const char* names[FF_OPTION_COUNT];
+    uint32_t indices[FF_OPTION_COUNT];
+    uint32_t numNames = 0;
+
+    for(uint32_t i = 0; i < FF_OPTION_NAMES_LENGTH; ++i)
+    {
+        names[numNames] = optionNames[i];
+        indices[numNames++] = i;
+    }
+
+    for(uint32_t i = 0; i < FF_MODULE_OPTIONS_LENGTH; ++i)
+    {
+        if(moduleOptions[i] == NULL)
+            continue;
+
+        names[numNames] = createModuleOption(moduleOptions[i], "format");
+        indices[numNames++] = FF_OPTION_NAMES_LENGTH + i * 2;
+
+        names[numNames] = createModuleOption(moduleOptions[i], "key");
+        indices[numNames++] = FF_OPTION_NAMES_LENGTH + i * 2 + 1;
+    }
+
+    for(uint32_t i = 0; i < numNames; ++i)
+    {
+        for(uint32_t k = 0; k < i; ++k)
+        {
+            if(strcasecmp(names[i], names[k]) == 0)
+            {
+                fprintf(stderr, "Error: option \"%s\" is defined more than once\n", names[i]);
+                return 1;
+            }
+        }
+    }
+
+    FILE* file = fopen(argv[1], "w");
+    if(file == NULL)
+    {
+        fprintf(stderr, "Error: failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    fputs("//Generated by fastfetch-optiongen from src/options/list.h and src/modules/list.h, do not edit\n\n", file);
+    fprintf(file, "#define FF_OPTION_COUNT %u\n", FF_OPTION_COUNT);
+
+    if(!ffPerfectHashWrite(file, "FF_OPTION", "option", names, indices, numNames))
+    {
+        fputs("Error: failed to build the option name table\n", stderr);
+        fclose(file);
+        remove(argv[1]);
+        return 1;
+    }
+
+    if(fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    for(uint32_t i = FF_OPTION_NAMES_LENGTH; i < numNames; ++i)
+        free((char*) names[i]);
+
+    return 0;
+}
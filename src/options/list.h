@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef FASTFETCH_INCLUDED_OPTIONS_LIST
+#define FASTFETCH_INCLUDED_OPTIONS_LIST
+
+//Every command line and config file option.
+//FF_OPTION(name, type, target, field): target is CONFIG (FFconfig), DATA (FFdata of fastfetch.c) or NONE.
+//The option generator builds a perfect hash table of the names at build time, fastfetch.c the handlers.
+//The --<prefix>-format and --<prefix>-key options of the modules are added from modules/list.h.
+//Add new options at the end, the order doesn't matter otherwise.
+
+#define FF_OPTION_LIST \
+    FF_OPTION("-h", HELP, NONE, ) \
+    FF_OPTION("--help", HELP, NONE, ) \
+    FF_OPTION("-v", VERSION, NONE, ) \
+    FF_OPTION("--version", VERSION, NONE, ) \
+    FF_OPTION("--list-logos", LIST_LOGOS, NONE, ) \
+    FF_OPTION("--list-logos-autocompletion", LIST_LOGOS_AUTOCOMPLETION, NONE, ) \
+    FF_OPTION("--print-logos", PRINT_LOGOS, NONE, ) \
+    FF_OPTION("--print-config", PRINT_CONFIG, NONE, ) \
+    FF_OPTION("--print-structure", PRINT_STRUCTURE, NONE, ) \
+    FF_OPTION("--list-modules", LIST_MODULES, NONE, ) \
+    FF_OPTION("--list-presets", LIST_PRESETS, NONE, ) \
+    FF_OPTION("--list-features", LIST_FEATURES, NONE, ) \
+    FF_OPTION("--spacing", SPACING, CONFIG, logoKeySpacing) \
+    FF_OPTION("-x", OFFSETX, CONFIG, offsetx) \
+    FF_OPTION("--offsetx", OFFSETX, CONFIG, offsetx) \
+    FF_OPTION("--set", SET, DATA, valuestore) \
+    FF_OPTION("-r", RECACHE, NONE, ) \
+    FF_OPTION("--recache", RECACHE, NONE, ) \
+    FF_OPTION("--nocache", NOCACHE, NONE, ) \
+    FF_OPTION("--load-config", LOAD_CONFIG, NONE, ) \
+    FF_OPTION("--show-errors", BOOL, CONFIG, showErrors) \
+    FF_OPTION("--color-logo", BOOL, CONFIG, colorLogo) \
+    FF_OPTION("--print-remaining-logo", BOOL, CONFIG, printRemainingLogo) \
+    FF_OPTION("--multithreading", BOOL, CONFIG, multithreading) \
+    FF_OPTION("--sampling-window", TIMEOUT, CONFIG, samplingWindow) \
+    FF_OPTION("--allow-slow-operations", BOOL, CONFIG, allowSlowOperations) \
+    FF_OPTION("--disable-linewrap", BOOL, CONFIG, disableLinewrap) \
+    FF_OPTION("--hide-cursor", BOOL, CONFIG, hideCursor) \
+    FF_OPTION("--logo-raw", BOOL, CONFIG, userLogoIsRaw) \
+    FF_OPTION("--format", OUTPUT_FORMAT, CONFIG, outputFormat) \
+    FF_OPTION("--structure", STRING, DATA, structure) \
+    FF_OPTION("-l", STRING, DATA, logoName) \
+    FF_OPTION("--logo", STRING, DATA, logoName) \
+    FF_OPTION("-s", STRING, CONFIG, separator) \
+    FF_OPTION("--separator", STRING, CONFIG, separator) \
+    FF_OPTION("-c", COLOR, CONFIG, color) \
+    FF_OPTION("--color", COLOR, CONFIG, color) \
+    FF_OPTION("--lib-PCI", STRING, CONFIG, libPCI) \
+    FF_OPTION("--lib-vulkan", STRING, CONFIG, libVulkan) \
+    FF_OPTION("--lib-wayland", STRING, CONFIG, libWayland) \
+    FF_OPTION("--lib-xcb-randr", STRING, CONFIG, libXcbRandr) \
+    FF_OPTION("--lib-xcb", STRING, CONFIG, libXcb) \
+    FF_OPTION("--lib-Xrandr", STRING, CONFIG, libXrandr) \
+    FF_OPTION("--lib-X11", STRING, CONFIG, libX11) \
+    FF_OPTION("--lib-gio", STRING, CONFIG, libGIO) \
+    FF_OPTION("--lib-DConf", STRING, CONFIG, libDConf) \
+    FF_OPTION("--lib-dbus", STRING, CONFIG, libDBus) \
+    FF_OPTION("--lib-XFConf", STRING, CONFIG, libXFConf) \
+    FF_OPTION("--lib-rpm", STRING, CONFIG, librpm) \
+    FF_OPTION("--lib-sqlite3", STRING, CONFIG, libSQLite3) \
+    FF_OPTION("--disk-folders", STRING, CONFIG, diskFolders) \
+    FF_OPTION("--disk-show-all", BOOL, CONFIG, diskShowAll) \
+    FF_OPTION("--battery-dir", STRING, CONFIG, batteryDir) \
+    FF_OPTION("--separator-string", STRING, CONFIG, separatorString) \
+    FF_OPTION("--localip-show-ipv4", BOOL, CONFIG, localIpShowIpV4) \
+    FF_OPTION("--localip-show-ipv6", BOOL, CONFIG, localIpShowIpV6) \
+    FF_OPTION("--localip-show-loop", BOOL, CONFIG, localIpShowLoop) \
+    FF_OPTION("--os-file", STRING, CONFIG, osFile) \
+    FF_OPTION("--player-name", STRING, CONFIG, playerName) \
+    FF_OPTION("--public-ip-timeout", TIMEOUT, CONFIG, modules[FF_MODULE_ID_PUBLICIP].timeout) \
+    FF_OPTION("--public-ip-urls", STRING, CONFIG, publicIpUrls) \
+    FF_OPTION("--packages-timeout", TIMEOUT, CONFIG, modules[FF_MODULE_ID_PACKAGES].timeout) \
+    FF_OPTION("--disk-timeout", TIMEOUT, CONFIG, modules[FF_MODULE_ID_DISK].timeout)
+
+#endif
@@ -0,0 +1,125 @@
+#include "FFarena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define FF_ARENA_CHUNK_SIZE (64 * 1024)
+#define FF_ARENA_ALIGNMENT _Alignof(max_align_t)
+
+typedef struct FFarenaChunk
+{
+    struct FFarenaChunk* next;
+    size_t used;
+    size_t capacity;
+    _Alignas(max_align_t) char data[];
+} FFarenaChunk;
+
+static bool enabled = false;
+
+//All chunks of all threads, so they can be freed at once
+static pthread_mutex_t chunksMutex = PTHREAD_MUTEX_INITIALIZER;
+static FFarenaChunk* chunks = NULL;
+
+static __thread FFarenaChunk* currentChunk = NULL;
+
+void ffArenaEnable()
+{
+    enabled = true;
+}
+
+bool ffArenaIsEnabled()
+{
+    return enabled;
+}
+
+static inline size_t alignSize(size_t size)
+{
+    return (size + FF_ARENA_ALIGNMENT - 1) & ~(FF_ARENA_ALIGNMENT - 1);
+}
+
+static FFarenaChunk* newChunk(size_t capacity)
+{
+    FFarenaChunk* chunk = malloc(sizeof(FFarenaChunk) + capacity);
+    chunk->used = 0;
+    chunk->capacity = capacity;
+
+    pthread_mutex_lock(&chunksMutex);
+    chunk->next = chunks;
+    chunks = chunk;
+    pthread_mutex_unlock(&chunksMutex);
+
+    return chunk;
+}
+
+void* ffArenaAlloc(size_t size)
+{
+    size = alignSize(size);
+
+    //Big allocations get a chunk of their own, so they don't waste the rest of the current one
+    if(size > FF_ARENA_CHUNK_SIZE / 4)
+    {
+        FFarenaChunk* chunk = newChunk(size);
+        chunk->used = size;
+        return chunk->data;
+    }
+
+    if(currentChunk == NULL || currentChunk->capacity - currentChunk->used < size)
+        currentChunk = newChunk(FF_ARENA_CHUNK_SIZE);
+
+    void* result = currentChunk->data + currentChunk->used;
+    currentChunk->used += size;
+    return result;
+}
+
+//True if ptr is the newest allocation of the current chunk of this thread
+static inline bool isNewest(const char* ptr, size_t size)
+{
+    return
+        currentChunk != NULL &&
+        ptr >= currentChunk->data &&
+        ptr + alignSize(size) == currentChunk->data + currentChunk->used;
+}
+
+void* ffArenaRealloc(void* ptr, size_t oldSize, size_t newSize)
+{
+    if(ptr == NULL)
+        return ffArenaAlloc(newSize);
+
+    if(isNewest(ptr, oldSize))
+    {
+        size_t start = (size_t) ((char*) ptr - currentChunk->data);
+        if(alignSize(newSize) <= currentChunk->capacity - start)
+        {
+            currentChunk->used = start + alignSize(newSize);
+            return ptr;
+        }
+    }
+
+    void* result = ffArenaAlloc(newSize);
+    memcpy(result, ptr, oldSize < newSize ? oldSize : newSize);
+    return result;
+}
+
+void ffArenaFree(void* ptr, size_t size)
+{
+    if(ptr != NULL && isNewest(ptr, size))
+        currentChunk->used -= alignSize(size);
+}
+
+void ffArenaDestroy()
+{
+    pthread_mutex_lock(&chunksMutex);
+
+    while(chunks != NULL)
+    {
+        FFarenaChunk* next = chunks->next;
+        free(chunks);
+        chunks = next;
+    }
+
+    currentChunk = NULL;
+
+    pthread_mutex_unlock(&chunksMutex);
+}
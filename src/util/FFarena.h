@@ -0,0 +1,21 @@
+#pragma once
+
+#ifndef FASTFETCH_INCLUDED_FFARENA
+#define FASTFETCH_INCLUDED_FFARENA
+
+#include <stddef.h>
+#include <stdbool.h>
+
+//Bump allocator for memory that lives as long as the run.
+//Every thread allocates from its own chunk, so no locking is needed. Nothing is freed on its own, ffArenaDestroy frees all chunks at once.
+
+void ffArenaEnable(); //From now on FFstrbuf and FFlist allocate from the arena. Call it before any thread is started, it can't be undone
+bool ffArenaIsEnabled();
+
+void* ffArenaAlloc(size_t size);
+void* ffArenaRealloc(void* ptr, size_t oldSize, size_t newSize); //ptr may be NULL. Grows in place if ptr is the newest allocation of this thread
+void ffArenaFree(void* ptr, size_t size); //Only gives the memory back if ptr is the newest allocation of this thread
+
+void ffArenaDestroy(); //No other thread may use the arena anymore
+
+#endif
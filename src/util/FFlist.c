@@ -1,36 +1,63 @@
 #include "FFlist.h"
+#include "FFarena.h"
 
 #include <malloc.h>
 #include <memory.h>
 
 void ffListInit(FFlist* list, uint32_t elementSize)
 {
-    ffListInitA(list, elementSize, FF_LIST_DEFAULT_ALLOC);
+    list->elementSize = elementSize;
+    list->capacity = FF_LIST_INLINE_SIZE / elementSize;
+    list->length = 0;
+    list->data = NULL;
 }
 
 void ffListInitA(FFlist* list, uint32_t elementSize, uint32_t capacity)
 {
-    list->elementSize = elementSize;
+    ffListInit(list, elementSize);
+
+    if(capacity <= list->capacity)
+        return;
+
     list->capacity = capacity;
-    list->length = 0;
-    list->data = malloc(list->capacity * list->elementSize);
+    list->data = ffArenaIsEnabled() ? ffArenaAlloc(list->capacity * list->elementSize) : malloc(list->capacity * list->elementSize);
+}
+
+void* ffListData(const FFlist* list)
+{
+    return list->data != NULL ? list->data : (char*) list->inlineData;
 }
 
 void* ffListGet(const FFlist* list, uint32_t index)
 {
-    return list->data + (index * list->elementSize);
+    return (char*) ffListData(list) + (index * list->elementSize);
 }
 
-void* ffListAdd(FFlist* list)
+static void grow(FFlist* list)
 {
-    if(list->length == list->capacity)
+    uint32_t oldSize = list->capacity * list->elementSize;
+    list->capacity = list->capacity == 0 ? FF_LIST_DEFAULT_ALLOC : list->capacity * 2;
+    uint32_t newSize = list->capacity * list->elementSize;
+
+    if(list->data == NULL)
     {
-        list->capacity = list->capacity * 2 * list->elementSize;
-        list->data = realloc(list->data, list->capacity);
+        //Move the inline elements to the first allocation
+        char* data = ffArenaIsEnabled() ? ffArenaAlloc(newSize) : malloc(newSize);
+        memcpy(data, list->inlineData, oldSize);
+        list->data = data;
     }
-    void* adress = list->data + (list->length * list->elementSize);
-    ++list->length;
-    return adress;
+    else if(ffArenaIsEnabled())
+        list->data = ffArenaRealloc(list->data, oldSize, newSize);
+    else
+        list->data = realloc(list->data, newSize);
+}
+
+void* ffListAdd(FFlist* list)
+{
+    if(list->length == list->capacity)
+        grow(list);
+
+    return ffListGet(list, list->length++);
 }
 
 uint32_t ffListFirstIndexComp(const FFlist* list, void* compElement, bool(*compFunc)(const void*, const void*))
@@ -46,5 +73,13 @@ uint32_t ffListFirstIndexComp(const FFlist* list, void* compElement, bool(*compF
 
 void ffListDestroy(FFlist* list)
 {
-    free(list->data);
+    if(list->data != NULL)
+    {
+        if(ffArenaIsEnabled())
+            ffArenaFree(list->data, list->capacity * list->elementSize);
+        else
+            free(list->data);
+    }
+
+    ffListInit(list, list->elementSize);
 }
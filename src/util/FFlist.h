@@ -5,20 +5,24 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
 
-#define FF_LIST_DEFAULT_ALLOC 16
+#define FF_LIST_INLINE_SIZE 64 //Bytes stored in the list itself, before anything is allocated
+#define FF_LIST_DEFAULT_ALLOC 4 //Elements of the first allocation, if they don't fit inline
 
 typedef struct FFlist
 {
-    char* data;
+    char* data; //NULL while the elements are stored in inlineData
     uint32_t elementSize;
     uint32_t length;
-    uint32_t capacity;
+    uint32_t capacity; //In elements
+    _Alignas(max_align_t) char inlineData[FF_LIST_INLINE_SIZE];
 } FFlist;
 
-void ffListInit(FFlist* list, uint32_t elementSize);
+void ffListInit(FFlist* list, uint32_t elementSize); //Allocates nothing, until the elements don't fit inline anymore
 void ffListInitA(FFlist* list, uint32_t elementSize, uint32_t capacity);
 
+void* ffListData(const FFlist* list);
 void* ffListGet(const FFlist* list, uint32_t index);
 
 void* ffListAdd(FFlist* list);
@@ -27,4 +31,10 @@ uint32_t ffListFirstIndexComp(const FFlist* list, void* compElement, bool(*compF
 
 void ffListDestroy(FFlist* list);
 
+//Typed access. Pointers into the list are invalidated by ffListAdd, and by moving the list itself
+#define FF_LIST_GET(type, list, index) ((type*) ffListGet((list), (index)))
+#define FF_LIST_ADD(type, list) ((type*) ffListAdd(list))
+#define FF_LIST_FOR_EACH(type, itemVarName, list) \
+    for(type* itemVarName = (type*) ffListData(list); itemVarName < (type*) ffListData(list) + (list)->length; ++itemVarName)
+
 #endif
@@ -0,0 +1,152 @@
+#include "FFperfecthash.h"
+
+#include <stdlib.h>
+#include <ctype.h>
+
+uint32_t ffPerfectHashName(const char* name, uint32_t seed)
+{
+    //FNV-1a over the lower case name, followed by a finalizer so that the lower bits depend on every char
+    uint32_t hash = 2166136261u ^ seed;
+
+    for(; *name != '\0'; ++name)
+    {
+        uint8_t c = (uint8_t) *name;
+        if(c >= 'A' && c <= 'Z')
+            c = (uint8_t) (c + ('a' - 'A'));
+
+        hash ^= c;
+        hash *= 16777619u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352Du;
+    hash ^= hash >> 15;
+    return hash;
+}
+
+uint32_t ffPerfectHashGetTableSize(uint32_t numNames)
+{
+    uint32_t size = 1;
+    while(size < numNames)
+        size *= 2;
+    return size;
+}
+
+//Hash and displace: every bucket of the first level hash gets a seed for the second level hash, that maps all its names to free slots
+bool ffPerfectHashBuild(const char* const* names, uint32_t numNames, uint32_t tableSize, uint32_t* displacements, int32_t* slots)
+{
+    uint32_t* buckets = malloc(sizeof(uint32_t) * numNames);
+    uint32_t* bucketSizes = calloc(tableSize, sizeof(uint32_t));
+
+    for(uint32_t i = 0; i < tableSize; ++i)
+    {
+        displacements[i] = 0;
+        slots[i] = -1;
+    }
+
+    for(uint32_t i = 0; i < numNames; ++i)
+    {
+        buckets[i] = ffPerfectHashName(names[i], 0) & (tableSize - 1);
+        ++bucketSizes[buckets[i]];
+    }
+
+    uint32_t* bucketSlots = malloc(sizeof(uint32_t) * numNames);
+    bool result = true;
+
+    //Place the biggest buckets first, while there are many free slots
+    for(uint32_t size = numNames; size > 0 && result; --size)
+    {
+        for(uint32_t bucket = 0; bucket < tableSize; ++bucket)
+        {
+            if(bucketSizes[bucket] != size)
+                continue;
+
+            uint32_t seed = 1;
+            for(; seed < 1000000; ++seed)
+            {
+                uint32_t placed = 0;
+
+                for(uint32_t i = 0; i < numNames; ++i)
+                {
+                    if(buckets[i] != bucket)
+                        continue;
+
+                    uint32_t slot = ffPerfectHashName(names[i], seed) & (tableSize - 1);
+                    if(slots[slot] != -1)
+                        break;
+
+                    bool taken = false;
+                    for(uint32_t k = 0; k < placed; ++k)
+                        taken |= bucketSlots[k] == slot;
+                    if(taken)
+                        break;
+
+                    bucketSlots[placed++] = slot;
+                }
+
+                if(placed == size)
+                    break;
+            }
+
+            if(seed == 1000000)
+            {
+                result = false;
+                break;
+            }
+
+            displacements[bucket] = seed;
+            for(uint32_t i = 0; i < numNames; ++i)
+            {
+                if(buckets[i] == bucket)
+                    slots[ffPerfectHashName(names[i], seed) & (tableSize - 1)] = (int32_t) i;
+            }
+        }
+    }
+
+    free(bucketSlots);
+    free(bucketSizes);
+    free(buckets);
+    return result;
+}
+
+bool ffPerfectHashWrite(FILE* file, const char* macroPrefix, const char* prefix, const char* const* names, const uint32_t* values, uint32_t numNames)
+{
+    uint32_t tableSize = ffPerfectHashGetTableSize(numNames);
+    uint32_t* displacements = malloc(sizeof(uint32_t) * tableSize);
+    int32_t* slots = malloc(sizeof(int32_t) * tableSize);
+
+    if(!ffPerfectHashBuild(names, numNames, tableSize, displacements, slots))
+    {
+        free(slots);
+        free(displacements);
+        return false;
+    }
+
+    fprintf(file, "#define %s_NAME_TABLE_SIZE %u\n\n", macroPrefix, tableSize);
+
+    fprintf(file, "static const uint32_t %sNameDisplacements[%s_NAME_TABLE_SIZE] = {\n", prefix, macroPrefix);
+    for(uint32_t i = 0; i < tableSize; ++i)
+        fprintf(file, "    %u,\n", displacements[i]);
+    fputs("};\n\n", file);
+
+    //Names are stored lower case, like the hash sees them
+    fprintf(file, "static const struct { const char* name; uint32_t value; } %sNameTable[%s_NAME_TABLE_SIZE] = {\n", prefix, macroPrefix);
+    for(uint32_t i = 0; i < tableSize; ++i)
+    {
+        if(slots[i] == -1)
+        {
+            fputs("    {NULL, 0},\n", file);
+            continue;
+        }
+
+        fputs("    {\"", file);
+        for(const char* c = names[slots[i]]; *c != '\0'; ++c)
+            fputc(tolower((unsigned char) *c), file);
+        fprintf(file, "\", %u},\n", values[slots[i]]);
+    }
+    fputs("};\n", file);
+
+    free(slots);
+    free(displacements);
+    return true;
+}
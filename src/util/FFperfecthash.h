@@ -0,0 +1,29 @@
+#pragma once
+
+#ifndef FASTFETCH_INCLUDED_FFPERFECTHASH
+#define FASTFETCH_INCLUDED_FFPERFECTHASH
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+//Case insensitive hash and displace tables for names known at build time.
+//The generators build them with ffPerfectHashBuild, fastfetch only calls ffPerfectHashGetSlot.
+
+uint32_t ffPerfectHashName(const char* name, uint32_t seed); //Case insensitive
+uint32_t ffPerfectHashGetTableSize(uint32_t numNames); //Power of two >= numNames
+
+//Fills displacements (one seed per bucket) and slots (index into names, or -1) of tableSize entries. Returns false if no seeds were found
+bool ffPerfectHashBuild(const char* const* names, uint32_t numNames, uint32_t tableSize, uint32_t* displacements, int32_t* slots);
+
+//Builds the table and writes it as C code: <macroPrefix>_NAME_TABLE_SIZE, <prefix>NameDisplacements and <prefix>NameTable, whose entries are {lower case name, values[i]}
+bool ffPerfectHashWrite(FILE* file, const char* macroPrefix, const char* prefix, const char* const* names, const uint32_t* values, uint32_t numNames);
+
+//The only slot the name can be in. The caller must still compare the name stored there
+static inline uint32_t ffPerfectHashGetSlot(const char* name, const uint32_t* displacements, uint32_t tableSize)
+{
+    uint32_t displacement = displacements[ffPerfectHashName(name, 0) & (tableSize - 1)];
+    return ffPerfectHashName(name, displacement) & (tableSize - 1);
+}
+
+#endif
@@ -1,15 +1,28 @@
+#define _GNU_SOURCE //memmem and memrchr
+
 #include "FFstrbuf.h"
+#include "FFarena.h"
 
 #include <malloc.h>
 #include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
+
+//Shared by all buffers that have nothing allocated yet, in every thread. It is read only, so nothing may be written to a buffer without allocation
+static const char CHAR_NULL_PTR[1] = "";
 
-static char* CHAR_NULL_PTR = "";
+static inline void terminate(FFstrbuf* strbuf)
+{
+    //An unallocated buffer is empty and its string is already terminated
+    if(strbuf->allocated > 0)
+        strbuf->chars[strbuf->length] = '\0';
+}
 
 void ffStrbufInit(FFstrbuf* strbuf)
 {
-    ffStrbufInitA(strbuf, FASTFETCH_STRBUF_DEFAULT_ALLOC);
+    //Most buffers stay empty or are only set once, so nothing is allocated until the first write
+    ffStrbufInitA(strbuf, 0);
 }
 
 void ffStrbufInitA(FFstrbuf* strbuf, uint32_t allocate)
@@ -17,7 +30,7 @@ void ffStrbufInitA(FFstrbuf* strbuf, uint32_t allocate)
     strbuf->allocated = allocate;
 
     if(strbuf->allocated > 0)
-        strbuf->chars = (char*) malloc(sizeof(char) * strbuf->allocated);
+        strbuf->chars = ffArenaIsEnabled() ? ffArenaAlloc(strbuf->allocated) : malloc(sizeof(char) * strbuf->allocated);
 
     //This will set the length to zero and the null byte.
     ffStrbufClear(strbuf);
@@ -31,7 +44,13 @@ void ffStrbufInitCopy(FFstrbuf* strbuf, const FFstrbuf* src)
 
 static void setCapacity(FFstrbuf* strbuf, uint32_t capacity)
 {
-    if(strbuf->allocated == 0)
+    if(ffArenaIsEnabled())
+    {
+        strbuf->chars = ffArenaRealloc(strbuf->allocated == 0 ? NULL : strbuf->chars, strbuf->allocated, capacity);
+        if(strbuf->allocated == 0)
+            strbuf->chars[0] = '\0';
+    }
+    else if(strbuf->allocated == 0)
     {
         strbuf->chars = malloc(sizeof(*strbuf->chars) * capacity);
         strbuf->chars[0] = '\0';
@@ -61,9 +80,10 @@ void ffStrbufEnsureFree(FFstrbuf* strbuf, uint32_t free)
     if(ffStrbufGetFree(strbuf) >= free)
         return;
 
+    //The first allocation of a buffer gets the default size, so appending single chars doesn't realloc every time
     uint32_t allocate = strbuf->allocated;
-    if(allocate < 2)
-        allocate = 2;
+    if(allocate < FASTFETCH_STRBUF_DEFAULT_ALLOC)
+        allocate = FASTFETCH_STRBUF_DEFAULT_ALLOC;
 
     while((strbuf->length + free + 1) > allocate) // + 1 for the null byte
         allocate *= 2;
@@ -82,7 +102,7 @@ uint32_t ffStrbufGetFree(const FFstrbuf* strbuf)
 void ffStrbufClear(FFstrbuf* strbuf)
 {
     if(strbuf->allocated == 0)
-        strbuf->chars = CHAR_NULL_PTR;
+        strbuf->chars = (char*) CHAR_NULL_PTR;
     else
         strbuf->chars[0] = '\0';
 
@@ -105,7 +125,7 @@ void ffStrbufAppendC(FFstrbuf* strbuf, char c)
 {
     ffStrbufEnsureFree(strbuf, 1);
     strbuf->chars[strbuf->length++] = c;
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufAppendS(FFstrbuf* strbuf, const char* value)
@@ -120,7 +140,7 @@ void ffStrbufAppendS(FFstrbuf* strbuf, const char* value)
         strbuf->chars[strbuf->length++] = value[i];
     }
 
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufAppendNS(FFstrbuf* strbuf, uint32_t length, const char* value)
@@ -128,17 +148,14 @@ void ffStrbufAppendNS(FFstrbuf* strbuf, uint32_t length, const char* value)
     if(value == NULL)
         return;
 
-    ffStrbufEnsureFree(strbuf, length);
-
-    for(uint32_t i = 0; i < length; i++)
-    {
-        if(value[i] == '\0')
-            break;
+    //Stops at the first '\0', like the other string appends
+    length = (uint32_t) strnlen(value, length);
 
-        strbuf->chars[strbuf->length++] = value[i];
-    }
+    ffStrbufEnsureFree(strbuf, length);
+    memcpy(strbuf->chars + strbuf->length, value, length);
+    strbuf->length += length;
 
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufAppendNSExludingC(FFstrbuf* strbuf, uint32_t length, const char* value, char exclude)
@@ -154,7 +171,7 @@ void ffStrbufAppendNSExludingC(FFstrbuf* strbuf, uint32_t length, const char* va
         strbuf->chars[strbuf->length++] = value[i];
     }
 
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufAppendTransformS(FFstrbuf* strbuf, const char* value, int(*transformFunc)(int))
@@ -168,7 +185,7 @@ void ffStrbufAppendTransformS(FFstrbuf* strbuf, const char* value, int(*transfor
             ffStrbufEnsureFree(strbuf, 16);
         strbuf->chars[strbuf->length++] = (char) transformFunc(value[i]);
     }
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufAppendVF(FFstrbuf* strbuf, const char* format, va_list arguments)
@@ -179,13 +196,14 @@ void ffStrbufAppendVF(FFstrbuf* strbuf, const char* format, va_list arguments)
     va_list copy;
     va_copy(copy, arguments);
 
+    //The null byte fits into the allocated memory as well. Without any, chars is a static empty string, so nothing may be written
     uint32_t free = ffStrbufGetFree(strbuf);
-    uint32_t written = (uint32_t) vsnprintf(strbuf->chars + strbuf->length, free, format, arguments);
+    uint32_t written = (uint32_t) vsnprintf(strbuf->chars + strbuf->length, strbuf->allocated > 0 ? free + 1 : 0, format, arguments);
 
-    if(strbuf->length + written > free)
+    if(written > free)
     {
         ffStrbufEnsureFree(strbuf, written);
-        written = (uint32_t) vsnprintf(strbuf->chars + strbuf->length, ffStrbufGetFree(strbuf), format, copy);
+        written = (uint32_t) vsnprintf(strbuf->chars + strbuf->length, ffStrbufGetFree(strbuf) + 1, format, copy);
     }
 
     va_end(copy);
@@ -194,7 +212,7 @@ void ffStrbufAppendVF(FFstrbuf* strbuf, const char* format, va_list arguments)
         return;
 
     strbuf->length += written;
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufAppendF(FFstrbuf* strbuf, const char* format, ...)
@@ -208,6 +226,426 @@ void ffStrbufAppendF(FFstrbuf* strbuf, const char* format, ...)
     va_end(arguments);
 }
 
+static const char digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+//Writes the digits backwards, ending right before end. Returns the start of the digits
+static char* writeUInt(char* end, uint64_t value)
+{
+    while(value >= 100)
+    {
+        uint32_t pair = (uint32_t) (value % 100) * 2;
+        value /= 100;
+        *--end = digitPairs[pair + 1];
+        *--end = digitPairs[pair];
+    }
+
+    if(value >= 10)
+    {
+        uint32_t pair = (uint32_t) value * 2;
+        *--end = digitPairs[pair + 1];
+        *--end = digitPairs[pair];
+    }
+    else
+        *--end = (char) ('0' + value);
+
+    return end;
+}
+
+void ffStrbufAppendUInt(FFstrbuf* strbuf, uint64_t value)
+{
+    char buffer[20];
+    char* start = writeUInt(buffer + sizeof(buffer), value);
+    ffStrbufAppendNS(strbuf, (uint32_t) (buffer + sizeof(buffer) - start), start);
+}
+
+void ffStrbufAppendInt(FFstrbuf* strbuf, int64_t value)
+{
+    if(value < 0)
+    {
+        ffStrbufAppendC(strbuf, '-');
+        ffStrbufAppendUInt(strbuf, 0 - (uint64_t) value);
+    }
+    else
+        ffStrbufAppendUInt(strbuf, (uint64_t) value);
+}
+
+//Appends nan and inf like printf does. Returns true if the value was one of them
+static bool appendSpecialDouble(FFstrbuf* strbuf, double value)
+{
+    if(isnan(value))
+        ffStrbufAppendS(strbuf, signbit(value) ? "-nan" : "nan");
+    else if(isinf(value))
+        ffStrbufAppendS(strbuf, value < 0 ? "-inf" : "inf");
+    else
+        return false;
+
+    return true;
+}
+
+#ifdef __SIZEOF_INT128__
+
+#define FF_STRBUF_DOUBLE_MAX_DIGITS 48
+
+//Exact decimal expansion of a non negative double: integer + fraction / 2^fractionBits
+typedef struct DoubleDigits
+{
+    uint64_t integer;
+    unsigned __int128 fraction;
+    uint32_t fractionBits;
+} DoubleDigits;
+
+//Only supports values between ~3e-21 and 2^64, which keeps all arithmetic in 128 bits. Everything else is left to printf
+static bool splitDouble(double value, DoubleDigits* digits)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint64_t mantissa = bits & ((1ULL << 52) - 1);
+    int32_t exponent = (int32_t) ((bits >> 52) & 0x7FF);
+
+    if(exponent == 0)
+        exponent = 1; //Subnormal
+    else
+        mantissa |= 1ULL << 52;
+
+    //value = mantissa * 2^exponent
+    exponent -= 1075;
+
+    digits->fraction = 0;
+    digits->fractionBits = 0;
+
+    if(mantissa == 0)
+    {
+        digits->integer = 0;
+        return true;
+    }
+
+    if(exponent >= 0)
+    {
+        if(exponent > 11)
+            return false;
+
+        digits->integer = mantissa << exponent;
+        return true;
+    }
+
+    if(exponent < -120)
+        return false;
+
+    digits->fractionBits = (uint32_t) -exponent;
+    digits->integer = digits->fractionBits >= 64 ? 0 : mantissa >> digits->fractionBits;
+    digits->fraction = (unsigned __int128) mantissa & ((((unsigned __int128) 1) << digits->fractionBits) - 1);
+    return true;
+}
+
+static char nextFractionDigit(DoubleDigits* digits)
+{
+    //fraction < 2^120, so this can't overflow
+    digits->fraction *= 10;
+    char digit = (char) ('0' + (uint32_t) (digits->fraction >> digits->fractionBits));
+    digits->fraction &= (((unsigned __int128) 1) << digits->fractionBits) - 1;
+    return digit;
+}
+
+//Rounds the digits half to even, depending on the first dropped digit and if any following digit isn't zero. Returns true on overflow (99 -> 00)
+static bool roundDigits(char* digits, uint32_t length, char next, bool sticky)
+{
+    bool roundUp = next > '5' || (next == '5' && (sticky || (length > 0 && (digits[length - 1] - '0') % 2 == 1)));
+    if(!roundUp)
+        return false;
+
+    for(uint32_t i = length; i > 0; --i)
+    {
+        if(digits[i - 1] != '9')
+        {
+            ++digits[i - 1];
+            return false;
+        }
+        digits[i - 1] = '0';
+    }
+
+    return true;
+}
+
+//Like %.*f. Returns the length, or 0 if the value isn't supported
+static uint32_t formatDoubleFixed(char* buffer, double value, uint32_t precision)
+{
+    DoubleDigits digits;
+    if(precision > FF_STRBUF_DOUBLE_MAX_DIGITS / 2 || !splitDouble(value, &digits))
+        return 0;
+
+    //One spare char in front for a carry into a new integer digit
+    char integerBuffer[21];
+    char* integer = writeUInt(integerBuffer + sizeof(integerBuffer), digits.integer);
+    uint32_t integerLength = (uint32_t) (integerBuffer + sizeof(integerBuffer) - integer);
+
+    char all[21 + FF_STRBUF_DOUBLE_MAX_DIGITS / 2];
+    memcpy(all + 1, integer, integerLength);
+    for(uint32_t i = 0; i < precision; ++i)
+        all[1 + integerLength + i] = nextFractionDigit(&digits);
+
+    char* start = all + 1;
+    char next = nextFractionDigit(&digits);
+    if(roundDigits(start, integerLength + precision, next, digits.fraction != 0))
+    {
+        *--start = '1';
+        ++integerLength;
+    }
+
+    uint32_t length = 0;
+    memcpy(buffer, start, integerLength);
+    length += integerLength;
+
+    if(precision > 0)
+    {
+        buffer[length++] = '.';
+        memcpy(buffer + length, start + integerLength, precision);
+        length += precision;
+    }
+
+    return length;
+}
+
+//Like %.*g. Returns the length, or 0 if the value isn't supported
+static uint32_t formatDoubleGeneral(char* buffer, double value, uint32_t precision)
+{
+    if(precision == 0)
+        precision = 1;
+
+    DoubleDigits digits;
+    if(precision > FF_STRBUF_DOUBLE_MAX_DIGITS || !splitDouble(value, &digits))
+        return 0;
+
+    char significant[FF_STRBUF_DOUBLE_MAX_DIGITS];
+    uint32_t numSignificant = 0;
+    int32_t exponent;
+    char next;
+    bool sticky;
+
+    if(digits.integer == 0 && digits.fraction == 0)
+    {
+        memset(significant, '0', precision);
+        exponent = 0;
+        next = '0';
+        sticky = false;
+    }
+    else if(digits.integer > 0)
+    {
+        char integerBuffer[20];
+        char* integer = writeUInt(integerBuffer + sizeof(integerBuffer), digits.integer);
+        uint32_t integerLength = (uint32_t) (integerBuffer + sizeof(integerBuffer) - integer);
+        exponent = (int32_t) integerLength - 1;
+
+        uint32_t i = 0;
+        for(; i < integerLength && numSignificant < precision; ++i)
+            significant[numSignificant++] = integer[i];
+
+        while(numSignificant < precision)
+            significant[numSignificant++] = nextFractionDigit(&digits);
+
+        if(i < integerLength)
+        {
+            next = integer[i++];
+            sticky = digits.fraction != 0;
+            for(; i < integerLength; ++i)
+                sticky |= integer[i] != '0';
+        }
+        else
+        {
+            next = nextFractionDigit(&digits);
+            sticky = digits.fraction != 0;
+        }
+    }
+    else
+    {
+        exponent = -1;
+        char digit;
+        while((digit = nextFractionDigit(&digits)) == '0')
+            --exponent;
+
+        significant[numSignificant++] = digit;
+        while(numSignificant < precision)
+            significant[numSignificant++] = nextFractionDigit(&digits);
+
+        next = nextFractionDigit(&digits);
+        sticky = digits.fraction != 0;
+    }
+
+    if(roundDigits(significant, precision, next, sticky))
+    {
+        significant[0] = '1';
+        ++exponent;
+    }
+
+    //Trailing zeros are removed
+    uint32_t length = 0;
+    uint32_t lastNonZero = precision;
+    while(lastNonZero > 1 && significant[lastNonZero - 1] == '0')
+        --lastNonZero;
+
+    if(exponent < -4 || exponent >= (int32_t) precision)
+    {
+        buffer[length++] = significant[0];
+        if(lastNonZero > 1)
+        {
+            buffer[length++] = '.';
+            memcpy(buffer + length, significant + 1, lastNonZero - 1);
+            length += lastNonZero - 1;
+        }
+
+        buffer[length++] = 'e';
+        buffer[length++] = exponent < 0 ? '-' : '+';
+
+        uint32_t absExponent = (uint32_t) (exponent < 0 ? -exponent : exponent);
+        if(absExponent < 10)
+            buffer[length++] = '0';
+
+        char exponentBuffer[4];
+        char* exponentStart = writeUInt(exponentBuffer + sizeof(exponentBuffer), absExponent);
+        uint32_t exponentLength = (uint32_t) (exponentBuffer + sizeof(exponentBuffer) - exponentStart);
+        memcpy(buffer + length, exponentStart, exponentLength);
+        length += exponentLength;
+    }
+    else if(exponent >= 0)
+    {
+        uint32_t integerLength = (uint32_t) exponent + 1;
+        memcpy(buffer, significant, integerLength);
+        length += integerLength;
+
+        if(lastNonZero > integerLength)
+        {
+            buffer[length++] = '.';
+            memcpy(buffer + length, significant + integerLength, lastNonZero - integerLength);
+            length += lastNonZero - integerLength;
+        }
+    }
+    else
+    {
+        buffer[length++] = '0';
+        buffer[length++] = '.';
+        for(int32_t i = -1; i > exponent; --i)
+            buffer[length++] = '0';
+        memcpy(buffer + length, significant, lastNonZero);
+        length += lastNonZero;
+    }
+
+    return length;
+}
+
+#else
+
+static uint32_t formatDoubleFixed(char* buffer, double value, uint32_t precision)
+{
+    (void) buffer; (void) value; (void) precision;
+    return 0;
+}
+
+static uint32_t formatDoubleGeneral(char* buffer, double value, uint32_t precision)
+{
+    (void) buffer; (void) value; (void) precision;
+    return 0;
+}
+
+#endif
+
+void ffStrbufAppendDoubleF(FFstrbuf* strbuf, double value, uint8_t precision)
+{
+    if(appendSpecialDouble(strbuf, value))
+        return;
+
+    char buffer[64];
+    uint32_t length = formatDoubleFixed(buffer + 1, fabs(value), precision);
+
+    if(length == 0)
+    {
+        ffStrbufAppendF(strbuf, "%.*f", (int) precision, value);
+        return;
+    }
+
+    buffer[0] = '-';
+    bool negative = signbit(value);
+    ffStrbufAppendNS(strbuf, length + negative, negative ? buffer : buffer + 1);
+}
+
+void ffStrbufAppendDoubleG(FFstrbuf* strbuf, double value, uint8_t precision)
+{
+    if(appendSpecialDouble(strbuf, value))
+        return;
+
+    char buffer[64];
+    uint32_t length = formatDoubleGeneral(buffer + 1, fabs(value), precision);
+
+    if(length == 0)
+    {
+        ffStrbufAppendF(strbuf, "%.*g", (int) precision, value);
+        return;
+    }
+
+    buffer[0] = '-';
+    bool negative = signbit(value);
+    ffStrbufAppendNS(strbuf, length + negative, negative ? buffer : buffer + 1);
+}
+
+static uint32_t formatDoubleGeneralTerminated(char* buffer, size_t size, double value, uint32_t precision)
+{
+    uint32_t length = formatDoubleGeneral(buffer, value, precision);
+    if(length == 0)
+        return (uint32_t) snprintf(buffer, size, "%.*g", (int) precision, value);
+
+    buffer[length] = '\0';
+    return length;
+}
+
+void ffStrbufAppendDouble(FFstrbuf* strbuf, double value)
+{
+    if(appendSpecialDouble(strbuf, value))
+        return;
+
+    //The shortest %g output that parses back to the same value. 17 digits always do
+    char buffer[64];
+    buffer[0] = '-';
+    double absValue = fabs(value);
+    uint32_t length = 0;
+    uint32_t precision = 1;
+
+    for(; precision <= 17; ++precision)
+    {
+        length = formatDoubleGeneralTerminated(buffer + 1, sizeof(buffer) - 1, absValue, precision);
+        if(strtod(buffer + 1, NULL) == absValue)
+            break;
+    }
+
+    //%g switches to exponent notation while the precision is below the number of integer digits, so 100 would be 1e+02.
+    //All integer digits are used instead, if that isn't longer
+    uint32_t integerDigits = 1;
+    for(double limit = 10; absValue >= limit && integerDigits < 17; limit *= 10)
+        ++integerDigits;
+
+    if(integerDigits > precision)
+    {
+        char fixed[64];
+        uint32_t fixedLength = formatDoubleGeneralTerminated(fixed, sizeof(fixed), absValue, integerDigits);
+        if(fixedLength <= length && strtod(fixed, NULL) == absValue)
+        {
+            memcpy(buffer + 1, fixed, fixedLength + 1);
+            length = fixedLength;
+        }
+    }
+
+    bool negative = signbit(value);
+    ffStrbufAppendNS(strbuf, length + negative, negative ? buffer : buffer + 1);
+}
+
 void ffStrbufSet(FFstrbuf* strbuf, const FFstrbuf* value)
 {
     ffStrbufClear(strbuf);
@@ -257,14 +695,14 @@ void ffStrbufTrimLeft(FFstrbuf* strbuf, char c)
 
     memmove(strbuf->chars, strbuf->chars + index, strbuf->length - index);
     strbuf->length -= index;
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufTrimRight(FFstrbuf* strbuf, char c)
 {
-    while(ffStrbufEndsWithC(strbuf, c))
+    while(strbuf->length > 0 && strbuf->chars[strbuf->length - 1] == c)
         --strbuf->length;
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufTrim(FFstrbuf* strbuf, char c)
@@ -286,27 +724,88 @@ void ffStrbufRemoveSubstr(FFstrbuf* strbuf, uint32_t startIndex, uint32_t endInd
 
     memmove(strbuf->chars + startIndex, strbuf->chars + endIndex, strbuf->length - endIndex);
     strbuf->length -= (endIndex - startIndex);
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufRemoveS(FFstrbuf* strbuf, const char* str)
 {
-    uint32_t stringLength = (uint32_t) strlen(str);
+    ffStrbufRemoveStringsA(strbuf, 1, &str);
+}
+
+//Patterns whose length is cached on the stack. More are processed in batches of this size
+#define FF_STRBUF_REMOVE_STRINGS_BATCH 32
+
+static void removeStringsBatch(FFstrbuf* strbuf, uint32_t numStrings, const char* strings[])
+{
+    uint32_t lengths[FF_STRBUF_REMOVE_STRINGS_BATCH];
+    bool isFirstChar[256] = {false};
+
+    for(uint32_t i = 0; i < numStrings; i++)
+    {
+        lengths[i] = (uint32_t) strlen(strings[i]);
+        if(lengths[i] > 0)
+            isFirstChar[(uint8_t) strings[i][0]] = true;
+    }
+
+    //Single pass: at every position the first string that matches is removed, and the search goes on behind it.
+    //The kept chars are moved forward in place
+    uint32_t readIndex = 0;
+    uint32_t writeIndex = 0;
+
+    while(readIndex < strbuf->length)
+    {
+        uint32_t matchLength = 0;
 
-    for(uint32_t i = ffStrbufNextIndexS(strbuf, 0, str); i < strbuf->length; i = ffStrbufNextIndexS(strbuf, i, str))
-        ffStrbufRemoveSubstr(strbuf, i, i + stringLength);
+        if(isFirstChar[(uint8_t) strbuf->chars[readIndex]])
+        {
+            for(uint32_t i = 0; i < numStrings; i++)
+            {
+                if(
+                    lengths[i] > 0 &&
+                    lengths[i] <= strbuf->length - readIndex &&
+                    memcmp(strbuf->chars + readIndex, strings[i], lengths[i]) == 0
+                ) {
+                    matchLength = lengths[i];
+                    break;
+                }
+            }
+        }
+
+        if(matchLength > 0)
+            readIndex += matchLength;
+        else
+            strbuf->chars[writeIndex++] = strbuf->chars[readIndex++];
+    }
+
+    if(writeIndex == strbuf->length)
+        return;
+
+    strbuf->length = writeIndex;
+    terminate(strbuf);
 }
 
 void ffStrbufRemoveStringsA(FFstrbuf* strbuf, uint32_t numStrings, const char* strings[])
 {
-    for(uint32_t i = 0; i < numStrings; i++)
-        ffStrbufRemoveS(strbuf, strings[i]);
+    for(uint32_t i = 0; i < numStrings; i += FF_STRBUF_REMOVE_STRINGS_BATCH)
+    {
+        uint32_t batchSize = numStrings - i < FF_STRBUF_REMOVE_STRINGS_BATCH ? numStrings - i : FF_STRBUF_REMOVE_STRINGS_BATCH;
+        removeStringsBatch(strbuf, batchSize, strings + i);
+    }
 }
 
 void ffStrbufRemoveStringsV(FFstrbuf* strbuf, uint32_t numStrings, va_list arguments)
 {
-    for(uint32_t i = 0; i < numStrings; i++)
-        ffStrbufRemoveS(strbuf, va_arg(arguments, const char*));
+    const char* strings[FF_STRBUF_REMOVE_STRINGS_BATCH];
+
+    while(numStrings > 0)
+    {
+        uint32_t batchSize = numStrings < FF_STRBUF_REMOVE_STRINGS_BATCH ? numStrings : FF_STRBUF_REMOVE_STRINGS_BATCH;
+        for(uint32_t i = 0; i < batchSize; i++)
+            strings[i] = va_arg(arguments, const char*);
+
+        removeStringsBatch(strbuf, batchSize, strings);
+        numStrings -= batchSize;
+    }
 }
 
 void ffStrbufRemoveStrings(FFstrbuf* strbuf, uint32_t numStrings, ...)
@@ -317,39 +816,24 @@ void ffStrbufRemoveStrings(FFstrbuf* strbuf, uint32_t numStrings, ...)
     va_end(argp);
 }
 
+//The searches use memchr, memrchr and memmem. The C library picks SSE2, AVX2 or EVEX versions of them for the running CPU
+
 uint32_t ffStrbufNextIndexC(const FFstrbuf* strbuf, uint32_t start, char c)
 {
-    for(uint32_t i = start; i < strbuf->length; i++)
-    {
-        if(strbuf->chars[i] == c)
-            return i;
-    }
-    return strbuf->length;
+    if(start >= strbuf->length)
+        return strbuf->length;
+
+    const char* result = memchr(strbuf->chars + start, c, strbuf->length - start);
+    return result == NULL ? strbuf->length : (uint32_t) (result - strbuf->chars);
 }
 
 uint32_t ffStrbufNextIndexS(const FFstrbuf* strbuf, uint32_t start, const char* str)
 {
-    for(uint32_t i = start; i < strbuf->length; i++)
-    {
-        bool found = true;
-
-        for(uint32_t k = 0; str[k] != '\0'; k++)
-        {
-            if(i + k == strbuf->length)
-                return strbuf->length;
-
-            if(strbuf->chars[i + k] != str[k])
-            {
-                found = false;
-                break;
-            }
-        }
-
-        if(found)
-            return i;
-    }
+    if(start >= strbuf->length)
+        return strbuf->length;
 
-    return strbuf->length;
+    const char* result = memmem(strbuf->chars + start, strbuf->length - start, str, strlen(str));
+    return result == NULL ? strbuf->length : (uint32_t) (result - strbuf->chars);
 }
 
 uint32_t ffStrbufFirstIndexC(const FFstrbuf* strbuf, char c)
@@ -372,13 +856,8 @@ uint32_t ffStrbufPreviousIndexC(const FFstrbuf* strbuf, uint32_t start, char c)
     if(start >= strbuf->length)
         return strbuf->length;
 
-    //We need to loop one higher than the actual index, because uint32_t is guranteed to be >= 0, so this statement would always be true
-    for(uint32_t i = start + 1; i > 0; i--)
-    {
-        if(strbuf->chars[i - 1] == c)
-            return i - 1;
-    }
-    return strbuf->length;
+    const char* result = memrchr(strbuf->chars, c, start + 1);
+    return result == NULL ? strbuf->length : (uint32_t) (result - strbuf->chars);
 }
 
 uint32_t ffStrbufLastIndexC(const FFstrbuf* strbuf, char c)
@@ -392,7 +871,7 @@ void ffStrbufSubstrBefore(FFstrbuf* strbuf, uint32_t index)
         return;
 
     strbuf->length = index;
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufSubstrBeforeFirstC(FFstrbuf* strbuf, char c)
@@ -415,7 +894,7 @@ void ffStrbufSubstrAfter(FFstrbuf* strbuf, uint32_t index)
 
     memmove(strbuf->chars, strbuf->chars + index + 1, strbuf->length - index - 1);
     strbuf->length -= (index + 1);
-    strbuf->chars[strbuf->length] = '\0';
+    terminate(strbuf);
 }
 
 void ffStrbufSubstrAfterFirstC(FFstrbuf* strbuf, char c)
@@ -536,5 +1015,14 @@ void ffStrbufPutTo(const FFstrbuf* strbuf, FILE* file)
 
 void ffStrbufDestroy(FFstrbuf* strbuf)
 {
-    free(strbuf->chars);
+    if(strbuf->allocated > 0)
+    {
+        if(ffArenaIsEnabled())
+            ffArenaFree(strbuf->chars, strbuf->allocated);
+        else
+            free(strbuf->chars);
+    }
+
+    strbuf->allocated = 0;
+    ffStrbufClear(strbuf);
 }
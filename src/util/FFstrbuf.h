@@ -40,6 +40,11 @@ void ffStrbufAppendNSExludingC(FFstrbuf* strbuf, uint32_t length, const char* va
 void ffStrbufAppendTransformS(FFstrbuf* strbuf, const char* value, int(*transformFunc)(int));
 void ffStrbufAppendF(FFstrbuf* strbuf, const char* format, ...);
 void ffStrbufAppendVF(FFstrbuf* strbuf, const char* format, va_list arguments);
+void ffStrbufAppendUInt(FFstrbuf* strbuf, uint64_t value);
+void ffStrbufAppendInt(FFstrbuf* strbuf, int64_t value);
+void ffStrbufAppendDouble(FFstrbuf* strbuf, double value); //Shortest representation that round trips
+void ffStrbufAppendDoubleF(FFstrbuf* strbuf, double value, uint8_t precision); //Like %.*f
+void ffStrbufAppendDoubleG(FFstrbuf* strbuf, double value, uint8_t precision); //Like %.*g
 
 void ffStrbufSet(FFstrbuf* strbuf, const FFstrbuf* value);
 void ffStrbufSetS(FFstrbuf* strbuf, const char* value);
@@ -56,7 +61,7 @@ void ffStrbufTrim(FFstrbuf* strbuf, char c);
 
 void ffStrbufRemoveSubstr(FFstrbuf* strbuf, uint32_t startIndex, uint32_t endIndex);
 void ffStrbufRemoveS(FFstrbuf* strbuf, const char* str);
-void ffStrbufRemoveStringsA(FFstrbuf* strbuf, uint32_t numStrings, const char* strings[]);
+void ffStrbufRemoveStringsA(FFstrbuf* strbuf, uint32_t numStrings, const char* strings[]); //Single pass, at every position the first matching string is removed
 void ffStrbufRemoveStringsV(FFstrbuf* strbuf, uint32_t numStrings, va_list arguments);
 void ffStrbufRemoveStrings(FFstrbuf* strbuf, uint32_t numStrings, ...);
 
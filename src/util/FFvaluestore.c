@@ -1,56 +1,107 @@
-#include <stdint.h>
-#include <malloc.h>
+#include "FFvaluestore.h"
+#include "FFperfecthash.h"
+#include "FFarena.h"
+
+#include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
-#include "FFvaluestore.h"
+static const char* arenaCopy(const char* value, bool lowerCase)
+{
+    uint32_t length = (uint32_t) strlen(value);
+    char* result = ffArenaAlloc(length + 1);
+
+    if(lowerCase)
+    {
+        for(uint32_t i = 0; i < length; ++i)
+            result[i] = (char) (value[i] >= 'A' && value[i] <= 'Z' ? value[i] + ('a' - 'A') : value[i]);
+        result[length] = '\0';
+    }
+    else
+        memcpy(result, value, length + 1);
+
+    return result;
+}
+
+static FFvaluestoreEntry* findEntry(const FFvaluestore* vs, const char* name, uint32_t hash)
+{
+    uint32_t mask = vs->capacity - 1;
+
+    for(uint32_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        FFvaluestoreEntry* entry = &vs->entries[i];
+        if(entry->name == NULL || (entry->hash == hash && strcasecmp(entry->name, name) == 0))
+            return entry;
+    }
+}
+
+static void grow(FFvaluestore* vs)
+{
+    FFvaluestoreEntry* oldEntries = vs->entries;
+    uint32_t oldCapacity = vs->capacity;
+
+    vs->capacity *= 2;
+    vs->entries = calloc(vs->capacity, sizeof(FFvaluestoreEntry));
+
+    for(uint32_t i = 0; i < oldCapacity; ++i)
+    {
+        if(oldEntries[i].name != NULL)
+            *findEntry(vs, oldEntries[i].name, oldEntries[i].hash) = oldEntries[i];
+    }
+
+    free(oldEntries);
+}
 
 void ffValuestoreInit(FFvaluestore* vs)
 {
-    vs->capacity = 32;
-    vs->pairs = calloc(vs->capacity, sizeof(FFvaluestorePair));
+    vs->capacity = 16;
+    vs->entries = calloc(vs->capacity, sizeof(FFvaluestoreEntry));
     vs->size = 0;
 }
 
 void ffValuestoreSet(FFvaluestore* vs, const char* name, const char* value)
 {
-    for(uint32_t i = 0; i < vs->size; i++)
+    uint32_t hash = ffPerfectHashName(name, 0);
+    FFvaluestoreEntry* entry = findEntry(vs, name, hash);
+
+    if(entry->name != NULL)
     {
-        if(strcasecmp(vs->pairs[i].name, name) == 0)
-        {
-            strcpy(vs->pairs[i].value, value);
-            return;
-        }
+        //Reuse the old value if the new one fits into it. Otherwise the old one stays unused until the arena is destroyed
+        if(strlen(entry->value) >= strlen(value))
+            strcpy((char*) entry->value, value);
+        else
+            entry->value = arenaCopy(value, false);
+        return;
     }
 
-    if(vs->size == vs->capacity)
+    //Keep the load factor at or below 3/4, so probe sequences stay short and always end at an empty slot
+    if((vs->size + 1) * 4 > vs->capacity * 3)
     {
-        vs->pairs = realloc(vs->pairs, vs->capacity * sizeof(FFvaluestorePair) * 2);
-        vs->capacity *= 2;
+        grow(vs);
+        entry = findEntry(vs, name, hash);
     }
 
-    strcpy(vs->pairs[vs->size].name, name);
-    strcpy(vs->pairs[vs->size].value, value);
-
+    entry->name = arenaCopy(name, true);
+    entry->value = arenaCopy(value, false);
+    entry->hash = hash;
     ++vs->size;
 }
 
-const char* ffValuestoreGet(FFvaluestore* vs, const char* name)
+const char* ffValuestoreGet(const FFvaluestore* vs, const char* name)
 {
-    for(uint32_t i = 0; i < vs->size; i++)
-    {
-        if(strcasecmp(vs->pairs[i].name, name) == 0)
-            return vs->pairs[i].value;
-    }
-
-    return NULL;
+    return findEntry(vs, name, ffPerfectHashName(name, 0))->value;
 }
 
-bool ffValuestoreContains(FFvaluestore* vs, const char* name)
+bool ffValuestoreContains(const FFvaluestore* vs, const char* name)
 {
     return ffValuestoreGet(vs, name) != NULL;
 }
 
 void ffValuestoreDelete(FFvaluestore* vs)
 {
-    free(vs->pairs);
+    //The strings belong to the arena and are freed with it
+    free(vs->entries);
+    vs->entries = NULL;
+    vs->size = 0;
+    vs->capacity = 0;
 }
@@ -3,25 +3,30 @@
 #ifndef FASTFETCH_INCLUDED_FFVALUESTORE
 #define FASTFETCH_INCLUDED_FFVALUESTORE
 
+#include <stdint.h>
 #include <stdbool.h>
 
-typedef struct FFvaluestorePair
+//Case insensitive map of names to values, used for --set.
+//Open addressing with linear probing. Names and values are copied into the arena (FFarena.h), they stay valid until ffArenaDestroy.
+
+typedef struct FFvaluestoreEntry
 {
-    char name[32];
-    char value[1024];
-} FFvaluestorePair;
+    const char* name; //Lower case. NULL if the slot is empty
+    const char* value;
+    uint32_t hash;
+} FFvaluestoreEntry;
 
 typedef struct FFvaluestore
 {
-    FFvaluestorePair* pairs;
+    FFvaluestoreEntry* entries;
     uint32_t size;
-    uint32_t capacity;
+    uint32_t capacity; //Power of two
 } FFvaluestore;
 
 void ffValuestoreInit(FFvaluestore* vs);
 void ffValuestoreSet(FFvaluestore* vs, const char* name, const char* value);
-const char* ffValuestoreGet(FFvaluestore* vs, const char* name);
-bool ffValuestoreContains(FFvaluestore* vs, const char* name);
+const char* ffValuestoreGet(const FFvaluestore* vs, const char* name);
+bool ffValuestoreContains(const FFvaluestore* vs, const char* name);
 void ffValuestoreDelete(FFvaluestore* vs);
 
 #endif
@@ -0,0 +1,82 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    char* a = ffArenaAlloc(3);
+    char* b = ffArenaAlloc(5);
+
+    if(((uintptr_t) a % _Alignof(max_align_t)) != 0 || ((uintptr_t) b % _Alignof(max_align_t)) != 0)
+        testFailed("ffArenaAlloc returned unaligned memory");
+
+    if(b < a + 3)
+        testFailed("ffArenaAlloc returned overlapping memory");
+
+    //The newest allocation grows in place
+    memcpy(b, "abcd", 5);
+    if(ffArenaRealloc(b, 5, 100) != b)
+        testFailed("ffArenaRealloc didn't grow the newest allocation in place");
+
+    //Any other one is copied
+    memcpy(a, "xy", 3);
+    char* c = ffArenaRealloc(a, 3, 10);
+    if(c == a || strcmp(c, "xy") != 0)
+        testFailed("ffArenaRealloc didn't copy an older allocation");
+
+    //Freeing the newest allocation gives its memory back
+    ffArenaFree(c, 10);
+    if(ffArenaAlloc(10) != c)
+        testFailed("ffArenaFree didn't give back the newest allocation");
+
+    //Big allocations get a chunk of their own and don't disturb the current one
+    char* big = ffArenaAlloc(1024 * 1024);
+    memset(big, 'x', 1024 * 1024);
+    char* d = ffArenaAlloc(16);
+    if(d >= big && d < big + 1024 * 1024)
+        testFailed("ffArenaAlloc returned memory inside a big allocation");
+
+    //Strbufs and lists allocate from the arena once it is enabled
+    ffArenaEnable();
+
+    FFstrbuf strbuf;
+    ffStrbufInit(&strbuf);
+    for(uint32_t i = 0; i < 10000; ++i)
+        ffStrbufAppendC(&strbuf, (char) ('a' + i % 26));
+
+    if(strbuf.length != 10000 || strbuf.chars[9999] != 'a' + 9999 % 26 || strbuf.chars[10000] != '\0')
+        testFailed("strbuf in the arena has wrong content");
+
+    FFlist list;
+    ffListInitA(&list, sizeof(uint64_t), 1);
+    for(uint64_t i = 0; i < 10000; ++i)
+        *(uint64_t*) ffListAdd(&list) = i;
+
+    for(uint32_t i = 0; i < list.length; ++i)
+    {
+        if(*(uint64_t*) ffListGet(&list, i) != i)
+            testFailed("list in the arena has wrong content at %u", i);
+    }
+
+    ffListDestroy(&list);
+    ffStrbufDestroy(&strbuf);
+
+    ffArenaDestroy();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
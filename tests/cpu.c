@@ -0,0 +1,411 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdarg.h>
+
+static void testFailed(const FFCPUResult* result, const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fprintf(stderr, ", name: \"%s\", vendor: \"%s\", family: %u, model: %u, stepping: %u, packages: %u, cores: %u, threads: %u",
+        result->name.chars, result->vendor.chars, result->family, result->model, result->stepping,
+        result->packages, result->physicalCores, result->threads
+    );
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void setRegisters(uint32_t registers[4], const char* chars)
+{
+    memcpy(registers, chars, 16);
+}
+
+//Intel Core i7-8550U
+static bool cpuidIntel(uint32_t leaf, uint32_t registers[4])
+{
+    if(leaf == 0)
+    {
+        registers[0] = 0x16;
+        memcpy(&registers[1], "Genu", 4);
+        memcpy(&registers[3], "ineI", 4);
+        memcpy(&registers[2], "ntel", 4);
+    }
+    else if(leaf == 1)
+        registers[0] = 0x000806EA;
+    else if(leaf == 0x80000000)
+        registers[0] = 0x80000008;
+    else if(leaf == 0x80000002)
+        setRegisters(registers, "Intel(R) Core(TM");
+    else if(leaf == 0x80000003)
+        setRegisters(registers, ") i7-8550U CPU @");
+    else if(leaf == 0x80000004)
+        setRegisters(registers, " 1.80GHz\0\0\0\0\0\0\0\0");
+    else
+        return false;
+
+    return true;
+}
+
+//AMD Ryzen, with an extended family and the brand string padded with spaces
+static bool cpuidAMD(uint32_t leaf, uint32_t registers[4])
+{
+    if(leaf == 0)
+    {
+        registers[0] = 0x10;
+        memcpy(&registers[1], "Auth", 4);
+        memcpy(&registers[3], "enti", 4);
+        memcpy(&registers[2], "cAMD", 4);
+    }
+    else if(leaf == 1)
+        registers[0] = 0x00870F10;
+    else if(leaf == 0x80000000)
+        registers[0] = 0x80000020;
+    else if(leaf == 0x80000002)
+        setRegisters(registers, "AMD Ryzen 7 3700");
+    else if(leaf == 0x80000003)
+        setRegisters(registers, "X 8-Core Process");
+    else if(leaf == 0x80000004)
+        setRegisters(registers, "or              ");
+    else
+        return false;
+
+    return true;
+}
+
+//Old CPU without brand string
+static bool cpuidNoBrand(uint32_t leaf, uint32_t registers[4])
+{
+    if(leaf == 0)
+    {
+        registers[0] = 0x2;
+        memcpy(&registers[1], "Genu", 4);
+        memcpy(&registers[3], "ineI", 4);
+        memcpy(&registers[2], "ntel", 4);
+    }
+    else if(leaf == 1)
+        registers[0] = 0x00000673;
+    else if(leaf == 0x80000000)
+        registers[0] = 0x80000000;
+    else
+        return false;
+
+    return true;
+}
+
+static bool cpuidUnsupported(uint32_t leaf, uint32_t registers[4])
+{
+    FF_UNUSED(leaf, registers);
+    return false;
+}
+
+static void testCPUID()
+{
+    FFCPUResult result;
+    ffCPUResultInit(&result);
+
+    if(!ffDetectCPUID(cpuidIntel, &result))
+        testFailed(&result, "ffDetectCPUID(cpuidIntel) failed");
+    if(ffStrbufCompS(&result.name, "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz") != 0)
+        testFailed(&result, "Intel brand string");
+    if(ffStrbufCompS(&result.vendor, "GenuineIntel") != 0)
+        testFailed(&result, "Intel vendor");
+    if(result.family != 6 || result.model != 142 || result.stepping != 10)
+        testFailed(&result, "Intel signature");
+
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    if(!ffDetectCPUID(cpuidAMD, &result))
+        testFailed(&result, "ffDetectCPUID(cpuidAMD) failed");
+    if(ffStrbufCompS(&result.name, "AMD Ryzen 7 3700X 8-Core Processor") != 0)
+        testFailed(&result, "AMD brand string");
+    if(ffStrbufCompS(&result.vendor, "AuthenticAMD") != 0)
+        testFailed(&result, "AMD vendor");
+    if(result.family != 23 || result.model != 113 || result.stepping != 0)
+        testFailed(&result, "AMD signature");
+
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    if(!ffDetectCPUID(cpuidNoBrand, &result))
+        testFailed(&result, "ffDetectCPUID(cpuidNoBrand) failed");
+    if(result.name.length != 0 || ffStrbufCompS(&result.vendor, "GenuineIntel") != 0)
+        testFailed(&result, "CPU without brand string");
+    if(result.family != 6 || result.model != 7 || result.stepping != 3)
+        testFailed(&result, "CPU without brand string signature");
+
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    if(ffDetectCPUID(cpuidUnsupported, &result))
+        testFailed(&result, "ffDetectCPUID(cpuidUnsupported) succeeded");
+    if(result.name.length != 0 || result.vendor.length != 0 || result.family != 0)
+        testFailed(&result, "ffDetectCPUID(cpuidUnsupported) set values");
+
+    ffCPUResultDestroy(&result);
+}
+
+static void testTopology()
+{
+    //2 packages with 2 cores and 2 threads each, the cores of package 1 are in different clusters. cpu8 is offline
+    static const char* topology[][4] = {
+        {"cpu0", "0", "0", "0"}, {"cpu1", "0", "1", "0"}, {"cpu2", "1", "0", "0"}, {"cpu3", "1", "1", "1"},
+        {"cpu4", "0", "0", "0"}, {"cpu5", "0", "1", "0"}, {"cpu6", "1", "0", "0"}, {"cpu7", "1", "1", "1"}
+    };
+
+    FFstrbuf path;
+    ffStrbufInit(&path);
+
+    FFstrbuf content;
+    ffStrbufInit(&content);
+
+    for(uint32_t i = 0; i < sizeof(topology) / sizeof(topology[0]); i++)
+    {
+        ffStrbufClear(&path);
+        ffStrbufAppendF(&path, "cpu/%s/topology/physical_package_id", topology[i][0]);
+        fixtureWrite(path.chars, topology[i][1]);
+
+        ffStrbufClear(&path);
+        ffStrbufAppendF(&path, "cpu/%s/topology/core_id", topology[i][0]);
+        fixtureWrite(path.chars, topology[i][2]);
+
+        ffStrbufClear(&path);
+        ffStrbufAppendF(&path, "cpu/%s/topology/cluster_id", topology[i][0]);
+        fixtureWrite(path.chars, topology[i][3]);
+
+        //L1 and L2 are shared by the threads of a core, L3 by the package
+        static const char* caches[][3] = {
+            {"1", "Data", "32K"}, {"1", "Instruction", "32K"}, {"2", "Unified", "1024K"}, {"3", "Unified", "16M"}
+        };
+
+        for(uint32_t index = 0; index < sizeof(caches) / sizeof(caches[0]); index++)
+        {
+            ffStrbufClear(&path);
+            ffStrbufAppendF(&path, "cpu/%s/cache/index%u/level", topology[i][0], index);
+            fixtureWrite(path.chars, caches[index][0]);
+
+            ffStrbufClear(&path);
+            ffStrbufAppendF(&path, "cpu/%s/cache/index%u/type", topology[i][0], index);
+            fixtureWrite(path.chars, caches[index][1]);
+
+            ffStrbufClear(&path);
+            ffStrbufAppendF(&path, "cpu/%s/cache/index%u/size", topology[i][0], index);
+            fixtureWrite(path.chars, caches[index][2]);
+
+            ffStrbufClear(&content);
+            if(index < 3)
+                ffStrbufAppendF(&content, "%u,%u\n", i % 4, i % 4 + 4);
+            else
+                ffStrbufAppendS(&content, topology[i][1][0] == '0' ? "0-1,4-5\n" : "2-3,6-7\n");
+
+            ffStrbufClear(&path);
+            ffStrbufAppendF(&path, "cpu/%s/cache/index%u/shared_cpu_list", topology[i][0], index);
+            fixtureWrite(path.chars, content.chars);
+        }
+    }
+
+    fixtureWrite("cpu/cpu8", NULL);
+    fixtureWrite("cpu/online", "0-7\n");
+    fixtureWrite("cpu/cpufreq/policy0/scaling_max_freq", "4700000\n");
+    fixtureWrite("cpu/cpufreq/policy0/cpuinfo_max_freq", "5000000\n");
+    fixtureWrite("cpu/cpufreq/policy0/related_cpus", "0 1 4 5 \n");
+    fixtureWrite("cpu/cpufreq/policy2/cpuinfo_max_freq", "3400000\n");
+    fixtureWrite("cpu/cpufreq/policy2/related_cpus", "2-3,6-7\n");
+    fixtureWrite("cpu/cpufreq/policy10/cpuinfo_max_freq", "1000000\n");
+    fixtureWrite("cpu/cpufreq/policy10/affected_cpus", "8\n");
+    fixtureWrite("cpu/cpufreq/policy11/related_cpus", "9\n");
+
+    FFCPUResult result;
+    ffCPUResultInit(&result);
+
+    fixturePath("cpu", &path);
+    if(!ffDetectCPUTopology(path.chars, &result))
+        testFailed(&result, "ffDetectCPUTopology failed");
+    if(result.packages != 2 || result.physicalCores != 4 || result.threads != 8 || result.clusters != 3)
+        testFailed(&result, "wrong topology");
+    if(result.cacheL1d != 128 || result.cacheL1i != 128 || result.cacheL2 != 4096 || result.cacheL3 != 32768)
+        testFailed(&result, "wrong cache sizes %u %u %u %u", result.cacheL1d, result.cacheL1i, result.cacheL2, result.cacheL3);
+
+    static const FFCPUPolicy policies[] = {
+        {0, 4, 4700000}, {2, 4, 3400000}, {10, 1, 1000000}
+    };
+
+    if(result.policies.length != sizeof(policies) / sizeof(policies[0]))
+        testFailed(&result, "wrong policy count %u", result.policies.length);
+
+    for(uint32_t i = 0; i < result.policies.length; i++)
+    {
+        const FFCPUPolicy* policy = FF_LIST_GET(FFCPUPolicy, &result.policies, i);
+        if(policy->id != policies[i].id || policy->numCpus != policies[i].numCpus || policy->maxFrequency != policies[i].maxFrequency)
+            testFailed(&result, "wrong policy %u: %u %u %u", i, policy->id, policy->numCpus, policy->maxFrequency);
+    }
+
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    fixturePath("nonexistent", &path);
+    if(ffDetectCPUTopology(path.chars, &result))
+        testFailed(&result, "ffDetectCPUTopology succeeded for a missing directory");
+    if(result.packages != 0 || result.physicalCores != 0 || result.threads != 0 || result.policies.length != 0)
+        testFailed(&result, "ffDetectCPUTopology set values for a missing directory");
+
+    ffCPUResultDestroy(&result);
+    ffStrbufDestroy(&content);
+    ffStrbufDestroy(&path);
+}
+
+static void testCpuinfo()
+{
+    FFstrbuf content;
+    ffStrbufInit(&content);
+
+    //Many processors, so the file is read in multiple chunks
+    for(uint32_t i = 0; i < 64; i++)
+    {
+        ffStrbufAppendF(&content,
+            "processor\t: %u\n"
+            "vendor_id\t: GenuineIntel\n"
+            "cpu family\t: 6\n"
+            "model\t\t: 85\n"
+            "model name\t: Intel(R) Xeon(R) Gold 6148 CPU @ 2.40GHz\n"
+            "stepping\t: 4\n"
+            "cpu MHz\t\t: %u.000\n"
+            "cpu cores\t: 20\n"
+            "\n",
+            i, 2400 + i
+        );
+    }
+
+    FFstrbuf path;
+    ffStrbufInit(&path);
+    ffStrbufSetS(&path, fixtureWrite("cpuinfo", content.chars));
+
+    FFCPUResult result;
+    ffCPUResultInit(&result);
+
+    if(!ffDetectCPUInfo(path.chars, &result))
+        testFailed(&result, "ffDetectCPUInfo failed");
+    if(ffStrbufCompS(&result.name, "Intel(R) Xeon(R) Gold 6148 CPU @ 2.40GHz") != 0 || ffStrbufCompS(&result.vendor, "GenuineIntel") != 0)
+        testFailed(&result, "cpuinfo name or vendor");
+    if(result.family != 6 || result.model != 85 || result.stepping != 4 || result.physicalCores != 20)
+        testFailed(&result, "cpuinfo values");
+    if(result.procGhz != 2.4)
+        testFailed(&result, "cpuinfo procGhz %f is not from the first processor", result.procGhz);
+
+    //Values from cpuid and the topology are kept
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+    ffDetectCPUID(cpuidIntel, &result);
+    result.physicalCores = 40;
+
+    ffDetectCPUInfo(path.chars, &result);
+    if(ffStrbufCompS(&result.name, "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz") != 0 || result.model != 142 || result.physicalCores != 40)
+        testFailed(&result, "cpuinfo overwrote known values");
+    if(result.procGhz != 2.4)
+        testFailed(&result, "cpuinfo procGhz with known values");
+
+    //ARM devices without "model name" have the hardware at the end of the file
+    ffStrbufSetS(&content,
+        "processor\t: 0\n"
+        "BogoMIPS\t: 38.40\n"
+        "CPU implementer\t: 0x41\n"
+        "\n"
+        "processor\t: 1\n"
+        "BogoMIPS\t: 38.40\n"
+        "\n"
+        "Hardware\t: Qualcomm Technologies, Inc SDM845"
+    );
+    ffStrbufSetS(&path, fixtureWrite("cpuinfo-arm", content.chars));
+
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    ffDetectCPUInfo(path.chars, &result);
+    if(ffStrbufCompS(&result.name, "Qualcomm Technologies, Inc SDM845") != 0 || result.vendor.length != 0)
+        testFailed(&result, "cpuinfo hardware");
+
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    fixturePath("nonexistent", &path);
+    if(ffDetectCPUInfo(path.chars, &result))
+        testFailed(&result, "ffDetectCPUInfo succeeded for a missing file");
+
+    ffCPUResultDestroy(&result);
+    ffStrbufDestroy(&path);
+    ffStrbufDestroy(&content);
+}
+
+//The path of the CPU module, which must find the topology on every architecture
+static void testDetect()
+{
+    FFinstance instance;
+    ffInitInstance(&instance);
+    instance.config.recache = true;
+    instance.config.cacheSave = false;
+
+    FFstrbuf cpuDir, cpuinfo;
+    ffStrbufInit(&cpuDir);
+    ffStrbufInit(&cpuinfo);
+    fixturePath("cpu", &cpuDir);
+    fixturePath("cpuinfo-arm", &cpuinfo);
+
+    //ARM: no cpuid, the name comes from cpuinfo
+    FFCPUResult result;
+    ffCPUResultInit(&result);
+
+    if(!ffDetectCPU(&instance, cpuidUnsupported, cpuDir.chars, cpuinfo.chars, &result))
+        testFailed(&result, "ffDetectCPU without cpuid didn't read cpuinfo");
+    if(ffStrbufCompS(&result.name, "Qualcomm Technologies, Inc SDM845") != 0)
+        testFailed(&result, "ffDetectCPU without cpuid: name");
+    if(result.packages != 2 || result.physicalCores != 4 || result.threads != 8 || result.clusters != 3)
+        testFailed(&result, "ffDetectCPU without cpuid: topology");
+    if(result.cacheL1d != 128 || result.cacheL2 != 4096 || result.cacheL3 != 32768 || result.policies.length != 3)
+        testFailed(&result, "ffDetectCPU without cpuid: caches or policies");
+
+    //x86 with brand string: cpuinfo isn't needed
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+
+    if(ffDetectCPU(&instance, cpuidIntel, cpuDir.chars, cpuinfo.chars, &result))
+        testFailed(&result, "ffDetectCPU with cpuid read cpuinfo");
+    if(ffStrbufCompS(&result.name, "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz") != 0 || result.family != 6)
+        testFailed(&result, "ffDetectCPU with cpuid: name or family");
+    if(result.packages != 2 || result.clusters != 3 || result.cacheL3 != 32768 || result.policies.length != 3)
+        testFailed(&result, "ffDetectCPU with cpuid: topology");
+
+    //Without topology cpuinfo is read for the core count
+    ffCPUResultDestroy(&result);
+    ffCPUResultInit(&result);
+    fixturePath("nonexistent", &cpuDir);
+
+    if(!ffDetectCPU(&instance, cpuidIntel, cpuDir.chars, cpuinfo.chars, &result))
+        testFailed(&result, "ffDetectCPU without topology didn't read cpuinfo");
+    if(ffStrbufCompS(&result.name, "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz") != 0 || result.packages != 0)
+        testFailed(&result, "ffDetectCPU without topology");
+
+    ffCPUResultDestroy(&result);
+    ffStrbufDestroy(&cpuDir);
+    ffStrbufDestroy(&cpuinfo);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    fixtureCreate("cpu");
+
+    testCPUID();
+    testTopology();
+    testCpuinfo();
+    testDetect();
+
+    fixtureRemove();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
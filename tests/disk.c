@@ -0,0 +1,118 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void expectMount(const FFlist* mounts, uint32_t index, const char* mountPoint, const char* fsType, uint64_t deviceId)
+{
+    if(index >= mounts->length)
+        testFailed("mount %u is missing, only %u mounts", index, mounts->length);
+
+    const FFDiskMount* mount = FF_LIST_GET(FFDiskMount, mounts, index);
+
+    if(ffStrbufCompS(&mount->mountPoint, mountPoint) != 0)
+        testFailed("mount %u: mountPoint \"%s\" != \"%s\"", index, mount->mountPoint.chars, mountPoint);
+
+    if(ffStrbufCompS(&mount->fsType, fsType) != 0)
+        testFailed("mount %u: fsType \"%s\" != \"%s\"", index, mount->fsType.chars, fsType);
+
+    if(mount->deviceId != deviceId)
+        testFailed("mount %u: deviceId %llx != %llx", index, (unsigned long long) mount->deviceId, (unsigned long long) deviceId);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    fixtureCreate("disk");
+
+    const char* fileName = fixtureWrite("mountinfo",
+        "23 28 0:22 / /proc rw,relatime - proc proc rw\n"
+        "25 28 0:6 / /dev rw,relatime - devtmpfs devtmpfs rw,mode=755\n"
+        //A bind mount of a subdirectory, before the mount of the device itself
+        "27 28 8:2 /srv/www /var/www rw,relatime shared:2 - ext4 /dev/sda2 rw\n"
+        "28 1 8:1 / / rw,relatime shared:1 - ext4 /dev/sda1 rw\n"
+        "29 28 8:2 / /srv rw,relatime shared:2 master:5 - ext4 /dev/sda2 rw\n"
+        "30 28 0:45 / /tmp rw,nosuid - tmpfs tmpfs rw\n"
+        "31 28 7:0 / /snap/core/1 ro - squashfs /dev/loop0 ro\n"
+        "32 28 0:50 / /mnt/my\\040nas rw - nfs4 nas:/export rw,vers=4.2\n"
+        "33 28 8:1 /home /home rw,relatime - ext4 /dev/sda1 rw\n"
+        "34 28 259:3 / /data rw - zfs tank/data rw,xattr\n"
+        "35 28 0:51 / /broken rw"
+    );
+
+    FFlist mounts;
+    if(!ffDetectDiskMounts(fileName, false, &mounts))
+        testFailed("ffDetectDiskMounts failed");
+
+    //proc, devtmpfs, tmpfs and squashfs are skipped, /home and /var/www are on devices which are already shown.
+    //The broken line has no filesystem type
+    if(mounts.length != 4)
+        testFailed("mounts.length != 4 (%u)", mounts.length);
+
+    expectMount(&mounts, 0, "/srv", "ext4", (8ULL << 32) | 2);
+    expectMount(&mounts, 1, "/", "ext4", (8ULL << 32) | 1);
+    expectMount(&mounts, 2, "/mnt/my nas", "nfs4", 50);
+    expectMount(&mounts, 3, "/data", "zfs", (259ULL << 32) | 3);
+
+    ffDiskMountsDestroy(&mounts);
+
+    //All mounts, to find the one of any path
+    if(!ffDetectDiskMounts(fileName, true, &mounts))
+        testFailed("ffDetectDiskMounts with all failed");
+
+    if(mounts.length != 10)
+        testFailed("all mounts.length != 10 (%u)", mounts.length);
+
+    expectMount(&mounts, 0, "/proc", "proc", 22);
+    expectMount(&mounts, 2, "/var/www", "ext4", (8ULL << 32) | 2);
+    expectMount(&mounts, 8, "/home", "ext4", (8ULL << 32) | 1);
+
+    struct {
+        const char* path;
+        const char* mountPoint; //NULL if none
+    } lookups[] = {
+        {"/", "/"},
+        {"/usr/bin", "/"},
+        {"/home", "/home"},
+        {"/home/user", "/home"},
+        {"/homework", "/"},
+        {"/tmp/x", "/tmp"},
+        {"/var/www/index.html", "/var/www"},
+        {"/mnt/my nas/file", "/mnt/my nas"},
+        {"relative", NULL},
+    };
+
+    for(uint32_t i = 0; i < sizeof(lookups) / sizeof(lookups[0]); i++)
+    {
+        const FFDiskMount* mount = ffDiskMountsFind(&mounts, lookups[i].path);
+        const char* mountPoint = mount == NULL ? NULL : mount->mountPoint.chars;
+
+        if(lookups[i].mountPoint == NULL ? mountPoint != NULL : (mountPoint == NULL || strcmp(mountPoint, lookups[i].mountPoint) != 0))
+            testFailed("ffDiskMountsFind(\"%s\"): \"%s\" != \"%s\"", lookups[i].path, mountPoint ? mountPoint : "NULL", lookups[i].mountPoint ? lookups[i].mountPoint : "NULL");
+    }
+
+    ffDiskMountsDestroy(&mounts);
+
+    if(ffDetectDiskMounts("/nonexistent/mountinfo", false, &mounts) || mounts.length != 0)
+        testFailed("ffDetectDiskMounts succeeded without file");
+    ffDiskMountsDestroy(&mounts);
+
+    fixtureRemove();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
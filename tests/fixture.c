@@ -0,0 +1,84 @@
+#define _XOPEN_SOURCE 700 //nftw
+#include "fixture.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <ftw.h>
+#include <sys/stat.h>
+
+static char fixtureDir[64];
+static FFstrbuf writtenPath;
+
+static void fixtureFailed(const char* message, const char* path)
+{
+    fprintf(stderr, FASTFETCH_TEXT_MODIFIER_ERROR"%s: %s"FASTFETCH_TEXT_MODIFIER_RESET"\n", message, path);
+    exit(1);
+}
+
+void fixtureCreate(const char* name)
+{
+    snprintf(fixtureDir, sizeof(fixtureDir), "/tmp/fastfetch-test-%s-XXXXXX", name);
+    if(mkdtemp(fixtureDir) == NULL)
+        fixtureFailed("mkdtemp failed", fixtureDir);
+
+    ffStrbufInit(&writtenPath);
+}
+
+void fixturePath(const char* relativePath, FFstrbuf* path)
+{
+    ffStrbufSetS(path, fixtureDir);
+    ffStrbufAppendC(path, '/');
+    ffStrbufAppendS(path, relativePath);
+}
+
+const char* fixtureWrite(const char* relativePath, const char* content)
+{
+    fixturePath(relativePath, &writtenPath);
+
+    for(uint32_t i = (uint32_t) strlen(fixtureDir) + 1; i < writtenPath.length; i++)
+    {
+        if(writtenPath.chars[i] != '/')
+            continue;
+        writtenPath.chars[i] = '\0';
+        mkdir(writtenPath.chars, 0700);
+        writtenPath.chars[i] = '/';
+    }
+
+    if(content == NULL)
+    {
+        if(mkdir(writtenPath.chars, 0700) != 0)
+            fixtureFailed("mkdir failed", writtenPath.chars);
+        return writtenPath.chars;
+    }
+
+    FFstrbuf buffer;
+    ffStrbufInit(&buffer);
+    ffStrbufAppendS(&buffer, content);
+    ffWriteFileContent(writtenPath.chars, &buffer);
+    ffStrbufDestroy(&buffer);
+
+    return writtenPath.chars;
+}
+
+void fixtureSymlink(const char* relativePath, const char* target)
+{
+    fixturePath(relativePath, &writtenPath);
+    if(symlink(target, writtenPath.chars) != 0)
+        fixtureFailed("symlink failed", writtenPath.chars);
+}
+
+static int removeEntry(const char* path, const struct stat* st, int type, struct FTW* ftw)
+{
+    FF_UNUSED(st, type, ftw)
+    return remove(path);
+}
+
+void fixtureRemove()
+{
+    //Depth first, so directories are empty when they are removed. Symlinks are removed, not followed
+    if(nftw(fixtureDir, removeEntry, 16, FTW_DEPTH | FTW_PHYS) != 0)
+        fixtureFailed("Couldn't remove", fixtureDir);
+
+    ffStrbufDestroy(&writtenPath);
+}
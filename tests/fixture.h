@@ -0,0 +1,17 @@
+#pragma once
+
+#ifndef FASTFETCH_INCLUDED_TESTS_FIXTURE
+#define FASTFETCH_INCLUDED_TESTS_FIXTURE
+
+#include "fastfetch.h"
+
+//A temporary directory holding the files a test parses, e.g. a fake /proc or /sys tree.
+//All functions end the test with an error message if they fail
+
+void fixtureCreate(const char* name); //Creates /tmp/fastfetch-test-<name>-XXXXXX
+void fixturePath(const char* relativePath, FFstrbuf* path);
+const char* fixtureWrite(const char* relativePath, const char* content); //Creates the parent directories too. A NULL content creates a directory. Returns the full path, valid until the next call
+void fixtureSymlink(const char* relativePath, const char* target);
+void fixtureRemove();
+
+#endif
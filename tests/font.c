@@ -0,0 +1,100 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+static void testFailed(const FFstrbuf* output, const char* message)
+{
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    fputs(message, stderr);
+    fputs(": ", stderr);
+    fputs(output->chars, stderr);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    exit(1);
+}
+
+static void printFont(FFinstance* instance, FFstrbuf* output, const char* formatstr)
+{
+    static FFformat format;
+    static bool compiled = false;
+    if(compiled)
+        ffFormatDestroy(&format);
+    compiled = formatstr != NULL;
+
+    if(formatstr != NULL)
+    {
+        FFstrbuf buffer;
+        ffStrbufInit(&buffer);
+        ffStrbufAppendS(&buffer, formatstr);
+        ffFormatCompile(&format, &buffer);
+        ffStrbufDestroy(&buffer);
+    }
+
+    instance->state.modules[FF_MODULE_ID_FONT].format = formatstr == NULL ? NULL : &format;
+    ffStrbufClear(output);
+    ffPrintFont(instance);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    //An X11 session without a reachable display, so only the config files below are read
+    setenv("XDG_SESSION_TYPE", "x11", 1);
+    unsetenv("DISPLAY");
+    unsetenv("WAYLAND_DISPLAY");
+    unsetenv("XDG_RUNTIME_DIR");
+    unsetenv("GTK2_RC_FILES");
+    unsetenv("GTK3_RC_FILES");
+    unsetenv("GTK4_RC_FILES");
+
+    FFinstance instance;
+    ffInitInstance(&instance);
+    instance.config.recache = true;
+    instance.config.cacheSave = false;
+    instance.config.hideCursor = false;
+    instance.config.disableLinewrap = false;
+    instance.config.printRemainingLogo = false;
+
+    FFstrbuf output;
+    ffStrbufInit(&output);
+    ffOutputSetBuffer(&instance, &output);
+
+    fixtureCreate("font");
+    FF_LIST_FOR_EACH(FFstrbuf, configDir, &instance.state.configDirs)
+        ffStrbufDestroy(configDir);
+    instance.state.configDirs.length = 0;
+    FFstrbuf* configDir = ffListAdd(&instance.state.configDirs);
+    ffStrbufInit(configDir);
+    fixturePath("", configDir);
+
+    ffLoadLogoSet(&instance, "none");
+    ffStart(&instance);
+
+    //A format without arguments doesn't need any font, even if there are none
+    printFont(&instance, &output, "hello");
+    if(ffStrbufFirstIndexS(&output, "hello") == output.length || ffStrbufFirstIndexS(&output, "No fonts found") < output.length)
+        testFailed(&output, "a format without arguments isn't printed as it is");
+
+    //Only GTK3 has a font. A format using only the Plasma font still prints, like the default output does
+    fixtureWrite("gtk-3.0/settings.ini", "[Settings]\ngtk-font-name = Sans 11\n");
+
+    printFont(&instance, &output, "[{1}]");
+    if(ffStrbufFirstIndexS(&output, "[]") == output.length || ffStrbufFirstIndexS(&output, "No fonts found") < output.length)
+        testFailed(&output, "a format using only the Plasma font fails if only GTK has one");
+
+    printFont(&instance, &output, NULL);
+    if(ffStrbufFirstIndexS(&output, "Sans") == output.length || ffStrbufFirstIndexS(&output, "GTK3") == output.length)
+        testFailed(&output, "the default output doesn't contain the GTK3 font");
+
+    printFont(&instance, &output, "{11}");
+    if(ffStrbufFirstIndexS(&output, "Sans") == output.length)
+        testFailed(&output, "the raw GTK3 font isn't printed");
+
+    fixtureRemove();
+    ffStrbufDestroy(&output);
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
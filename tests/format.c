@@ -0,0 +1,207 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+
+static void testFailed(const FFstrbuf* strbuf, const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(", strbuf: ", stderr);
+    ffStrbufWriteTo(strbuf, stderr);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void testCompare(const char* formatstr, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments)
+{
+    FFstrbuf format;
+    ffStrbufInit(&format);
+    ffStrbufAppendS(&format, formatstr);
+
+    FFstrbuf reference;
+    ffStrbufInit(&reference);
+    ffParseFormatString(&reference, &format, error, numArgs, arguments);
+
+    FFformat compiled;
+    ffFormatCompile(&compiled, &format);
+
+    FFstrbuf rendered;
+    ffStrbufInit(&rendered);
+    ffFormatRender(&rendered, &compiled, error, numArgs, arguments);
+
+    if(ffStrbufComp(&reference, &rendered) != 0)
+        testFailed(&rendered, "format \"%s\" (%u args, error: %s): compiled output differs from reference \"%s\"", formatstr, numArgs, error == NULL ? "NULL" : error->chars, reference.chars);
+
+    ffStrbufDestroy(&rendered);
+    ffFormatDestroy(&compiled);
+    ffStrbufDestroy(&reference);
+    ffStrbufDestroy(&format);
+}
+
+static void testExpect(const char* formatstr, const FFstrbuf* error, uint32_t numArgs, const FFformatarg* arguments, const char* expected)
+{
+    testCompare(formatstr, error, numArgs, arguments);
+
+    FFstrbuf format;
+    ffStrbufInit(&format);
+    ffStrbufAppendS(&format, formatstr);
+
+    FFstrbuf rendered;
+    ffStrbufInit(&rendered);
+    ffFormatRender(&rendered, ffFormatGetCompiled(&format), error, numArgs, arguments);
+
+    if(ffStrbufCompS(&rendered, expected) != 0)
+        testFailed(&rendered, "format \"%s\": output != \"%s\"", formatstr, expected);
+
+    ffStrbufDestroy(&rendered);
+    ffStrbufDestroy(&format);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    FFstrbuf error;
+    ffStrbufInit(&error);
+    ffStrbufAppendS(&error, "err");
+
+    FFstrbuf name;
+    ffStrbufInit(&name);
+    ffStrbufAppendS(&name, "name");
+
+    FFstrbuf empty;
+    ffStrbufInit(&empty);
+
+    uint32_t number = 42;
+    uint32_t zero = 0;
+    double ghz = 3.5;
+
+    const FFformatarg arguments[] = {
+        {FF_FORMAT_ARG_TYPE_STRBUF, &name},
+        {FF_FORMAT_ARG_TYPE_UINT, &number},
+        {FF_FORMAT_ARG_TYPE_STRBUF, &empty},
+        {FF_FORMAT_ARG_TYPE_UINT, &zero},
+        {FF_FORMAT_ARG_TYPE_DOUBLE, &ghz}
+    };
+
+    testExpect("", NULL, 5, arguments, "");
+    testExpect("plain text", NULL, 5, arguments, "plain text");
+    testExpect("{1} {2} {5}GHz", NULL, 5, arguments, "name 42 3.5GHz");
+    testExpect("{} {} {}x", NULL, 5, arguments, "name 42 x");
+    testExpect("{{1}} {{", NULL, 5, arguments, "{1}} {");
+    testExpect("{1}{-}{2}", NULL, 5, arguments, "name");
+    testExpect("{?2}has {2}{?}{?3}no {3}{?}.", NULL, 5, arguments, "has 42.");
+    testExpect("{/3}none{/}{/1}some{/}", NULL, 5, arguments, "none");
+    testExpect("{#1;31}red{#} {#32}green", NULL, 5, arguments, "\033[1;31mred\033[0m \033[32mgreen\033[0m");
+    testExpect("{6} {?6}x{?} {/6}y{/}", NULL, 5, arguments, "{6} {?6}x{?} {/6}y{/}");
+    testExpect("{?}{/}{#}", NULL, 5, arguments, "{?}{/}{#}");
+    testExpect("{e} {error} {0}", &error, 5, arguments, "err err err");
+    testExpect("trailing    ", NULL, 5, arguments, "trailing");
+    testExpect("{1", NULL, 5, arguments, "name");
+    testExpect("{abc", NULL, 5, arguments, "{abc");
+    testExpect("{", NULL, 5, arguments, "name");
+
+    // Fixed in both implementations: reading past the last argument, index 0 and error conditions
+    testExpect("{}{}{}{}{}{}", NULL, 2, arguments, "name42{}{}{}{}");
+    testExpect("{00} {?00}x{?}", NULL, 5, arguments, "{00} {?00}x{?}");
+    testExpect("a{?e}b{?}c", NULL, 5, arguments, "ac");
+    testExpect("a{?e}b{?}c", &error, 5, arguments, "abc");
+    testExpect("a{/e}b{/}c", NULL, 5, arguments, "abc");
+    testExpect("a{/e}b{/}c", &error, 5, arguments, "ac");
+
+    // A skipped if continues after the next {?}, even if it is inside another placeholder
+    testExpect("{?3}{a{?}1}", NULL, 5, arguments, "1}");
+    testExpect("{?3}x{?}{?3}y{?}z", NULL, 5, arguments, "z");
+
+    // Number lists are joined like string lists, JSON keeps the numbers
+    FFlist usages;
+    ffListInit(&usages, sizeof(double));
+    *FF_LIST_ADD(double, &usages) = 12.5;
+    *FF_LIST_ADD(double, &usages) = 100;
+    FFformatarg listArgument = {FF_FORMAT_ARG_TYPE_DOUBLE_LIST, &usages};
+
+    testExpect("[{1}]{?1} set{?}", NULL, 1, &listArgument, "[12.5, 100] set");
+
+    FFstrbuf json;
+    ffStrbufInit(&json);
+    ffJsonAppendFormatArg(&json, &listArgument);
+    if(ffStrbufCompS(&json, "[12.5,100]") != 0)
+        testFailed(&json, "JSON of a double list");
+
+    ffListDestroy(&usages);
+    ffStrbufClear(&json);
+    ffJsonAppendFormatArg(&json, &listArgument);
+    if(ffStrbufCompS(&json, "[]") != 0)
+        testFailed(&json, "JSON of an empty double list");
+    ffStrbufDestroy(&json);
+
+    // Compare against the reference with random format strings
+    static const char alphabet[] = "{{{}}}?/?/##-e0123456 ab";
+    uint32_t seed = 12345;
+    char formatstr[24];
+
+    for(uint32_t i = 0; i < 100000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        uint32_t length = (seed >> 16) % (sizeof(formatstr) - 1);
+
+        for(uint32_t k = 0; k < length; k++)
+        {
+            seed = seed * 1103515245 + 12345;
+            formatstr[k] = alphabet[(seed >> 16) % (sizeof(alphabet) - 1)];
+        }
+        formatstr[length] = '\0';
+
+        testCompare(formatstr, (i & 1) ? &error : NULL, i % 6, arguments);
+    }
+
+    //Module keys and formats are compiled by ffStart
+    FFinstance instance;
+    ffInitInstance(&instance);
+    instance.config.hideCursor = false;
+    instance.config.disableLinewrap = false;
+    instance.config.printRemainingLogo = false;
+
+    FFstrbuf output;
+    ffStrbufInit(&output);
+    ffOutputSetBuffer(&instance, &output);
+
+    ffStrbufSetS(&instance.config.modules[FF_MODULE_ID_OS].format, "{2} {?1}[{1}]{?}");
+
+    if(instance.state.modules[FF_MODULE_ID_OS].format != NULL)
+        testFailed(&instance.config.modules[FF_MODULE_ID_OS].format, "module format is compiled before ffStart");
+
+    ffStart(&instance);
+
+    const FFmoduleFormats* module = &instance.state.modules[FF_MODULE_ID_OS];
+    if(module->format == NULL)
+        testFailed(&instance.config.modules[FF_MODULE_ID_OS].format, "module format isn't compiled by ffStart");
+    if(module->key != NULL || instance.state.modules[FF_MODULE_ID_KERNEL].format != NULL)
+        testFailed(&instance.config.modules[FF_MODULE_ID_OS].key, "empty module strings are compiled");
+    if(ffOutputIsDefault(&instance, module->format) || !ffOutputIsDefault(&instance, module->key))
+        testFailed(&instance.config.modules[FF_MODULE_ID_OS].format, "ffOutputIsDefault is wrong");
+    if(ffOutputGetUsedArgs(&instance, module->format) != (FF_FORMAT_ARG_MASK(1) | FF_FORMAT_ARG_MASK(2)))
+        testFailed(&instance.config.modules[FF_MODULE_ID_OS].format, "used args of the module format are wrong");
+
+    FFstrbuf rendered;
+    ffStrbufInit(&rendered);
+    ffFormatRender(&rendered, module->format, NULL, 2, (FFformatarg[]){
+        {FF_FORMAT_ARG_TYPE_STRBUF, &error},
+        {FF_FORMAT_ARG_TYPE_STRBUF, &name}
+    });
+    if(ffStrbufCompS(&rendered, "name [err]") != 0)
+        testFailed(&rendered, "compiled module format renders wrong");
+
+    ffStrbufDestroy(&rendered);
+    ffStrbufDestroy(&output);
+    ffStrbufDestroy(&empty);
+    ffStrbufDestroy(&name);
+    ffStrbufDestroy(&error);
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
@@ -0,0 +1,320 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+static void testFailed(const FFstrbuf* output, const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(", output: ", stderr);
+    ffStrbufWriteTo(output, stderr);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+typedef enum JsonType
+{
+    JSON_TYPE_NULL,
+    JSON_TYPE_BOOL,
+    JSON_TYPE_NUMBER,
+    JSON_TYPE_STRING,
+    JSON_TYPE_ARRAY,
+    JSON_TYPE_OBJECT
+} JsonType;
+
+//Just enough of a JSON parser to check the output is valid and to look into it
+typedef struct JsonValue
+{
+    JsonType type;
+    double number;
+    FFstrbuf string;
+    FFlist keys; //FFstrbuf, objects only
+    FFlist values; //JsonValue, arrays and objects
+} JsonValue;
+
+typedef struct JsonParser
+{
+    const FFstrbuf* output;
+    uint32_t position;
+} JsonParser;
+
+static void skipWhitespace(JsonParser* parser)
+{
+    while(parser->position < parser->output->length && strchr(" \t\r\n", parser->output->chars[parser->position]) != NULL)
+        ++parser->position;
+}
+
+static char peek(JsonParser* parser)
+{
+    skipWhitespace(parser);
+    return parser->position < parser->output->length ? parser->output->chars[parser->position] : '\0';
+}
+
+static void expect(JsonParser* parser, char c)
+{
+    if(peek(parser) != c)
+        testFailed(parser->output, "expected '%c' at %u", c, parser->position);
+    ++parser->position;
+}
+
+static void parseString(JsonParser* parser, FFstrbuf* result)
+{
+    expect(parser, '"');
+
+    while(parser->position < parser->output->length && parser->output->chars[parser->position] != '"')
+    {
+        char c = parser->output->chars[parser->position++];
+
+        if((unsigned char) c < 0x20)
+            testFailed(parser->output, "unescaped control character at %u", parser->position - 1);
+
+        if(c != '\\')
+        {
+            ffStrbufAppendC(result, c);
+            continue;
+        }
+
+        c = parser->output->chars[parser->position++];
+        if(c == 'n')
+            ffStrbufAppendC(result, '\n');
+        else if(c == 't')
+            ffStrbufAppendC(result, '\t');
+        else if(c == 'u')
+        {
+            ffStrbufAppendC(result, (char) strtoul((char[]){
+                parser->output->chars[parser->position], parser->output->chars[parser->position + 1],
+                parser->output->chars[parser->position + 2], parser->output->chars[parser->position + 3], '\0'
+            }, NULL, 16));
+            parser->position += 4;
+        }
+        else if(c == '"' || c == '\\' || c == '/')
+            ffStrbufAppendC(result, c);
+        else
+            testFailed(parser->output, "invalid escape at %u", parser->position - 1);
+    }
+
+    expect(parser, '"');
+}
+
+static void parseValue(JsonParser* parser, JsonValue* value)
+{
+    memset(value, 0, sizeof(*value));
+    ffStrbufInit(&value->string);
+    ffListInit(&value->keys, sizeof(FFstrbuf));
+    ffListInit(&value->values, sizeof(JsonValue));
+
+    char c = peek(parser);
+    const char* rest = parser->output->chars + parser->position;
+
+    if(c == '"')
+    {
+        value->type = JSON_TYPE_STRING;
+        parseString(parser, &value->string);
+    }
+    else if(c == '[' || c == '{')
+    {
+        value->type = c == '[' ? JSON_TYPE_ARRAY : JSON_TYPE_OBJECT;
+        char end = c == '[' ? ']' : '}';
+        ++parser->position;
+
+        if(peek(parser) == end)
+        {
+            ++parser->position;
+            return;
+        }
+
+        do
+        {
+            if(value->type == JSON_TYPE_OBJECT)
+            {
+                FFstrbuf* key = FF_LIST_ADD(FFstrbuf, &value->keys);
+                ffStrbufInit(key);
+                parseString(parser, key);
+                expect(parser, ':');
+            }
+
+            parseValue(parser, FF_LIST_ADD(JsonValue, &value->values));
+        } while(peek(parser) == ',' && ++parser->position);
+
+        expect(parser, end);
+    }
+    else if(strncmp(rest, "null", 4) == 0)
+    {
+        value->type = JSON_TYPE_NULL;
+        parser->position += 4;
+    }
+    else if(strncmp(rest, "true", 4) == 0 || strncmp(rest, "false", 5) == 0)
+    {
+        value->type = JSON_TYPE_BOOL;
+        value->number = c == 't';
+        parser->position += c == 't' ? 4 : 5;
+    }
+    else
+    {
+        char* end;
+        value->type = JSON_TYPE_NUMBER;
+        value->number = strtod(rest, &end);
+        if(end == rest)
+            testFailed(parser->output, "invalid value at %u", parser->position);
+        parser->position += (uint32_t) (end - rest);
+    }
+}
+
+static void destroyValue(JsonValue* value)
+{
+    ffStrbufDestroy(&value->string);
+
+    FF_LIST_FOR_EACH(FFstrbuf, key, &value->keys)
+        ffStrbufDestroy(key);
+    ffListDestroy(&value->keys);
+
+    FF_LIST_FOR_EACH(JsonValue, child, &value->values)
+        destroyValue(child);
+    ffListDestroy(&value->values);
+}
+
+//NULL if the object has no such member
+static const JsonValue* getMember(const JsonValue* object, const char* key)
+{
+    for(uint32_t i = 0; i < object->keys.length; i++)
+    {
+        if(ffStrbufCompS(FF_LIST_GET(FFstrbuf, &object->keys, i), key) == 0)
+            return FF_LIST_GET(JsonValue, &object->values, i);
+    }
+    return NULL;
+}
+
+//The first object of the type which has the member, NULL if there is none
+static const JsonValue* findObject(const JsonValue* root, const char* type, const char* member)
+{
+    FF_LIST_FOR_EACH(JsonValue, object, &root->values)
+    {
+        const JsonValue* objectType = getMember(object, "type");
+        if(objectType != NULL && ffStrbufCompS(&objectType->string, type) == 0 && getMember(object, member) != NULL)
+            return object;
+    }
+    return NULL;
+}
+
+static const JsonValue* getResult(const FFstrbuf* output, const JsonValue* object, uint32_t index, JsonType type)
+{
+    const JsonValue* result = getMember(object, "result");
+    if(result == NULL || result->type != JSON_TYPE_ARRAY || index >= result->values.length)
+        testFailed(output, "result %u is missing", index);
+
+    const JsonValue* value = FF_LIST_GET(JsonValue, &result->values, index);
+    if(value->type != type)
+        testFailed(output, "result %u has type %i instead of %i", index, (int) value->type, (int) type);
+
+    return value;
+}
+
+static void testAppendString(const char* value, const char* expected)
+{
+    FFstrbuf output;
+    ffStrbufInit(&output);
+    ffJsonAppendString(&output, value);
+
+    if(ffStrbufCompS(&output, expected) != 0)
+        testFailed(&output, "ffJsonAppendString result isn't %s", expected);
+
+    ffStrbufDestroy(&output);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    testAppendString("a\"b\\c\n\x01", "\"a\\\"b\\\\c\\n\\u0001\"");
+    //Valid UTF-8 is kept as is: 2, 3 and 4 byte sequences
+    testAppendString("\xC3\xA4 \xE2\x82\xAC \xF0\x9F\x98\x80", "\"\xC3\xA4 \xE2\x82\xAC \xF0\x9F\x98\x80\"");
+    //Every invalid byte is replaced: a lone continuation byte, a truncated sequence, an overlong encoding, a surrogate, a code point above U+10FFFF
+    testAppendString("\x80", "\"\\uFFFD\"");
+    testAppendString("a\xE2\x82", "\"a\\uFFFD\\uFFFD\"");
+    testAppendString("\xC0\xAF", "\"\\uFFFD\\uFFFD\"");
+    testAppendString("\xED\xA0\x80", "\"\\uFFFD\\uFFFD\\uFFFD\"");
+    testAppendString("\xF4\x90\x80\x80x", "\"\\uFFFD\\uFFFD\\uFFFD\\uFFFDx\"");
+
+    FFinstance instance;
+    ffInitInstance(&instance);
+    instance.config.recache = true;
+    instance.config.cacheSave = false;
+    instance.config.outputFormat = FF_OUTPUT_FORMAT_JSON;
+
+    FFstrbuf output;
+    ffStrbufInit(&output);
+    ffOutputSetBuffer(&instance, &output);
+
+    //Custom keys must not change the type of the objects
+    ffStrbufSetS(&instance.config.modules[FF_MODULE_ID_DISK].key, "My disk {1}");
+    ffStrbufSetS(&instance.config.diskFolders, "/:/nonexistent/fastfetch");
+    ffStrbufSetS(&instance.config.modules[FF_MODULE_ID_LOCALIP].key, "My IP {1}");
+    instance.config.localIpShowLoop = true;
+    instance.config.localIpShowIpV4 = true;
+
+    ffStart(&instance);
+    ffPrintDisk(&instance);
+    ffPrintLocalIp(&instance);
+    ffFinish(&instance);
+
+    JsonParser parser = {&output, 0};
+    JsonValue root;
+    parseValue(&parser, &root);
+
+    if(peek(&parser) != '\0')
+        testFailed(&output, "trailing characters at %u", parser.position);
+
+    if(root.type != JSON_TYPE_ARRAY)
+        testFailed(&output, "root is not an array");
+
+    FF_LIST_FOR_EACH(JsonValue, object, &root.values)
+    {
+        const JsonValue* type = getMember(object, "type");
+        if(object->type != JSON_TYPE_OBJECT || type == NULL || type->type != JSON_TYPE_STRING)
+            testFailed(&output, "element without a type string");
+
+        if(ffStrbufCompS(&type->string, "Disk") != 0 && ffStrbufCompS(&type->string, "Local IP") != 0)
+            testFailed(&output, "unexpected type \"%s\"", type->string.chars);
+    }
+
+    //The mount path is the last result, the filesystem type the one before
+    const JsonValue* disk = findObject(&root, "Disk", "result");
+    if(disk == NULL)
+        testFailed(&output, "no disk result");
+    if(getResult(&output, disk, 0, JSON_TYPE_NUMBER)->number < 0)
+        testFailed(&output, "negative disk usage");
+    if(getResult(&output, disk, 6, JSON_TYPE_STRING)->string.length == 0)
+        testFailed(&output, "disk filesystem type is empty");
+    if(ffStrbufCompS(&getResult(&output, disk, 7, JSON_TYPE_STRING)->string, "/") != 0)
+        testFailed(&output, "disk mount path is not \"/\"");
+
+    const JsonValue* diskError = findObject(&root, "Disk", "error");
+    if(diskError == NULL || getMember(diskError, "error")->type != JSON_TYPE_STRING)
+        testFailed(&output, "no disk error for the nonexistent folder");
+
+    //The interface is the last result
+    const JsonValue* localIp = NULL;
+    FF_LIST_FOR_EACH(JsonValue, object, &root.values)
+    {
+        if(getMember(object, "result") == NULL || ffStrbufCompS(&getMember(object, "type")->string, "Local IP") != 0)
+            continue;
+
+        if(ffStrbufCompS(&getResult(&output, object, 1, JSON_TYPE_STRING)->string, "lo") == 0)
+            localIp = object;
+    }
+    if(localIp == NULL)
+        testFailed(&output, "no local ip result for the interface \"lo\"");
+    if(ffStrbufCompS(&getResult(&output, localIp, 0, JSON_TYPE_STRING)->string, "127.0.0.1") != 0)
+        testFailed(&output, "address of \"lo\" is not 127.0.0.1");
+
+    destroyValue(&root);
+    ffStrbufDestroy(&output);
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
@@ -0,0 +1,139 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+
+static void testFailed(const FFlist* list, const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fprintf(stderr, ", list: length %u, capacity %u, %s", list->length, list->capacity, list->data == NULL ? "inline" : "allocated");
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+typedef struct TestElement
+{
+    uint32_t index;
+    char text[12];
+} TestElement;
+
+static void fillList(FFlist* list, uint32_t count)
+{
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        TestElement* element = FF_LIST_ADD(TestElement, list);
+        element->index = i;
+        snprintf(element->text, sizeof(element->text), "%u", i);
+    }
+}
+
+static void checkList(const FFlist* list, uint32_t count)
+{
+    if(list->length != count)
+        testFailed(list, "list->length != %u", count);
+
+    if(list->capacity < list->length)
+        testFailed(list, "list->capacity < list->length");
+
+    for(uint32_t i = 0; i < count; ++i)
+    {
+        const TestElement* element = FF_LIST_GET(const TestElement, list, i);
+        char expected[12];
+        snprintf(expected, sizeof(expected), "%u", i);
+
+        if(element->index != i || strcmp(element->text, expected) != 0)
+            testFailed(list, "element %u has wrong content", i);
+    }
+
+    uint32_t counter = 0;
+    FF_LIST_FOR_EACH(const TestElement, element, list)
+    {
+        if(element->index != counter++)
+            testFailed(list, "FF_LIST_FOR_EACH visited element %u at %u", element->index, counter - 1);
+    }
+
+    if(counter != count)
+        testFailed(list, "FF_LIST_FOR_EACH visited %u elements", counter);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    FFlist list;
+    ffListInit(&list, sizeof(TestElement));
+
+    //Small lists are stored inline
+    uint32_t inlineCapacity = FF_LIST_INLINE_SIZE / sizeof(TestElement);
+
+    if(list.data != NULL || list.length != 0 || list.capacity != inlineCapacity)
+        testFailed(&list, "ffListInit didn't set up inline storage");
+
+    fillList(&list, inlineCapacity);
+    checkList(&list, inlineCapacity);
+
+    if(list.data != NULL)
+        testFailed(&list, "list allocated before the inline storage was full");
+
+    //A moved list keeps its inline elements
+    FFlist moved = list;
+    checkList(&moved, inlineCapacity);
+
+    //Growth doubles the element count
+    ffListAdd(&list);
+    list.length--;
+
+    if(list.data == NULL || list.capacity != inlineCapacity * 2)
+        testFailed(&list, "list didn't move to allocated storage with doubled capacity");
+
+    checkList(&list, inlineCapacity);
+
+    ffListDestroy(&list);
+
+    if(list.data != NULL || list.length != 0)
+        testFailed(&list, "ffListDestroy didn't reset the list");
+
+    //Many elements
+    fillList(&list, 10000);
+    checkList(&list, 10000);
+
+    if(list.capacity >= 20000)
+        testFailed(&list, "list over allocated");
+
+    ffListDestroy(&list);
+
+    //Elements bigger than the inline storage
+    FFlist bigList;
+    ffListInit(&bigList, FF_LIST_INLINE_SIZE + 1);
+
+    if(bigList.capacity != 0)
+        testFailed(&bigList, "bigList.capacity != 0");
+
+    memset(ffListAdd(&bigList), 'x', FF_LIST_INLINE_SIZE + 1);
+
+    if(bigList.data == NULL || bigList.capacity != FF_LIST_DEFAULT_ALLOC)
+        testFailed(&bigList, "bigList wasn't allocated with the default capacity");
+
+    ffListDestroy(&bigList);
+
+    //Explicit capacities are allocated up front
+    ffListInitA(&list, sizeof(TestElement), 100);
+
+    if(list.data == NULL || list.capacity != 100)
+        testFailed(&list, "ffListInitA didn't allocate");
+
+    fillList(&list, 100);
+    checkList(&list, 100);
+
+    if(list.capacity != 100)
+        testFailed(&list, "list grew before it was full");
+
+    ffListDestroy(&list);
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
@@ -0,0 +1,123 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void testMemInfo()
+{
+    //A 5 TiB host, MemTotal doesn't fit in 32 bits
+    const char* fileName = fixtureWrite("meminfo",
+        "MemTotal:       5368709120 kB\n"
+        "MemFree:        1073741824 kB\n"
+        "MemAvailable:   3221225472 kB\n"
+        "Buffers:           1048576 kB\n"
+        "Cached:          536870912 kB\n"
+        "SwapCached:           1024 kB\n"
+        "Active:          123456789 kB\n"
+        "Shmem:             2097152 kB\n"
+        "SReclaimable:      4194304 kB\n"
+        "SUnreclaim:         524288 kB\n"
+        "SwapTotal:        16777216 kB\n"
+        "SwapFree:         12582912 kB\n"
+        "Zswap:               65536 kB\n"
+        "Zswapped:           262144 kB\n"
+        "HugePages_Total:      1024\n"
+        "HugePages_Free:        512\n"
+        "HugePages_Rsvd:          0\n"
+        "Hugepagesize:         2048 kB\n"
+        "DirectMap1G:    5242880000 kB"
+    );
+
+    FFMemoryResult result;
+    if(!ffDetectMemInfo(fileName, &result))
+        testFailed("ffDetectMemInfo failed");
+
+    if(result.total != 5368709120ULL || result.free != 1073741824ULL || result.available != 3221225472ULL)
+        testFailed("wrong total / free / available: %llu / %llu / %llu", (unsigned long long) result.total, (unsigned long long) result.free, (unsigned long long) result.available);
+
+    if(result.buffers != 1048576 || result.cached != 536870912 || result.shared != 2097152 || result.sReclaimable != 4194304)
+        testFailed("wrong buffers / cached / shared / reclaimable");
+
+    //SwapCached must not be mistaken for Cached or SwapTotal
+    if(result.swapTotal != 16777216 || result.swapFree != 12582912)
+        testFailed("wrong swap");
+
+    if(result.zswap != 65536 || result.zswapped != 262144)
+        testFailed("wrong zswap");
+
+    if(result.hugePagesTotal != 1024 || result.hugePagesFree != 512 || result.hugePageSize != 2048)
+        testFailed("wrong huge pages");
+
+    if(result.arcSize != 0)
+        testFailed("arcSize was set");
+
+    //Old kernels have no MemAvailable, Zswap or huge pages
+    fileName = fixtureWrite("meminfo-old",
+        "MemTotal:        8000000 kB\n"
+        "MemFree:         1000000 kB\n"
+        "Buffers:          100000 kB\n"
+        "Cached:          2000000 kB\n"
+    );
+
+    if(!ffDetectMemInfo(fileName, &result))
+        testFailed("ffDetectMemInfo failed on an old meminfo");
+
+    if(result.total != 8000000 || result.cached != 2000000 || result.available != 0 || result.hugePagesTotal != 0)
+        testFailed("wrong values of an old meminfo");
+
+    fileName = fixtureWrite("meminfo-empty", "SwapTotal: 1 kB\n");
+    if(ffDetectMemInfo(fileName, &result))
+        testFailed("ffDetectMemInfo succeeded without MemTotal");
+
+    if(ffDetectMemInfo("/nonexistent/meminfo", &result))
+        testFailed("ffDetectMemInfo succeeded without file");
+}
+
+static void testZFSArc()
+{
+    const char* fileName = fixtureWrite("arcstats",
+        "13 1 0x01 123 33456 4563246231 9823749823749\n"
+        "name                            type data\n"
+        "hits                            4    123456789\n"
+        "size_limit                      4    1\n"
+        "size                            4    8589934592\n"
+        "c_min                           4    1073741824\n"
+    );
+
+    FFMemoryResult result;
+    memset(&result, 0, sizeof(result));
+
+    if(!ffDetectZFSArc(fileName, &result) || result.arcSize != 8589934592ULL)
+        testFailed("wrong ZFS ARC size: %llu", (unsigned long long) result.arcSize);
+
+    if(ffDetectZFSArc("/nonexistent/arcstats", &result))
+        testFailed("ffDetectZFSArc succeeded without file");
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    fixtureCreate("memory");
+
+    testMemInfo();
+    testZFSArc();
+
+    fixtureRemove();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
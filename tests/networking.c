@@ -0,0 +1,214 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+typedef struct TestServer
+{
+    int sock;
+    uint16_t port;
+    const char* response; // NULL: accept, but never answer
+    uint32_t delayMs;
+    bool closeAfterResponse;
+} TestServer;
+
+static void testFailed(const FFstrbuf* strbuf, const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(", strbuf: ", stderr);
+    ffStrbufWriteTo(strbuf, stderr);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static uint64_t getTimeMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+static void* serverThreadMain(void* arg)
+{
+    TestServer* server = arg;
+
+    int client = accept(server->sock, NULL, NULL);
+    if(client == -1)
+        return NULL;
+
+    //Read until the end of the request headers
+    char request[4096];
+    size_t length = 0;
+    while(length < sizeof(request) - 1)
+    {
+        ssize_t received = recv(client, request + length, sizeof(request) - 1 - length, 0);
+        if(received <= 0)
+            break;
+        length += (size_t) received;
+        request[length] = '\0';
+        if(strstr(request, "\r\n\r\n") != NULL)
+            break;
+    }
+
+    if(server->response != NULL)
+    {
+        if(server->delayMs > 0)
+            usleep(server->delayMs * 1000);
+
+        ssize_t sent = send(client, server->response, strlen(server->response), MSG_NOSIGNAL);
+        FF_UNUSED(sent);
+    }
+
+    //Keep silent connections and keep-alive connections open, so the client must not rely on EOF
+    if(server->response == NULL || !server->closeAfterResponse)
+        sleep(3);
+
+    close(client);
+    return NULL;
+}
+
+static void startServer(TestServer* server, const char* response, uint32_t delayMs, bool closeAfterResponse)
+{
+    server->response = response;
+    server->delayMs = delayMs;
+    server->closeAfterResponse = closeAfterResponse;
+
+    server->sock = socket(AF_INET, SOCK_STREAM, 0);
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+
+    socklen_t addrLength = sizeof(addr);
+    if(
+        server->sock == -1 ||
+        bind(server->sock, (struct sockaddr*) &addr, sizeof(addr)) == -1 ||
+        listen(server->sock, 4) == -1 ||
+        getsockname(server->sock, (struct sockaddr*) &addr, &addrLength) == -1
+    ) {
+        perror("Error: failed to start test server");
+        exit(1);
+    }
+
+    server->port = ntohs(addr.sin_port);
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, serverThreadMain, server);
+    pthread_detach(thread);
+}
+
+static void getUrl(char* buffer, size_t size, const TestServer* server, const char* path)
+{
+    snprintf(buffer, size, "127.0.0.1:%u%s", (unsigned) server->port, path);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    FFstrbuf result;
+    ffStrbufInit(&result);
+
+    char url1[64];
+    char url2[64];
+
+    //Content-Length, the connection is kept open after the body
+    TestServer contentLength;
+    startServer(&contentLength, "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 9\r\n\r\n127.0.0.1", 0, false);
+    getUrl(url1, sizeof(url1), &contentLength, "/ip");
+
+    uint64_t start = getTimeMs();
+    ffNetworkingGetHttpFirst(1, (const char*[]) { url1 }, 2000, &result);
+
+    if(ffStrbufCompS(&result, "127.0.0.1") != 0)
+        testFailed(&result, "content length: result != \"127.0.0.1\"");
+
+    if(getTimeMs() - start > 1000)
+        testFailed(&result, "content length: waited for the server to close the connection");
+
+    //Chunked transfer encoding
+    ffStrbufClear(&result);
+    TestServer chunked;
+    startServer(&chunked, "HTTP/1.1 200 OK\r\ntransfer-encoding: chunked\r\n\r\n4\r\n10.0\r\n5\r\n.0.42\r\n0\r\n\r\n", 0, false);
+    getUrl(url1, sizeof(url1), &chunked, "/");
+    ffNetworkingGetHttpFirst(1, (const char*[]) { url1 }, 2000, &result);
+
+    if(ffStrbufCompS(&result, "10.0.0.42") != 0)
+        testFailed(&result, "chunked: result != \"10.0.0.42\"");
+
+    //No length information, the body ends with the connection. Timeouts >= 1000ms must work, too
+    ffStrbufClear(&result);
+    TestServer eof;
+    startServer(&eof, "HTTP/1.0 200 OK\r\n\r\n192.168.1.1\n", 200, true);
+    getUrl(url1, sizeof(url1), &eof, "/");
+    ffNetworkingGetHttpFirst(1, (const char*[]) { url1 }, 1500, &result);
+
+    if(ffStrbufCompS(&result, "192.168.1.1\n") != 0)
+        testFailed(&result, "eof: result != \"192.168.1.1\\n\"");
+
+    //A silent server must not block longer than the timeout
+    ffStrbufClear(&result);
+    TestServer silent;
+    startServer(&silent, NULL, 0, false);
+    getUrl(url1, sizeof(url1), &silent, "/");
+
+    start = getTimeMs();
+    ffNetworkingGetHttpFirst(1, (const char*[]) { url1 }, 300, &result);
+    uint64_t elapsed = getTimeMs() - start;
+
+    if(result.length != 0)
+        testFailed(&result, "silent: result is not empty");
+
+    if(elapsed < 250 || elapsed > 1000)
+        testFailed(&result, "silent: timeout not respected, took %llu ms", (unsigned long long) elapsed);
+
+    //Racing: a silent and an erroneous endpoint must not hide a good one
+    ffStrbufClear(&result);
+    TestServer racingSilent;
+    TestServer racingError;
+    TestServer racingGood;
+    startServer(&racingSilent, NULL, 0, false);
+    startServer(&racingError, "HTTP/1.1 404 Not Found\r\nContent-Length: 9\r\n\r\nnot found", 0, true);
+    startServer(&racingGood, "HTTP/1.1 200 OK\r\nContent-Length: 7\r\n\r\n1.2.3.4", 100, false);
+
+    char url3[64];
+    getUrl(url1, sizeof(url1), &racingSilent, "/");
+    getUrl(url2, sizeof(url2), &racingError, "/");
+    getUrl(url3, sizeof(url3), &racingGood, "/");
+
+    start = getTimeMs();
+    ffNetworkingGetHttpFirst(3, (const char*[]) { url1, url2, url3 }, 2000, &result);
+
+    if(ffStrbufCompS(&result, "1.2.3.4") != 0)
+        testFailed(&result, "racing: result != \"1.2.3.4\"");
+
+    if(getTimeMs() - start > 1000)
+        testFailed(&result, "racing: waited for the silent server");
+
+    //Nothing listening and invalid urls fail without waiting for the timeout
+    ffStrbufClear(&result);
+    start = getTimeMs();
+    ffNetworkingGetHttpFirst(2, (const char*[]) { "127.0.0.1:1/", "127.0.0.1:port/" }, 2000, &result);
+
+    if(result.length != 0)
+        testFailed(&result, "refused: result is not empty");
+
+    if(getTimeMs() - start > 1000)
+        testFailed(&result, "refused: waited for the timeout");
+
+    ffStrbufDestroy(&result);
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
@@ -0,0 +1,273 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+
+static void testFailed(const FFstrbuf* strbuf, const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(", strbuf: ", stderr);
+    ffStrbufWriteTo(strbuf, stderr);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void testUInt(uint64_t value)
+{
+    char expected[32];
+    snprintf(expected, sizeof(expected), "%llu", (unsigned long long) value);
+
+    FFstrbuf strbuf;
+    ffStrbufInitA(&strbuf, 0);
+    ffStrbufAppendUInt(&strbuf, value);
+
+    if(ffStrbufCompS(&strbuf, expected) != 0)
+        testFailed(&strbuf, "ffStrbufAppendUInt: %s", expected);
+
+    ffStrbufDestroy(&strbuf);
+}
+
+static void testInt(int64_t value)
+{
+    char expected[32];
+    snprintf(expected, sizeof(expected), "%lld", (long long) value);
+
+    FFstrbuf strbuf;
+    ffStrbufInitA(&strbuf, 0);
+    ffStrbufAppendInt(&strbuf, value);
+
+    if(ffStrbufCompS(&strbuf, expected) != 0)
+        testFailed(&strbuf, "ffStrbufAppendInt: %s", expected);
+
+    ffStrbufDestroy(&strbuf);
+}
+
+static void testDouble(double value, uint8_t precision)
+{
+    char expected[512];
+    FFstrbuf strbuf;
+    ffStrbufInitA(&strbuf, 0);
+
+    snprintf(expected, sizeof(expected), "%.*f", (int) precision, value);
+    ffStrbufAppendDoubleF(&strbuf, value, precision);
+    if(ffStrbufCompS(&strbuf, expected) != 0)
+        testFailed(&strbuf, "ffStrbufAppendDoubleF(%a, %u): %s", value, precision, expected);
+
+    ffStrbufClear(&strbuf);
+    snprintf(expected, sizeof(expected), "%.*g", (int) precision, value);
+    ffStrbufAppendDoubleG(&strbuf, value, precision);
+    if(ffStrbufCompS(&strbuf, expected) != 0)
+        testFailed(&strbuf, "ffStrbufAppendDoubleG(%a, %u): %s", value, precision, expected);
+
+    ffStrbufDestroy(&strbuf);
+}
+
+static void testShortest(double value)
+{
+    FFstrbuf strbuf;
+    ffStrbufInitA(&strbuf, 0);
+    ffStrbufAppendDouble(&strbuf, value);
+
+    if(isnan(value) || isinf(value))
+    {
+        char expected[16];
+        snprintf(expected, sizeof(expected), "%g", value);
+        if(ffStrbufCompS(&strbuf, expected) != 0)
+            testFailed(&strbuf, "ffStrbufAppendDouble: %s", expected);
+        ffStrbufDestroy(&strbuf);
+        return;
+    }
+
+    double parsed = strtod(strbuf.chars, NULL);
+    if(parsed != value || signbit(parsed) != signbit(value))
+        testFailed(&strbuf, "ffStrbufAppendDouble(%a): doesn't round trip", value);
+
+    //No shorter %g representation may round trip, at any precision. 100 is "100", not "1e+02"
+    if(value != 0)
+    {
+        char shorter[64];
+        for(int precision = 1; precision <= 17; ++precision)
+        {
+            snprintf(shorter, sizeof(shorter), "%.*g", precision, value);
+            if(strtod(shorter, NULL) == value && strlen(shorter) < strbuf.length)
+                testFailed(&strbuf, "ffStrbufAppendDouble(%a): \"%s\" is shorter", value, shorter);
+        }
+    }
+
+    ffStrbufDestroy(&strbuf);
+}
+
+static uint64_t nextRandom(uint64_t* state)
+{
+    //xorshift64
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static double randomDouble(uint64_t* state)
+{
+    uint64_t bits = nextRandom(state);
+
+    switch(bits % 4)
+    {
+        //Any bit pattern
+        case 0: {
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        //Values like the ones modules print
+        case 1: return (double) (nextRandom(state) % 100000) / 100.0;
+        case 2: return (double) (nextRandom(state) % 10000000) / 1000.0;
+        //Halfway cases for rounding
+        default: return (double) (nextRandom(state) % 100000) / 8.0 + 0.0625 * (double) (bits % 16);
+    }
+}
+
+static double timespecDiff(const struct timespec* start, const struct timespec* end)
+{
+    return (double) (end->tv_sec - start->tv_sec) * 1000.0 + (double) (end->tv_nsec - start->tv_nsec) / 1000000.0;
+}
+
+static void benchmark()
+{
+    #define FF_NUMBERS_BENCHMARK_ROUNDS 1000000
+
+    FFstrbuf strbuf;
+    ffStrbufInitA(&strbuf, 64);
+    struct timespec start, end;
+    uint32_t length = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < FF_NUMBERS_BENCHMARK_ROUNDS; ++i)
+    {
+        ffStrbufClear(&strbuf);
+        ffStrbufAppendF(&strbuf, "%u", i * 2654435761u);
+        length += strbuf.length;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("uint:     ffStrbufAppendF %8.2fms, ", timespecDiff(&start, &end));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < FF_NUMBERS_BENCHMARK_ROUNDS; ++i)
+    {
+        ffStrbufClear(&strbuf);
+        ffStrbufAppendUInt(&strbuf, i * 2654435761u);
+        length += strbuf.length;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("ffStrbufAppendUInt    %8.2fms\n", timespecDiff(&start, &end));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < FF_NUMBERS_BENCHMARK_ROUNDS; ++i)
+    {
+        ffStrbufClear(&strbuf);
+        ffStrbufAppendF(&strbuf, "%.2f", i / 7.0);
+        length += strbuf.length;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("double:   ffStrbufAppendF %8.2fms, ", timespecDiff(&start, &end));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < FF_NUMBERS_BENCHMARK_ROUNDS; ++i)
+    {
+        ffStrbufClear(&strbuf);
+        ffStrbufAppendDoubleF(&strbuf, i / 7.0, 2);
+        length += strbuf.length;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("ffStrbufAppendDoubleF %8.2fms\n", timespecDiff(&start, &end));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < FF_NUMBERS_BENCHMARK_ROUNDS; ++i)
+    {
+        ffStrbufClear(&strbuf);
+        ffStrbufAppendF(&strbuf, "%g", i / 7.0);
+        length += strbuf.length;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("double:   ffStrbufAppendF %8.2fms, ", timespecDiff(&start, &end));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(uint32_t i = 0; i < FF_NUMBERS_BENCHMARK_ROUNDS; ++i)
+    {
+        ffStrbufClear(&strbuf);
+        ffStrbufAppendDoubleG(&strbuf, i / 7.0, 6);
+        length += strbuf.length;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    printf("ffStrbufAppendDoubleG %8.2fms\n", timespecDiff(&start, &end));
+
+    //Keeps the loops from being optimized away
+    if(length == 0)
+        testFailed(&strbuf, "benchmark didn't produce any output");
+
+    ffStrbufDestroy(&strbuf);
+
+    #undef FF_NUMBERS_BENCHMARK_ROUNDS
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    static const uint64_t uints[] = {
+        0, 1, 9, 10, 99, 100, 101, 999, 1000, 4294967295ULL, 4294967296ULL, 9999999999999999999ULL, 10000000000000000000ULL, UINT64_MAX
+    };
+    for(uint32_t i = 0; i < sizeof(uints) / sizeof(uints[0]); ++i)
+        testUInt(uints[i]);
+
+    static const int64_t ints[] = {
+        0, 1, -1, 9, -10, 2147483647, -2147483647 - 1, INT64_MAX, INT64_MIN
+    };
+    for(uint32_t i = 0; i < sizeof(ints) / sizeof(ints[0]); ++i)
+        testInt(ints[i]);
+
+    static const double doubles[] = {
+        0.0, -0.0, 1.0, -1.0, 0.5, 1.5, 2.5, 0.125, 0.375, 9.5, 99.5, 999999.5, 0.1, 0.2, 0.3, 1e-5, 1e-4, 9.9999e-5,
+        123456789.0, 3.5, 4.2, 100.0, 1e15, 1e16, 1e17, 1e21, 1e22, 1.8446744073709552e19, 1e-20, 1e-21, 1e-300,
+        DBL_MAX, DBL_MIN, DBL_TRUE_MIN, DBL_EPSILON, 0.05, 0.005, 0.015, 0.025, 5e-324, 2.675, 1.005
+    };
+
+    for(uint32_t i = 0; i < sizeof(doubles) / sizeof(doubles[0]); ++i)
+    {
+        for(uint8_t precision = 0; precision <= 20; ++precision)
+        {
+            testDouble(doubles[i], precision);
+            testDouble(-doubles[i], precision);
+        }
+        testShortest(doubles[i]);
+        testShortest(-doubles[i]);
+    }
+
+    testDouble(NAN, 2);
+    testDouble(INFINITY, 2);
+    testDouble(-INFINITY, 2);
+    testShortest(INFINITY);
+    testShortest(-INFINITY);
+
+    uint64_t state = 88172645463325252ULL;
+    for(uint32_t i = 0; i < 200000; ++i)
+    {
+        testUInt(nextRandom(&state) >> (nextRandom(&state) % 64));
+        testInt((int64_t) nextRandom(&state) >> (nextRandom(&state) % 64));
+
+        double value = randomDouble(&state);
+        testDouble(value, (uint8_t) (nextRandom(&state) % 18));
+        testShortest(value);
+    }
+
+    benchmark();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
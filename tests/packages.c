@@ -0,0 +1,200 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+#ifdef FF_HAVE_SQLITE3
+#include <sqlite3.h>
+#endif
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void testApk()
+{
+    //Entries are separated by empty lines, every one starts with its P: line
+    const char* fileName = fixtureWrite("installed",
+        "C:Q1abc=\n"
+        "P:musl\n"
+        "V:1.2.3-r4\n"
+        "\n"
+        "C:Q1def=\n"
+        "P:busybox\n"
+        "V:1.36.1-r2\n"
+        "r:P:not-a-package\n"
+        "\n"
+        "C:Q1ghi=\n"
+        "P:alpine-baselayout\n"
+    );
+
+    uint32_t count = ffDetectPackagesApk(fileName);
+    if(count != 3)
+        testFailed("apk: %u packages instead of 3", count);
+
+    fileName = fixtureWrite("installed-first", "P:musl\nV:1.2.3-r4\n\nP:busybox\n");
+    count = ffDetectPackagesApk(fileName);
+    if(count != 2)
+        testFailed("apk: %u packages instead of 2, when the file starts with P:", count);
+
+    if(ffDetectPackagesApk("/nonexistent/installed") != 0)
+        testFailed("apk: counted packages without database");
+}
+
+static void testFlatpak()
+{
+    fixtureWrite("flatpak/app/org.mozilla.firefox/current", "");
+    fixtureWrite("flatpak/app/org.gimp.GIMP", NULL);
+    fixtureWrite("flatpak/runtime/org.freedesktop.Platform", NULL);
+    fixtureWrite("flatpak/runtime/org.gnome.Platform", NULL);
+    fixtureWrite("flatpak/runtime/.removed", "");
+    fixtureWrite("flatpak/repo/config", "");
+    //Only apps are installed in the user installation
+    fixtureWrite("user-flatpak/app/com.valvesoftware.Steam", NULL);
+
+    FFstrbuf path;
+    ffStrbufInit(&path);
+
+    fixturePath("flatpak", &path);
+    uint32_t count = ffDetectPackagesFlatpak(path.chars);
+    if(count != 4)
+        testFailed("flatpak: %u packages instead of 4", count);
+
+    fixturePath("user-flatpak", &path);
+    count = ffDetectPackagesFlatpak(path.chars);
+    if(count != 1)
+        testFailed("flatpak: %u user packages instead of 1", count);
+
+    if(ffDetectPackagesFlatpak("/nonexistent/flatpak") != 0)
+        testFailed("flatpak: counted packages without installation");
+
+    ffStrbufDestroy(&path);
+}
+
+#ifdef FF_HAVE_SQLITE3
+
+static void execSQL(sqlite3* db, const char* sql)
+{
+    char* error = NULL;
+    if(sqlite3_exec(db, sql, NULL, NULL, &error) != SQLITE_OK)
+        testFailed("nix: \"%s\" failed: %s", sql, error);
+}
+
+//Adds the store path to ValidPaths and returns its real path, as the profiles resolve to it
+static void addStorePath(sqlite3* db, int id, const char* name, FFstrbuf* realStorePath)
+{
+    FFstrbuf relativePath;
+    ffStrbufInit(&relativePath);
+    ffStrbufAppendS(&relativePath, "store/");
+    ffStrbufAppendS(&relativePath, name);
+
+    char* resolved = realpath(fixtureWrite(relativePath.chars, NULL), NULL);
+    if(resolved == NULL)
+        testFailed("nix: realpath failed for %s", name);
+    ffStrbufSetS(realStorePath, resolved);
+    free(resolved);
+
+    char* sql = sqlite3_mprintf("INSERT INTO ValidPaths VALUES (%d, %Q)", id, realStorePath->chars);
+    execSQL(db, sql);
+    sqlite3_free(sql);
+
+    ffStrbufDestroy(&relativePath);
+}
+
+static void testNix(FFinstance* instance)
+{
+    FFstrbuf dbFile;
+    ffStrbufInit(&dbFile);
+    fixturePath("db.sqlite", &dbFile);
+
+    sqlite3* db;
+    if(sqlite3_open(dbFile.chars, &db) != SQLITE_OK)
+        testFailed("nix: couldn't create %s", dbFile.chars);
+
+    execSQL(db, "CREATE TABLE ValidPaths (id INTEGER PRIMARY KEY, path TEXT UNIQUE NOT NULL)");
+    execSQL(db, "CREATE TABLE Refs (referrer INTEGER NOT NULL, reference INTEGER NOT NULL, PRIMARY KEY (referrer, reference))");
+
+    FFstrbuf systemPath, userPath, storePath;
+    ffStrbufInit(&systemPath);
+    ffStrbufInit(&userPath);
+    ffStrbufInit(&storePath);
+
+    addStorePath(db, 1, "aaa-system-path", &systemPath);
+    addStorePath(db, 2, "bbb-user-environment", &userPath);
+    addStorePath(db, 3, "ccc-bash-5.2", &storePath);
+    addStorePath(db, 4, "ddd-coreutils-9.3", &storePath);
+    addStorePath(db, 5, "eee-git-2.42", &storePath);
+
+    //The system profile references itself, bash and coreutils. The user profile bash again and git
+    execSQL(db, "INSERT INTO Refs VALUES (1, 1), (1, 3), (1, 4), (2, 3), (2, 5), (3, 4)");
+    sqlite3_close(db);
+
+    fixtureSymlink("system", systemPath.chars);
+    fixtureSymlink("default", userPath.chars);
+    fixtureSymlink("user", userPath.chars);
+
+    FFstrbuf system, defaultProfile, user;
+    ffStrbufInit(&system);
+    ffStrbufInit(&defaultProfile);
+    ffStrbufInit(&user);
+    fixturePath("system", &system);
+    fixturePath("default", &defaultProfile);
+    fixturePath("user", &user);
+
+    //bash is referenced by both profiles but counted once, the default and the user profile are the same
+    const char* profiles[] = { system.chars, defaultProfile.chars, user.chars, "/nonexistent/profile" };
+    uint32_t count = ffDetectPackagesNix(instance, dbFile.chars, 4, profiles);
+    if(count != 3)
+        testFailed("nix: %u packages instead of 3", count);
+
+    count = ffDetectPackagesNix(instance, dbFile.chars, 1, profiles);
+    if(count != 2)
+        testFailed("nix: %u packages of the system profile instead of 2", count);
+
+    if(ffDetectPackagesNix(instance, dbFile.chars, 1, profiles + 3) != 0)
+        testFailed("nix: counted packages without profile");
+
+    if(ffDetectPackagesNix(instance, "/nonexistent/db.sqlite", 3, profiles) != 0)
+        testFailed("nix: counted packages without database");
+
+    ffStrbufDestroy(&system);
+    ffStrbufDestroy(&defaultProfile);
+    ffStrbufDestroy(&user);
+    ffStrbufDestroy(&systemPath);
+    ffStrbufDestroy(&userPath);
+    ffStrbufDestroy(&storePath);
+    ffStrbufDestroy(&dbFile);
+}
+
+#endif
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    FFinstance instance;
+    ffInitInstance(&instance);
+
+    fixtureCreate("packages");
+
+    testApk();
+    testFlatpak();
+
+    #ifdef FF_HAVE_SQLITE3
+        testNix(&instance);
+    #endif
+
+    fixtureRemove();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
@@ -0,0 +1,200 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void writeDevice(const char* address, const char* deviceClass, const char* vendor, const char* device, const char* driver)
+{
+    FFstrbuf relativePath;
+    ffStrbufInit(&relativePath);
+
+    const char* files[][2] = {{"class", deviceClass}, {"vendor", vendor}, {"device", device}};
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        ffStrbufSetS(&relativePath, "devices/");
+        ffStrbufAppendS(&relativePath, address);
+        ffStrbufAppendC(&relativePath, '/');
+        ffStrbufAppendS(&relativePath, files[i][0]);
+        fixtureWrite(relativePath.chars, files[i][1]);
+    }
+
+    if(driver != NULL)
+    {
+        ffStrbufSetS(&relativePath, "devices/");
+        ffStrbufAppendS(&relativePath, address);
+        ffStrbufAppendS(&relativePath, "/driver");
+
+        FFstrbuf target;
+        ffStrbufInit(&target);
+        ffStrbufAppendS(&target, "../../../bus/pci/drivers/");
+        ffStrbufAppendS(&target, driver);
+        fixtureSymlink(relativePath.chars, target.chars);
+        ffStrbufDestroy(&target);
+    }
+
+    ffStrbufDestroy(&relativePath);
+}
+
+static void testDevices()
+{
+    writeDevice("0000:00:00.0", "0x060000\n", "0x8086\n", "0x3e30\n", NULL);
+    writeDevice("0000:01:00.0", "0x030000\n", "0x10de\n", "0x1f08\n", "nvidia");
+    writeDevice("0000:00:02.0", "0x030000\n", "0x8086\n", "0x3e98\n", "i915");
+    writeDevice("0000:01:00.1", "0x040300\n", "0x10de\n", "0x10f9\n", "snd_hda_intel");
+    writeDevice("0001:00:00.0", "0x038000\n", "0x1002\n", "0x67df\n", NULL);
+
+    FFstrbuf path;
+    ffStrbufInit(&path);
+    fixturePath("devices", &path);
+
+    FFlist devices;
+    if(!ffDetectPCIDisplayDevices(path.chars, &devices))
+        testFailed("ffDetectPCIDisplayDevices failed");
+
+    if(devices.length != 3)
+        testFailed("devices.length != 3 (%u)", devices.length);
+
+    //Sorted by address
+    const FFPCIDevice* device = FF_LIST_GET(FFPCIDevice, &devices, 0);
+    if(device->vendorId != 0x8086 || device->deviceId != 0x3e98 || device->deviceClass != 0x030000 || ffStrbufCompS(&device->driver, "i915") != 0)
+        testFailed("wrong device 0: %04x:%04x %s", device->vendorId, device->deviceId, device->driver.chars);
+
+    device = FF_LIST_GET(FFPCIDevice, &devices, 1);
+    if(device->vendorId != 0x10de || device->deviceId != 0x1f08 || ffStrbufCompS(&device->driver, "nvidia") != 0)
+        testFailed("wrong device 1: %04x:%04x %s", device->vendorId, device->deviceId, device->driver.chars);
+
+    device = FF_LIST_GET(FFPCIDevice, &devices, 2);
+    if(device->vendorId != 0x1002 || device->deviceId != 0x67df || device->deviceClass != 0x038000 || device->driver.length != 0)
+        testFailed("wrong device 2: %04x:%04x %s", device->vendorId, device->deviceId, device->driver.chars);
+
+    ffPCIDevicesDestroy(&devices);
+
+    if(ffDetectPCIDisplayDevices("/nonexistent", &devices) || devices.length != 0)
+        testFailed("ffDetectPCIDisplayDevices succeeded without directory");
+    ffPCIDevicesDestroy(&devices);
+
+    ffStrbufDestroy(&path);
+}
+
+static void expectLookup(const FFPCIIds* ids, uint16_t vendorId, uint16_t deviceId, bool expectedResult, const char* expectedVendor, const char* expectedDevice)
+{
+    FFstrbuf vendor, device;
+    ffStrbufInit(&vendor);
+    ffStrbufInit(&device);
+
+    bool result = ffPCIIdsLookup(ids, vendorId, deviceId, &vendor, &device);
+    if(result != expectedResult || ffStrbufCompS(&vendor, expectedVendor) != 0 || ffStrbufCompS(&device, expectedDevice) != 0)
+        testFailed("lookup %04x:%04x: \"%s\" \"%s\" (%i)", vendorId, deviceId, vendor.chars, device.chars, result);
+
+    ffStrbufDestroy(&vendor);
+    ffStrbufDestroy(&device);
+}
+
+static void expectLookups(const FFPCIIds* ids)
+{
+    expectLookup(ids, 0x10de, 0x1f08, true, "NVIDIA Corporation", "TU106 [GeForce RTX 2060 Rev. A]");
+    expectLookup(ids, 0x10de, 0x10f9, true, "NVIDIA Corporation", "TU106 High Definition Audio Controller");
+    expectLookup(ids, 0x8086, 0x3e98, true, "Intel Corporation", "CoffeeLake-S GT2 [UHD Graphics 630]");
+    expectLookup(ids, 0x1002, 0x67df, true, "Advanced Micro Devices, Inc. [AMD/ATI]", "Ellesmere [Radeon RX 470/480/570/570X/580/580X/590]");
+    expectLookup(ids, 0x1002, 0x1234, true, "Advanced Micro Devices, Inc. [AMD/ATI]", "");
+    expectLookup(ids, 0x1af4, 0x1050, true, "Red Hat, Inc.", "");
+    expectLookup(ids, 0xabcd, 0x1234, false, "", "");
+    //The class section must not be read as vendors
+    expectLookup(ids, 0x0300, 0x0000, false, "", "");
+}
+
+static void testPCIIds()
+{
+    //Vendors out of order, subsystems, comments and the class section
+    fixtureWrite("pci.ids",
+        "#\n"
+        "#\tList of PCI ID's\n"
+        "#\n"
+        "1002  Advanced Micro Devices, Inc. [AMD/ATI]\n"
+        "\t67df  Ellesmere [Radeon RX 470/480/570/570X/580/580X/590]\n"
+        "\t\t1002 0b31  Radeon RX 580\n"
+        "10de  NVIDIA Corporation\n"
+        "\t1f08  TU106 [GeForce RTX 2060 Rev. A]\n"
+        "\t10f9  TU106 High Definition Audio Controller\n"
+        "\t\t1043 8673  TU106 High Definition Audio Controller\n"
+        "8086  Intel Corporation\n"
+        "\t3e98  CoffeeLake-S GT2 [UHD Graphics 630]\n"
+        "1af4  Red Hat, Inc.\n"
+        "\n"
+        "# List of known device classes, subclasses and programming interfaces\n"
+        "C 03  Display controller\n"
+        "\t00  VGA compatible controller\n"
+        "0300  Not a vendor\n"
+    );
+
+    FFstrbuf path;
+    ffStrbufInit(&path);
+    fixturePath("pci.ids", &path);
+
+    FFPCIIds ids;
+    if(!ffPCIIdsBuild(path.chars, &ids) || ids.mapped)
+        testFailed("ffPCIIdsBuild failed");
+
+    expectLookups(&ids);
+
+    //The written index must be usable mmap'd
+    fixturePath("pciids.ffi", &path);
+    if(!ffPCIIdsWrite(&ids, path.chars))
+        testFailed("ffPCIIdsWrite failed");
+    ffPCIIdsClose(&ids);
+
+    if(!ffPCIIdsOpen(path.chars, &ids) || !ids.mapped)
+        testFailed("ffPCIIdsOpen failed");
+
+    expectLookups(&ids);
+
+    //A truncated index must be rejected
+    size_t size = ids.size;
+    ffPCIIdsClose(&ids);
+    if(truncate(path.chars, (off_t) size - 1) != 0)
+        testFailed("truncate failed");
+
+    if(ffPCIIdsOpen(path.chars, &ids) || ids.data != NULL)
+        testFailed("ffPCIIdsOpen accepted a truncated index");
+
+    fixtureWrite("pciids.ffi", "not an index");
+    if(ffPCIIdsOpen(path.chars, &ids))
+        testFailed("ffPCIIdsOpen accepted a foreign file");
+
+    //Without index lookups fail gracefully
+    expectLookup(&ids, 0x10de, 0x1f08, false, "", "");
+
+    if(ffPCIIdsBuild("/nonexistent/pci.ids", &ids))
+        testFailed("ffPCIIdsBuild succeeded without file");
+
+    ffStrbufDestroy(&path);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    fixtureCreate("pci");
+
+    testDevices();
+    testPCIIds();
+
+    fixtureRemove();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
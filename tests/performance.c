@@ -30,17 +30,23 @@ int main(int argc, char** argv)
         ffLoadLogo(&instance);
     )
 
+    //The timings are printed with stdio, so the module output must use it too to stay in order
+    ffOutputSetFile(&instance, stdout);
+
     ffStrbufSet(&instance.config.color, &instance.config.logoColors[0]);
     instance.config.showErrors = true;
     instance.config.recache = argc == 1;
     instance.config.cacheSave = false;
-    ffStrbufSetS(&instance.config.songFormat, "{}"); //Otherwise the line is too long
+    ffStrbufSetS(&instance.config.modules[FF_MODULE_ID_SONG].format, "{}"); //Otherwise the line is too long
 
     FASTFETCH_TEST_PERFORMANCE(
         puts("Thread starting");
         ffStartDetectionThreads(&instance);
     )
 
+    //Compiles the module formats
+    ffStart(&instance);
+
     FASTFETCH_TEST_PERFORMANCE(ffPrintTitle(&instance))
     FASTFETCH_TEST_PERFORMANCE(ffPrintSeparator(&instance))
     FASTFETCH_TEST_PERFORMANCE(ffPrintOS(&instance))
@@ -73,5 +79,7 @@ int main(int argc, char** argv)
     FASTFETCH_TEST_PERFORMANCE(ffPrintBreak(&instance))
     FASTFETCH_TEST_PERFORMANCE(ffPrintColors(&instance))
 
+    ffFinish(&instance);
+
     return 0;
 }
@@ -0,0 +1,167 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static uint64_t getValue(const FFlist* values, uint32_t index)
+{
+    return *FF_LIST_GET(uint64_t, values, index);
+}
+
+static void testCPU()
+{
+    FFlist values;
+    ffListInit(&values, sizeof(uint64_t));
+
+    const char* stat =
+        "cpu  100 10 50 1000 20 5 5 0 0 0\n"
+        "cpu0 60 5 25 500 10 3 2 0 0 0\n"
+        "cpu3 40 5 25 500 10 2 3 0 0 0\n"
+        "intr 12345 0 0\n"
+        "cpu9 1 1 1 1 1 1 1 0 0 0\n";
+
+    if(!ffSampleParseCPU(stat, &values))
+        testFailed("ffSampleParseCPU failed");
+
+    //The cpu9 line isn't part of the cpu block anymore
+    if(values.length != 9)
+        testFailed("CPU: values.length != 9 (%u)", values.length);
+
+    if(getValue(&values, 0) != UINT64_MAX || getValue(&values, 1) != 160 || getValue(&values, 2) != 1190)
+        testFailed("CPU: wrong aggregate");
+
+    if(getValue(&values, 3) != 0 || getValue(&values, 4) != 90 || getValue(&values, 5) != 605)
+        testFailed("CPU: wrong cpu0");
+
+    if(getValue(&values, 6) != 3 || getValue(&values, 7) != 70 || getValue(&values, 8) != 585)
+        testFailed("CPU: wrong cpu3");
+
+    //Parsing again replaces the values
+    if(!ffSampleParseCPU("cpu  1 1 1 1 1 1 1\n", &values) || values.length != 3)
+        testFailed("CPU: values weren't replaced");
+
+    if(ffSampleParseCPU("intr 12345\n", &values) || ffSampleParseCPU("", &values))
+        testFailed("CPU: parsed a file without cpu lines");
+
+    ffListDestroy(&values);
+}
+
+static void testDisk()
+{
+    fixtureCreate("sampling");
+
+    //sda is a physical disk, sda1 is a partition (not in /sys/block), loop0 has no device.
+    //The name of cciss/c0d0 is cciss!c0d0 in sysfs
+    fixtureWrite("block/sda/device", NULL);
+    fixtureWrite("block/loop0", NULL);
+    fixtureWrite("block/cciss!c0d0/device", NULL);
+
+    FF_STRBUF_CREATE(dir);
+    fixturePath("block", &dir);
+
+    const char* diskstats =
+        "   8       0 sda 1000 10 2048 100 500 20 4096 200 0 300 300 0 0 0 0\n"
+        "   8       1 sda1 900 10 1024 90 400 20 2048 180 0 250 250 0 0 0 0\n"
+        "   7       0 loop0 50 0 100 5 0 0 0 0 0 5 5 0 0 0 0\n"
+        " 104       0 cciss/c0d0 10 0 8 1 10 0 16 1 0 2 2\n";
+
+    FFlist values;
+    ffListInit(&values, sizeof(uint64_t));
+
+    if(!ffSampleParseDisk(diskstats, dir.chars, &values))
+        testFailed("ffSampleParseDisk failed");
+
+    if(values.length != 2)
+        testFailed("Disk: values.length != 2 (%u)", values.length);
+
+    if(getValue(&values, 0) != (2048 + 8) * 512)
+        testFailed("Disk: wrong bytes read (%llu)", (unsigned long long) getValue(&values, 0));
+
+    if(getValue(&values, 1) != (4096 + 16) * 512)
+        testFailed("Disk: wrong bytes written (%llu)", (unsigned long long) getValue(&values, 1));
+
+    if(ffSampleParseDisk("   7       0 loop0 50 0 100 5 0 0 0 0 0 5 5\n", dir.chars, &values))
+        testFailed("Disk: counted a disk without device");
+
+    ffListDestroy(&values);
+
+    ffStrbufDestroy(&dir);
+    fixtureRemove();
+}
+
+static void testNetwork()
+{
+    const char* netDev =
+        "Inter-|   Receive                                                |  Transmit\n"
+        " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n"
+        "    lo: 5000      50    0    0    0     0          0         0     5000      50    0    0    0     0       0          0\n"
+        "  eth0: 1000      10    0    0    0     0          0         0     2000      20    0    0    0     0       0          0\n"
+        "wlan0:300 3 0 0 0 0 0 0 400 4 0 0 0 0 0 0\n";
+
+    FFlist values;
+    ffListInit(&values, sizeof(uint64_t));
+
+    if(!ffSampleParseNetwork(netDev, &values))
+        testFailed("ffSampleParseNetwork failed");
+
+    if(values.length != 2 || getValue(&values, 0) != 1300 || getValue(&values, 1) != 2400)
+        testFailed("Network: wrong values");
+
+    if(ffSampleParseNetwork("    lo: 5000 50 0 0 0 0 0 0 5000 50 0 0 0 0 0 0\n", &values))
+        testFailed("Network: counted lo");
+
+    ffListDestroy(&values);
+}
+
+static void testRate()
+{
+    FFsample first, second;
+    ffListInit(&first.values, sizeof(uint64_t));
+    ffListInit(&second.values, sizeof(uint64_t));
+
+    first.time = 1000000000ULL;
+    second.time = 1500000000ULL;
+    *FF_LIST_ADD(uint64_t, &first.values) = 100;
+    *FF_LIST_ADD(uint64_t, &second.values) = 600;
+    *FF_LIST_ADD(uint64_t, &first.values) = 100;
+    *FF_LIST_ADD(uint64_t, &second.values) = 50;
+
+    if(ffSamplingGetRate(&first, &second, 0) != 1000)
+        testFailed("ffSamplingGetRate != 1000");
+
+    if(ffSamplingGetRate(&first, &second, 1) != 0 || ffSamplingGetRate(&first, &second, 2) != 0)
+        testFailed("ffSamplingGetRate of a reset or missing counter != 0");
+
+    second.time = first.time;
+    if(ffSamplingGetRate(&first, &second, 0) != 0)
+        testFailed("ffSamplingGetRate of an empty window != 0");
+
+    ffListDestroy(&first.values);
+    ffListDestroy(&second.values);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    testCPU();
+    testDisk();
+    testNetwork();
+    testRate();
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
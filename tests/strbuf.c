@@ -2,6 +2,7 @@
 
 #include <string.h>
 #include <stdarg.h>
+#include <ctype.h>
 
 static void testFailed(const FFstrbuf* strbuf, const char* message, ...)
 {
@@ -57,5 +58,92 @@ int main(int argc, char** argv)
     if(strcmp(strbuf.chars, "16") != 0)
         testFailed(&strbuf, "strbuf.chars != \"126\"");
 
+    ffStrbufDestroy(&strbuf);
+
+    //Buffers allocate nothing until the first write
+    ffStrbufInit(&strbuf);
+
+    if(strbuf.allocated != 0 || strbuf.length != 0 || strbuf.chars[0] != '\0')
+        testFailed(&strbuf, "ffStrbufInit allocated");
+
+    //The shared empty string is read only, so writing its terminator would crash
+    ffStrbufAppendS(&strbuf, "");
+    ffStrbufAppendNS(&strbuf, 0, "a");
+    ffStrbufAppendTransformS(&strbuf, "", toupper);
+    ffStrbufTrim(&strbuf, ' ');
+    ffStrbufSubstrBefore(&strbuf, 0);
+    ffStrbufSubstrAfter(&strbuf, 0);
+    ffStrbufRemoveS(&strbuf, "a");
+    ffStrbufClear(&strbuf);
+
+    if(strbuf.allocated != 0 || strbuf.length != 0 || strbuf.chars[0] != '\0')
+        testFailed(&strbuf, "empty operations allocated");
+
+    ffStrbufAppendC(&strbuf, 'a');
+
+    if(strbuf.allocated != FASTFETCH_STRBUF_DEFAULT_ALLOC)
+        testFailed(&strbuf, "strbuf.allocated != FASTFETCH_STRBUF_DEFAULT_ALLOC");
+
+    if(strcmp(strbuf.chars, "a") != 0)
+        testFailed(&strbuf, "strbuf.chars != \"a\"");
+
+    ffStrbufDestroy(&strbuf);
+
+    if(strbuf.allocated != 0 || strbuf.length != 0 || strbuf.chars[0] != '\0')
+        testFailed(&strbuf, "ffStrbufDestroy didn't reset the buffer");
+
+    //Search primitives
+    ffStrbufInit(&strbuf);
+    ffStrbufAppendS(&strbuf, "a\nbb\nccc");
+    ffStrbufAppendC(&strbuf, '\0');
+    ffStrbufAppendC(&strbuf, 'd');
+    ffStrbufAppendC(&strbuf, '\0');
+    ffStrbufAppendC(&strbuf, 'e');
+
+    if(ffStrbufNextIndexC(&strbuf, 2, '\n') != 4 || ffStrbufNextIndexC(&strbuf, 10, '\n') != strbuf.length)
+        testFailed(&strbuf, "ffStrbufNextIndexC");
+
+    if(ffStrbufNextIndexC(&strbuf, 0, '\0') != 8 || ffStrbufNextIndexC(&strbuf, strbuf.length, 'a') != strbuf.length)
+        testFailed(&strbuf, "ffStrbufNextIndexC with '\\0'");
+
+    if(ffStrbufPreviousIndexC(&strbuf, 8, '\n') != 4 || ffStrbufPreviousIndexC(&strbuf, 0, 'a') != 0 || ffStrbufPreviousIndexC(&strbuf, 5, 'x') != strbuf.length)
+        testFailed(&strbuf, "ffStrbufPreviousIndexC");
+
+    if(ffStrbufFirstIndexS(&strbuf, "cc") != 5 || ffStrbufNextIndexS(&strbuf, 6, "cc") != 6 || ffStrbufNextIndexS(&strbuf, 7, "cc") != strbuf.length)
+        testFailed(&strbuf, "ffStrbufNextIndexS");
+
+    if(ffStrbufFirstIndexS(&strbuf, "e") != 11 || ffStrbufFirstIndexS(&strbuf, "ccc\nd") != strbuf.length)
+        testFailed(&strbuf, "ffStrbufFirstIndexS behind '\\0'");
+
+    ffStrbufDestroy(&strbuf);
+
+    //Removal is a single pass, at every position the first matching string wins
+    ffStrbufInit(&strbuf);
+    ffStrbufAppendS(&strbuf, "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz");
+    ffStrbufRemoveStrings(&strbuf, 3, "(R)", "(TM)", " CPU");
+
+    if(strcmp(strbuf.chars, "Intel Core i7-8550U @ 1.80GHz") != 0)
+        testFailed(&strbuf, "ffStrbufRemoveStrings on a CPU name");
+
+    ffStrbufSetS(&strbuf, "aabcabc");
+    ffStrbufRemoveStrings(&strbuf, 3, "", "abc", "ab");
+
+    if(strcmp(strbuf.chars, "a") != 0)
+        testFailed(&strbuf, "strbuf.chars != \"a\"");
+
+    ffStrbufSetS(&strbuf, "xxxx");
+    ffStrbufRemoveS(&strbuf, "xx");
+
+    if(strbuf.length != 0)
+        testFailed(&strbuf, "strbuf.length != 0");
+
+    ffStrbufSetS(&strbuf, "value    ");
+    ffStrbufTrimRight(&strbuf, ' ');
+
+    if(strcmp(strbuf.chars, "value") != 0)
+        testFailed(&strbuf, "ffStrbufTrimRight");
+
+    ffStrbufDestroy(&strbuf);
+
     puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
 }
@@ -0,0 +1,304 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <time.h>
+
+//Compares the FFstrbuf search primitives with the byte by byte loops they replaced, over inputs of the sizes fastfetch sees.
+//Not a test, run it with fastfetch-test-strbufperformance
+
+static uint32_t referenceNextIndexC(const FFstrbuf* strbuf, uint32_t start, char c)
+{
+    for(uint32_t i = start; i < strbuf->length; i++)
+    {
+        if(strbuf->chars[i] == c)
+            return i;
+    }
+    return strbuf->length;
+}
+
+static uint32_t referenceNextIndexS(const FFstrbuf* strbuf, uint32_t start, const char* str)
+{
+    for(uint32_t i = start; i < strbuf->length; i++)
+    {
+        bool found = true;
+
+        for(uint32_t k = 0; str[k] != '\0'; k++)
+        {
+            if(i + k == strbuf->length)
+                return strbuf->length;
+
+            if(strbuf->chars[i + k] != str[k])
+            {
+                found = false;
+                break;
+            }
+        }
+
+        if(found)
+            return i;
+    }
+
+    return strbuf->length;
+}
+
+static void referenceRemoveS(FFstrbuf* strbuf, const char* str)
+{
+    uint32_t stringLength = (uint32_t) strlen(str);
+
+    for(uint32_t i = referenceNextIndexS(strbuf, 0, str); i < strbuf->length; i = referenceNextIndexS(strbuf, i, str))
+        ffStrbufRemoveSubstr(strbuf, i, i + stringLength);
+}
+
+static void referenceTrimRight(FFstrbuf* strbuf, char c)
+{
+    while(ffStrbufEndsWithC(strbuf, c))
+        --strbuf->length;
+    strbuf->chars[strbuf->length] = '\0';
+}
+
+static const char* removeStrings[] = {
+    "(R)", "(r)", "(TM)", "(tm)",
+    " CPU", " FPU", " APU", " Processor",
+    " Dual-Core", " Quad-Core", " Six-Core", " Eight-Core", " Ten-Core",
+    " 2-Core", " 4-Core", " 6-Core", " 8-Core", " 10-Core", " 12-Core", " 14-Core", " 16-Core"
+};
+#define FF_REMOVE_STRINGS_LENGTH ((uint32_t) (sizeof(removeStrings) / sizeof(removeStrings[0])))
+
+static const char* cpuNames[] = {
+    "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz",
+    "AMD Ryzen 9 5950X 16-Core Processor",
+    "Intel(R) Xeon(R) CPU E5-2680 v4 @ 2.40GHz",
+    "AMD Athlon(tm) II X4 640 Quad-Core Processor"
+};
+#define FF_CPU_NAMES_LENGTH ((uint32_t) (sizeof(cpuNames) / sizeof(cpuNames[0])))
+
+static double now()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (double) time.tv_sec * 1e9 + (double) time.tv_nsec;
+}
+
+static void printResult(const char* name, uint32_t inputSize, uint32_t rounds, double referenceTime, double time)
+{
+    printf("%-28s %7u bytes: %10.1fns -> %10.1fns (%.1fx)\n", name, inputSize, referenceTime / rounds, time / rounds, referenceTime / time);
+}
+
+//Lines of a cpuinfo like file with the given number of cores
+static void buildCpuinfo(FFstrbuf* content, uint32_t cores)
+{
+    for(uint32_t i = 0; i < cores; i++)
+    {
+        ffStrbufAppendF(content,
+            "processor\t: %u\n"
+            "vendor_id\t: GenuineIntel\n"
+            "cpu family\t: 6\n"
+            "model\t\t: 142\n"
+            "stepping\t: 10\n"
+            "microcode\t: 0xf0\n"
+            "cpu MHz\t\t: 2000.000\n"
+            "cache size\t: 8192 KB\n"
+            "flags\t\t: fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush mmx fxsr sse sse2 ss ht syscall nx pdpe1gb rdtscp lm constant_tsc arch_perfmon rep_good nopl xtopology nonstop_tsc cpuid tsc_known_freq pni pclmulqdq ssse3 fma cx16 pcid sse4_1 sse4_2 x2apic movbe popcnt aes xsave avx f16c rdrand hypervisor lahf_lm abm 3dnowprefetch\n"
+            "bogomips\t: 4000.00\n"
+            "\n", i
+        );
+    }
+    ffStrbufAppendS(content, "model name\t: Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz\n");
+}
+
+static void benchmarkLines(const FFstrbuf* content, uint32_t rounds)
+{
+    uint32_t referenceLines = 0, lines = 0;
+
+    double start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+    {
+        for(uint32_t i = 0; i < content->length; i = referenceNextIndexC(content, i, '\n') + 1)
+            ++referenceLines;
+    }
+    double referenceTime = now() - start;
+
+    start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+    {
+        for(uint32_t i = 0; i < content->length; i = ffStrbufNextIndexC(content, i, '\n') + 1)
+            ++lines;
+    }
+    double time = now() - start;
+
+    if(lines != referenceLines)
+    {
+        fprintf(stderr, "Error: ffStrbufNextIndexC found %u lines instead of %u\n", lines, referenceLines);
+        exit(1);
+    }
+
+    printResult("ffStrbufNextIndexC (lines)", content->length, rounds, referenceTime, time);
+}
+
+static void benchmarkFirstIndexS(const FFstrbuf* content, uint32_t rounds)
+{
+    uint32_t referenceIndex = 0, index = 0;
+
+    double start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+        referenceIndex += referenceNextIndexS(content, 0, "model name");
+    double referenceTime = now() - start;
+
+    start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+        index += ffStrbufFirstIndexS(content, "model name");
+    double time = now() - start;
+
+    if(index != referenceIndex)
+    {
+        fputs("Error: ffStrbufFirstIndexS returned a different index\n", stderr);
+        exit(1);
+    }
+
+    printResult("ffStrbufFirstIndexS", content->length, rounds, referenceTime, time);
+}
+
+static void benchmarkCacheSplit(uint32_t rounds)
+{
+    //A cache file of the CPU module: a value, then the NUL separated format args
+    FFstrbuf content;
+    ffStrbufInit(&content);
+    ffStrbufAppendS(&content, "Intel Core i7-8550U (8) @ 4GHz");
+    for(uint32_t i = 0; i < FF_CPU_NUM_FORMAT_ARGS; i++)
+    {
+        ffStrbufAppendC(&content, '\0');
+        ffStrbufAppendS(&content, i % 2 == 0 ? "Intel(R) Core(TM) i7-8550U CPU @ 1.80GHz" : "4.000000");
+    }
+
+    uint32_t referenceCount = 0, count = 0;
+
+    double start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+    {
+        for(uint32_t i = referenceNextIndexC(&content, 0, '\0') + 1; i < content.length; i = referenceNextIndexC(&content, i, '\0') + 1)
+            ++referenceCount;
+    }
+    double referenceTime = now() - start;
+
+    start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+    {
+        for(uint32_t i = ffStrbufNextIndexC(&content, 0, '\0') + 1; i < content.length; i = ffStrbufNextIndexC(&content, i, '\0') + 1)
+            ++count;
+    }
+    double time = now() - start;
+
+    if(count != referenceCount)
+    {
+        fputs("Error: splitting the cache content returned a different count\n", stderr);
+        exit(1);
+    }
+
+    printResult("ffStrbufNextIndexC (cache)", content.length, rounds, referenceTime, time);
+    ffStrbufDestroy(&content);
+}
+
+static void benchmarkRemoveStrings(uint32_t rounds)
+{
+    FFstrbuf reference, strbuf;
+    ffStrbufInitA(&reference, 64);
+    ffStrbufInitA(&strbuf, 64);
+
+    double referenceTime = 0, time = 0;
+    uint32_t inputSize = 0;
+
+    for(uint32_t n = 0; n < FF_CPU_NAMES_LENGTH; n++)
+    {
+        inputSize += (uint32_t) strlen(cpuNames[n]);
+
+        double start = now();
+        for(uint32_t r = 0; r < rounds; r++)
+        {
+            ffStrbufSetS(&reference, cpuNames[n]);
+            for(uint32_t i = 0; i < FF_REMOVE_STRINGS_LENGTH; i++)
+                referenceRemoveS(&reference, removeStrings[i]);
+        }
+        referenceTime += now() - start;
+
+        start = now();
+        for(uint32_t r = 0; r < rounds; r++)
+        {
+            ffStrbufSetS(&strbuf, cpuNames[n]);
+            ffStrbufRemoveStringsA(&strbuf, FF_REMOVE_STRINGS_LENGTH, removeStrings);
+        }
+        time += now() - start;
+
+        if(ffStrbufComp(&reference, &strbuf) != 0)
+        {
+            fprintf(stderr, "Error: ffStrbufRemoveStringsA returned \"%s\" instead of \"%s\"\n", strbuf.chars, reference.chars);
+            exit(1);
+        }
+    }
+
+    printResult("ffStrbufRemoveStringsA (21)", inputSize / FF_CPU_NAMES_LENGTH, rounds * FF_CPU_NAMES_LENGTH, referenceTime, time);
+
+    ffStrbufDestroy(&reference);
+    ffStrbufDestroy(&strbuf);
+}
+
+static void benchmarkTrimRight(uint32_t rounds)
+{
+    static const char* value = "Intel Core i7-8550U                                                ";
+
+    FFstrbuf reference, strbuf;
+    ffStrbufInitA(&reference, 128);
+    ffStrbufInitA(&strbuf, 128);
+
+    double start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+    {
+        ffStrbufSetS(&reference, value);
+        referenceTrimRight(&reference, ' ');
+    }
+    double referenceTime = now() - start;
+
+    start = now();
+    for(uint32_t r = 0; r < rounds; r++)
+    {
+        ffStrbufSetS(&strbuf, value);
+        ffStrbufTrimRight(&strbuf, ' ');
+    }
+    double time = now() - start;
+
+    if(ffStrbufComp(&reference, &strbuf) != 0)
+    {
+        fputs("Error: ffStrbufTrimRight returned a different result\n", stderr);
+        exit(1);
+    }
+
+    printResult("ffStrbufTrimRight (+SetS)", (uint32_t) strlen(value), rounds, referenceTime, time);
+
+    ffStrbufDestroy(&reference);
+    ffStrbufDestroy(&strbuf);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    puts("primitive                          input:  byte loop  ->  current");
+
+    //Laptop, workstation and big server /proc/cpuinfo
+    static const uint32_t cores[] = {4, 32, 256};
+    for(uint32_t i = 0; i < sizeof(cores) / sizeof(cores[0]); i++)
+    {
+        FFstrbuf content;
+        ffStrbufInit(&content);
+        buildCpuinfo(&content, cores[i]);
+
+        uint32_t rounds = 20000000 / content.length + 1;
+        benchmarkLines(&content, rounds);
+        benchmarkFirstIndexS(&content, rounds);
+
+        ffStrbufDestroy(&content);
+    }
+
+    benchmarkCacheSplit(200000);
+    benchmarkRemoveStrings(200000);
+    benchmarkTrimRight(1000000);
+}
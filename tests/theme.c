@@ -0,0 +1,100 @@
+#include "fastfetch.h"
+#include "fixture.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+static void testFailed(const FFstrbuf* output, const char* message)
+{
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    fputs(message, stderr);
+    fputs(": ", stderr);
+    fputs(output->chars, stderr);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    exit(1);
+}
+
+static void printTheme(FFinstance* instance, FFstrbuf* output, const char* formatstr)
+{
+    static FFformat format;
+    static bool compiled = false;
+    if(compiled)
+        ffFormatDestroy(&format);
+    compiled = formatstr != NULL;
+
+    if(formatstr != NULL)
+    {
+        FFstrbuf buffer;
+        ffStrbufInit(&buffer);
+        ffStrbufAppendS(&buffer, formatstr);
+        ffFormatCompile(&format, &buffer);
+        ffStrbufDestroy(&buffer);
+    }
+
+    instance->state.modules[FF_MODULE_ID_THEME].format = formatstr == NULL ? NULL : &format;
+    ffStrbufClear(output);
+    ffPrintTheme(instance);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    //An X11 session without a reachable display, so only the config files below are read
+    setenv("XDG_SESSION_TYPE", "x11", 1);
+    unsetenv("DISPLAY");
+    unsetenv("WAYLAND_DISPLAY");
+    unsetenv("XDG_RUNTIME_DIR");
+    unsetenv("GTK2_RC_FILES");
+    unsetenv("GTK3_RC_FILES");
+    unsetenv("GTK4_RC_FILES");
+
+    FFinstance instance;
+    ffInitInstance(&instance);
+    instance.config.recache = true;
+    instance.config.cacheSave = false;
+    instance.config.hideCursor = false;
+    instance.config.disableLinewrap = false;
+    instance.config.printRemainingLogo = false;
+
+    FFstrbuf output;
+    ffStrbufInit(&output);
+    ffOutputSetBuffer(&instance, &output);
+
+    fixtureCreate("theme");
+    FF_LIST_FOR_EACH(FFstrbuf, configDir, &instance.state.configDirs)
+        ffStrbufDestroy(configDir);
+    instance.state.configDirs.length = 0;
+    FFstrbuf* configDir = ffListAdd(&instance.state.configDirs);
+    ffStrbufInit(configDir);
+    fixturePath("", configDir);
+
+    ffLoadLogoSet(&instance, "none");
+    ffStart(&instance);
+
+    //A format without arguments doesn't need any theme, even if there is none
+    printTheme(&instance, &output, "hello");
+    if(ffStrbufFirstIndexS(&output, "hello") == output.length || ffStrbufFirstIndexS(&output, "No themes found") < output.length)
+        testFailed(&output, "a format without arguments isn't printed as it is");
+
+    //Only GTK3 has a theme. A format using only the Plasma widget style still prints, like the default output does
+    fixtureWrite("gtk-3.0/settings.ini", "[Settings]\ngtk-theme-name = Adwaita\n");
+
+    printTheme(&instance, &output, "[{1}]");
+    if(ffStrbufFirstIndexS(&output, "[]") == output.length || ffStrbufFirstIndexS(&output, "No themes found") < output.length)
+        testFailed(&output, "a format using only the Plasma widget style fails if only GTK has a theme");
+
+    printTheme(&instance, &output, NULL);
+    if(ffStrbufFirstIndexS(&output, "Adwaita") == output.length || ffStrbufFirstIndexS(&output, "GTK3") == output.length)
+        testFailed(&output, "the default output doesn't contain the GTK3 theme");
+
+    printTheme(&instance, &output, "{5}");
+    if(ffStrbufFirstIndexS(&output, "Adwaita") == output.length)
+        testFailed(&output, "the GTK3 theme isn't printed");
+
+    fixtureRemove();
+    ffStrbufDestroy(&output);
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}
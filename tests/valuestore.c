@@ -0,0 +1,91 @@
+#include "fastfetch.h"
+
+#include <string.h>
+#include <stdarg.h>
+
+static void testFailed(const char* message, ...)
+{
+    va_list args;
+    va_start(args, message);
+    fputs(FASTFETCH_TEXT_MODIFIER_ERROR, stderr);
+    vfprintf(stderr, message, args);
+    fputs(FASTFETCH_TEXT_MODIFIER_RESET, stderr);
+    fputc('\n', stderr);
+    va_end(args);
+    exit(1);
+}
+
+static void testGet(const FFvaluestore* vs, const char* name, const char* expected)
+{
+    const char* value = ffValuestoreGet(vs, name);
+
+    if(expected == NULL && value != NULL)
+        testFailed("ffValuestoreGet(\"%s\") == \"%s\", expected NULL", name, value);
+
+    if(expected != NULL && (value == NULL || strcmp(value, expected) != 0))
+        testFailed("ffValuestoreGet(\"%s\") == \"%s\", expected \"%s\"", name, value == NULL ? "NULL" : value, expected);
+}
+
+int main(int argc, char** argv)
+{
+    FF_UNUSED(argc, argv)
+
+    FFvaluestore vs;
+    ffValuestoreInit(&vs);
+
+    testGet(&vs, "key", NULL);
+
+    ffValuestoreSet(&vs, "Key", "value");
+    testGet(&vs, "key", "value");
+    testGet(&vs, "KEY", "value");
+    testGet(&vs, "ke", NULL);
+    testGet(&vs, "", NULL);
+
+    //Overwrite with a shorter and a longer value
+    ffValuestoreSet(&vs, "kEy", "v");
+    testGet(&vs, "key", "v");
+    ffValuestoreSet(&vs, "key", "a much longer value than before");
+    testGet(&vs, "Key", "a much longer value than before");
+
+    if(vs.size != 1)
+        testFailed("vs.size == %u, expected 1", vs.size);
+
+    //Values longer than the old fixed size slots
+    char longValue[5000];
+    memset(longValue, 'x', sizeof(longValue) - 1);
+    longValue[sizeof(longValue) - 1] = '\0';
+    ffValuestoreSet(&vs, "long", longValue);
+    testGet(&vs, "long", longValue);
+
+    //Enough entries to grow the table several times
+    char name[32];
+    char value[32];
+    for(uint32_t i = 0; i < 1000; ++i)
+    {
+        snprintf(name, sizeof(name), "Name%u", i);
+        snprintf(value, sizeof(value), "value %u", i);
+        ffValuestoreSet(&vs, name, value);
+    }
+
+    for(uint32_t i = 0; i < 1000; ++i)
+    {
+        snprintf(name, sizeof(name), "NAME%u", i);
+        snprintf(value, sizeof(value), "value %u", i);
+        testGet(&vs, name, value);
+    }
+
+    testGet(&vs, "name1000", NULL);
+    testGet(&vs, "key", "a much longer value than before");
+    testGet(&vs, "long", longValue);
+
+    if(vs.size != 1002)
+        testFailed("vs.size == %u, expected 1002", vs.size);
+
+    if(!ffValuestoreContains(&vs, "name0") || ffValuestoreContains(&vs, "name"))
+        testFailed("ffValuestoreContains");
+
+    ffValuestoreDelete(&vs);
+    ffArenaDestroy(); //The strings of the store live in the arena
+
+    puts("\033[32mAll tests passed!"FASTFETCH_TEXT_MODIFIER_RESET);
+}